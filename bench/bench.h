@@ -0,0 +1,30 @@
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+/* clock_gettime() is POSIX, the library itself stays ANSI C */
+#define _POSIX_C_SOURCE 199309L
+
+#include <time.h>
+#include <stdlib.h>
+
+/**
+ * @brief Returns a monotonic wall clock time in seconds.
+ */
+static double benchNow(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Returns the numeric command line argument @p idx or @p fallback if it's missing.
+ */
+static size_t benchArg(int argc, char **argv, int idx, size_t fallback)
+{
+    return (argc > idx) ? (size_t)strtod(argv[idx], NULL) : fallback;
+}
+
+#endif
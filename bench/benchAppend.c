@@ -0,0 +1,88 @@
+#include "bench.h"
+#include "dynar.h"
+
+/*
+ * Benchmark of daAppendN() against a loop over daAppend().
+ *
+ * Usage: benchAppend [elements] [batch]
+ *
+ * Both variants load the same 8 byte elements into an array that starts with room for a single element,
+ * daAppendN() gets called with @c batch elements at a time.
+ */
+
+/**
+ * @brief Creates an empty array of 8 byte elements that may hold @p elements elements.
+ */
+static DaStruct *createArray(size_t elements)
+{
+    int err;
+    DaDesc desc;
+
+    desc.elements = 1;
+    desc.bytesPerElement = sizeof(unsigned long);
+    desc.maxBytes = elements * sizeof(unsigned long);
+
+    return daCreate(&desc, &err);
+}
+
+int main(int argc, char **argv)
+{
+    int err;
+    size_t i;
+    size_t n;
+    size_t elements;
+    size_t batch;
+    double start;
+    double single;
+    double bulk;
+    unsigned long *src;
+    DaStruct *da;
+
+    elements = benchArg(argc, argv, 1, 10000000);
+    batch = benchArg(argc, argv, 2, 4096);
+
+    if (elements == 0 || batch == 0 || !(src = malloc(elements * sizeof(unsigned long))))
+    {
+        fprintf(stderr, "Unable to allocate the input\n");
+        return 1;
+    }
+
+    for (i = 0; i < elements; i++)
+    {
+        src[i] = (unsigned long)i * 2654435761UL;
+    }
+
+    da = createArray(elements);
+    start = benchNow();
+    for (i = 0; i < elements; i++)
+    {
+        daAppend(da, &err, &src[i]);
+    }
+    single = benchNow() - start;
+    daDestroy(da, &err);
+
+    da = createArray(elements);
+    start = benchNow();
+    for (i = 0; i < elements; i += n)
+    {
+        n = (elements - i < batch) ? elements - i : batch;
+        daAppendN(da, &err, &src[i], n);
+    }
+    bulk = benchNow() - start;
+
+    if (daSize(da, &err) != elements)
+    {
+        fprintf(stderr, "daAppendN: %s\n", daErrToString(err));
+        return 1;
+    }
+
+    daDestroy(da, &err);
+
+    printf("%lu elements of %lu bytes, batches of %lu elements\n", (unsigned long)elements, (unsigned long)sizeof(unsigned long), (unsigned long)batch);
+    printf("daAppend:  %8.2f ns per element\n", single * 1e9 / elements);
+    printf("daAppendN: %8.2f ns per element\n", bulk * 1e9 / elements);
+    printf("speedup:   %8.1f\n", single / bulk);
+
+    free(src);
+    return 0;
+}
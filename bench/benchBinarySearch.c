@@ -0,0 +1,123 @@
+#include "bench.h"
+#include "dynar.h"
+
+/*
+ * Benchmark of the binary searches against bsearch() and a linear daIndexOf().
+ *
+ * Usage: benchBinarySearch [max elements]
+ *
+ * The array of 4 byte unsigned keys grows by a factor of 10 from 100 elements up to max elements
+ * (default 10^7, 10^9 needs 4 GiB of memory). Every size gets searched for the same number of random keys,
+ * half of them exist. The linear search gets measured for fewer keys and extrapolated.
+ */
+#define LOOKUPS 100000
+
+static int compareUInt(const void *a, const void *b)
+{
+    unsigned int x;
+    unsigned int y;
+
+    memcpy(&x, a, sizeof(x));
+    memcpy(&y, b, sizeof(y));
+
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char **argv)
+{
+    int err;
+    size_t i;
+    size_t n;
+    size_t index;
+    size_t sample;
+    size_t found;
+    size_t elements;
+    double start;
+    double typed;
+    double compare;
+    double libc;
+    double linear;
+    unsigned int *keys;
+    unsigned int value;
+    DaDesc desc;
+    DaStruct *da;
+
+    elements = benchArg(argc, argv, 1, 10000000);
+
+    desc.elements = 100;
+    desc.bytesPerElement = sizeof(value);
+    desc.maxBytes = elements * sizeof(value);
+
+    if (!(da = daCreate(&desc, &err)))
+    {
+        fprintf(stderr, "daCreate: %s\n", daErrToString(err));
+        return 1;
+    }
+
+    keys = malloc(LOOKUPS * sizeof(unsigned int));
+
+    printf("%lu lookups of 4 byte keys, time per lookup\n\n", (unsigned long)LOOKUPS);
+    printf("%11s %12s %12s %12s %14s\n", "elements", "Key [ns]", "cmp [ns]", "bsearch [ns]", "daIndexOf [ns]");
+
+    for (n = 100; n <= elements; n *= 10)
+    {
+        for (i = daSize(da, &err); i < n; i++)
+        {
+            value = (unsigned int)i * 2;
+
+            if (!daAppend(da, &err, &value))
+            {
+                fprintf(stderr, "daAppend: %s\n", daErrToString(err));
+                return 1;
+            }
+        }
+
+        srand(1);
+        for (i = 0; i < LOOKUPS; i++)
+        {
+            keys[i] = (unsigned int)((((unsigned long)rand() * RAND_MAX + rand()) % n) * 2 + (i & 1));
+        }
+
+        found = 0;
+        start = benchNow();
+        for (i = 0; i < LOOKUPS; i++)
+        {
+            found += daBinarySearchKey(da, &err, &keys[i], DA_KEY_U32, 0, &index);
+        }
+        typed = benchNow() - start;
+
+        start = benchNow();
+        for (i = 0; i < LOOKUPS; i++)
+        {
+            found += daBinarySearch(da, &err, &keys[i], compareUInt, &index);
+        }
+        compare = benchNow() - start;
+
+        start = benchNow();
+        for (i = 0; i < LOOKUPS; i++)
+        {
+            found += bsearch(&keys[i], daGetFirst(da, &err), n, sizeof(value), compareUInt) != NULL;
+        }
+        libc = benchNow() - start;
+
+        sample = (n <= 10000) ? 1000 : ((n <= 1000000) ? 10 : 1);
+        start = benchNow();
+        for (i = 0; i < sample; i++)
+        {
+            found += daIndexOf(da, &err, &keys[i], &index) == 1;
+        }
+        linear = benchNow() - start;
+
+        printf("%11lu %12.1f %12.1f %12.1f %14.1f\n", (unsigned long)n,
+               typed * 1e9 / LOOKUPS, compare * 1e9 / LOOKUPS, libc * 1e9 / LOOKUPS, linear * 1e9 / sample);
+
+        if (found == 0)
+        {
+            printf("nothing found\n");
+        }
+    }
+
+    free(keys);
+    daDestroy(da, &err);
+    return 0;
+}
@@ -0,0 +1,111 @@
+#include "bench.h"
+#include "dynar.h"
+
+/*
+ * Benchmark of daContains() with a Bloom filter against a plain scan.
+ *
+ * Usage: benchBloom [elements] [lookups]
+ *
+ * The array holds even 8 byte values, 95% of the looked up values are odd and thus missing.
+ * The scan without filter gets measured for at most 100 lookups and extrapolated.
+ * The filter gets measured for the mix of lookups and for missing values only.
+ */
+int main(int argc, char **argv)
+{
+    int err;
+    size_t i;
+    size_t bits;
+    size_t sample;
+    size_t elements;
+    size_t lookups;
+    size_t found;
+    double start;
+    double plain;
+    double filtered;
+    double missing;
+    unsigned long *keys;
+    unsigned long value;
+    DaDesc desc;
+    DaStruct *da;
+    DaBloomStats stats;
+
+    elements = benchArg(argc, argv, 1, 1000000);
+    lookups = benchArg(argc, argv, 2, 1000000);
+
+    desc.elements = elements;
+    desc.bytesPerElement = sizeof(value);
+    desc.maxBytes = elements * sizeof(value);
+
+    if (!(da = daCreate(&desc, &err)))
+    {
+        fprintf(stderr, "daCreate: %s\n", daErrToString(err));
+        return 1;
+    }
+
+    for (i = 0; i < elements; i++)
+    {
+        value = (unsigned long)i * 2;
+        daAppend(da, &err, &value);
+    }
+
+    keys = malloc(lookups * sizeof(unsigned long));
+
+    srand(1);
+    for (i = 0; i < lookups; i++)
+    {
+        keys[i] = ((unsigned long)rand() * 2 + (rand() % 100 >= 95 ? 0 : 1)) % (elements * 2);
+    }
+
+    sample = (lookups < 100) ? lookups : 100;
+    found = 0;
+    start = benchNow();
+    for (i = 0; i < sample; i++)
+    {
+        found += daContains(da, &err, &keys[i]);
+    }
+    plain = (benchNow() - start) / sample;
+
+    printf("%lu elements of %lu bytes, %lu lookups, 95%% missing\n", (unsigned long)elements, (unsigned long)sizeof(value), (unsigned long)lookups);
+    printf("daContains without filter: %.1f ns per lookup\n\n", plain * 1e9);
+    printf("%5s %12s %12s %12s %14s %14s %10s\n", "bits", "filter [KiB]", "mixed [ns]", "missing [ns]", "observed FPR", "expected FPR", "speedup");
+
+    for (bits = 4; bits <= 16; bits += 4)
+    {
+        if (daBloomAttach(da, &err, bits, (size_t)-1) != 0)
+        {
+            fprintf(stderr, "daBloomAttach: %s\n", daErrToString(err));
+            return 1;
+        }
+
+        daBloomTrack(da, &err, 1);
+
+        start = benchNow();
+        for (i = 0; i < lookups; i++)
+        {
+            found += daContains(da, &err, &keys[i]);
+        }
+        filtered = (benchNow() - start) / lookups;
+
+        daBloomStats(da, &err, &stats);
+
+        start = benchNow();
+        for (i = 0; i < lookups; i++)
+        {
+            value = keys[i] | 1;
+            found += daContains(da, &err, &value);
+        }
+        missing = (benchNow() - start) / lookups;
+
+        printf("%5lu %12.1f %12.1f %12.1f %13.4f%% %13.4f%% %10.1f\n", (unsigned long)bits, stats.bytes / 1024.0, filtered * 1e9, missing * 1e9,
+               100.0 * stats.falsePositives / (stats.rejected + stats.falsePositives), 100.0 * stats.expectedRate, plain / filtered);
+    }
+
+    if (found == 0)
+    {
+        printf("nothing found\n");
+    }
+
+    free(keys);
+    daDestroy(da, &err);
+    return 0;
+}
@@ -0,0 +1,169 @@
+#include "bench.h"
+#include "dynar.h"
+
+/*
+ * Benchmark of daForEach(), daReduce() and daMapInPlace() against a loop over daGet().
+ *
+ * Usage: benchForEach [elements] [threads]
+ *
+ * The array holds 4 byte ints. Every row sums up or increments all elements.
+ * Build with "make bench THREADS=1", otherwise the parallel rows show the serial time.
+ */
+
+/**
+ * @brief Sums up a block of ints into the long pointed to by @p ctx.
+ */
+static int visitSum(const void *elements, size_t n, size_t pos, void *ctx)
+{
+    const int *values = elements;
+    long sum;
+    size_t i;
+
+    (void)pos;
+
+    for (i = 0, sum = 0; i < n; i++)
+    {
+        sum += values[i];
+    }
+
+    *(long *)ctx += sum;
+
+    return 0;
+}
+
+/**
+ * @brief Sums up a block of ints into the long accumulator @p acc.
+ */
+static void reduceSum(const void *elements, size_t n, size_t pos, void *acc, void *ctx)
+{
+    (void)ctx;
+
+    visitSum(elements, n, pos, acc);
+}
+
+/**
+ * @brief Adds the partial sum @p part to @p acc.
+ */
+static void combineSum(void *acc, const void *part, void *ctx)
+{
+    (void)ctx;
+
+    *(long *)acc += *(const long *)part;
+}
+
+/**
+ * @brief Increments a block of ints.
+ */
+static void mapIncrement(void *elements, size_t n, size_t pos, void *ctx)
+{
+    int *values = elements;
+    size_t i;
+
+    (void)pos;
+    (void)ctx;
+
+    for (i = 0; i < n; i++)
+    {
+        values[i]++;
+    }
+}
+
+/**
+ * @brief Prints a row with the time per element of the loop over daGet() and of the bulk function.
+ */
+static void printRow(const char *name, double loop, double bulk, size_t elements)
+{
+    printf("%-22s %10.2f %10.2f %8.1f\n", name, loop * 1e9 / elements, bulk * 1e9 / elements, loop / bulk);
+}
+
+int main(int argc, char **argv)
+{
+    int err;
+    int i;
+    long sum;
+    long check;
+    double start;
+    double loop;
+    size_t elements;
+    size_t threads;
+    size_t pos;
+    DaDesc desc;
+    DaStruct *da;
+
+    elements = benchArg(argc, argv, 1, 10000000);
+    threads = benchArg(argc, argv, 2, 4);
+
+    if (elements == 0)
+    {
+        fprintf(stderr, "The array must not be empty\n");
+        return 1;
+    }
+
+    desc.elements = elements;
+    desc.bytesPerElement = sizeof(int);
+    desc.maxBytes = elements * sizeof(int);
+
+    if (!(da = daCreate(&desc, &err)))
+    {
+        fprintf(stderr, "Unable to create the array\n");
+        return 1;
+    }
+
+    srand(1);
+    for (pos = 0; pos < elements; pos++)
+    {
+        i = rand() % 1000;
+        daAppend(da, &err, &i);
+    }
+
+    printf("%lu elements, %lu threads\n\n", (unsigned long)elements, (unsigned long)threads);
+    printf("%-22s %10s %10s %8s\n", "traversal", "daGet [ns]", "bulk [ns]", "speedup");
+
+    /* Sum */
+    start = benchNow();
+    for (pos = 0, check = 0; pos < elements; pos++)
+    {
+        check += *(int *)daGet(da, &err, pos);
+    }
+    loop = benchNow() - start;
+
+    sum = 0;
+    start = benchNow();
+    daForEach(da, &err, visitSum, &sum);
+    printRow("daForEach sum", loop, benchNow() - start, elements);
+
+    sum = 0;
+    start = benchNow();
+    daReduce(da, &err, reduceSum, &sum, NULL);
+    printRow("daReduce sum", loop, benchNow() - start, elements);
+
+    sum = 0;
+    start = benchNow();
+    daReduceParallel(da, &err, reduceSum, combineSum, &sum, sizeof(sum), NULL, threads);
+    printRow("daReduceParallel sum", loop, benchNow() - start, elements);
+
+    if (sum != check)
+    {
+        printf("unexpected result\n");
+    }
+
+    /* Increment */
+    start = benchNow();
+    for (pos = 0; pos < elements; pos++)
+    {
+        (*(int *)daGet(da, &err, pos))++;
+    }
+    loop = benchNow() - start;
+
+    start = benchNow();
+    daMapInPlace(da, &err, mapIncrement, NULL);
+    printRow("daMapInPlace", loop, benchNow() - start, elements);
+
+    start = benchNow();
+    daMapInPlaceParallel(da, &err, mapIncrement, NULL, threads);
+    printRow("daMapInPlaceParallel", loop, benchNow() - start, elements);
+
+    daDestroy(da, &err);
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include "bench.h"
+#include "dynar.h"
+
+/*
+ * Benchmark of daIndexOfMany() against one daIndexOf() call per key.
+ *
+ * Usage: benchIndexOfMany [elements]
+ *
+ * Half of the keys exist in the array of 8 byte elements, the other half doesn't.
+ * The daIndexOf() loop gets measured for at most 100 keys and extrapolated.
+ */
+int main(int argc, char **argv)
+{
+    int err;
+    size_t i;
+    size_t n;
+    size_t index;
+    size_t sample;
+    size_t elements;
+    size_t *indexes;
+    double start;
+    double many;
+    double single;
+    unsigned long *keys;
+    unsigned long value;
+    DaDesc desc;
+    DaStruct *da;
+
+    elements = benchArg(argc, argv, 1, 1000000);
+
+    desc.elements = elements;
+    desc.bytesPerElement = sizeof(value);
+    desc.maxBytes = elements * sizeof(value);
+
+    if (!(da = daCreate(&desc, &err)))
+    {
+        fprintf(stderr, "daCreate: %s\n", daErrToString(err));
+        return 1;
+    }
+
+    for (i = 0; i < elements; i++)
+    {
+        value = (unsigned long)i * 2;
+        daAppend(da, &err, &value);
+    }
+
+    keys = malloc(100000 * sizeof(unsigned long));
+    indexes = malloc(100000 * sizeof(size_t));
+
+    srand(1);
+    for (i = 0; i < 100000; i++)
+    {
+        keys[i] = ((unsigned long)rand() * 2 + (i & 1)) % (elements * 2);
+    }
+
+    printf("%lu elements of %lu bytes\n\n", (unsigned long)elements, (unsigned long)sizeof(value));
+    printf("%8s %18s %18s %10s\n", "keys", "daIndexOfMany [ms]", "daIndexOf [ms]", "speedup");
+
+    for (n = 1; n <= 100000; n *= 10)
+    {
+        start = benchNow();
+        daIndexOfMany(da, &err, keys, n, indexes);
+        many = benchNow() - start;
+
+        sample = (n < 100) ? n : 100;
+        start = benchNow();
+        for (i = 0; i < sample; i++)
+        {
+            daIndexOf(da, &err, &keys[i], &index);
+        }
+        single = (benchNow() - start) * n / sample;
+
+        printf("%8lu %18.3f %18.3f %10.1f\n", (unsigned long)n, many * 1e3, single * 1e3, single / many);
+    }
+
+    free(keys);
+    free(indexes);
+    daDestroy(da, &err);
+    return 0;
+}
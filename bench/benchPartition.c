@@ -0,0 +1,133 @@
+#include "bench.h"
+#include "dynar.h"
+
+/*
+ * Benchmark of daPartition() and daStablePartition() against daRemoveIf() and daRetainIf() into a second array.
+ *
+ * Usage: benchPartition [elements] [percent]
+ *
+ * The array holds 8 byte timestamps, @c percent percent of them are expired and get moved to the front.
+ * The stable partition runs once with a scratch buffer and once in place, where the bytes limit leaves no room.
+ */
+
+/**
+ * @brief Returns whether the timestamp @p element is older than the one @p ctx points to.
+ */
+static int expired(const void *element, void *ctx)
+{
+    return *(const unsigned long *)element < *(const unsigned long *)ctx;
+}
+
+/**
+ * @brief Marks the timestamps in @p elements older than the one @p ctx points to.
+ */
+static void expiredBlock(const void *elements, size_t n, unsigned char *results, void *ctx)
+{
+    const unsigned long *stamps;
+    unsigned long limit;
+    size_t i;
+
+    stamps = elements;
+    limit = *(const unsigned long *)ctx;
+
+    for (i = 0; i < n; i++)
+    {
+        results[i] = (unsigned char)(stamps[i] < limit);
+    }
+}
+
+/**
+ * @brief Creates an array of @p elements pseudo random timestamps below 100 with room for @p spare more elements.
+ */
+static DaStruct *createArray(size_t elements, size_t spare)
+{
+    int err;
+    size_t i;
+    unsigned long stamp;
+    DaDesc desc;
+    DaStruct *da;
+
+    desc.elements = elements;
+    desc.bytesPerElement = sizeof(unsigned long);
+    desc.maxBytes = (elements + spare) * sizeof(unsigned long);
+
+    if (!(da = daCreate(&desc, &err)))
+    {
+        return NULL;
+    }
+
+    srand(1);
+    for (i = 0; i < elements; i++)
+    {
+        stamp = (unsigned long)(rand() % 100);
+        daAppend(da, &err, &stamp);
+    }
+
+    return da;
+}
+
+/**
+ * @brief Prints the time per element of a partition that took @p seconds.
+ */
+static void report(const char *name, double seconds, size_t elements)
+{
+    printf("%-34s %8.2f ns per element, %.3f s in total\n", name, seconds * 1e9 / elements, seconds);
+}
+
+int main(int argc, char **argv)
+{
+    int err;
+    size_t elements;
+    size_t split;
+    size_t removed;
+    unsigned long limit;
+    double start;
+    DaStruct *da;
+    DaStruct *copy;
+
+    elements = benchArg(argc, argv, 1, 10000000);
+    limit = (unsigned long)benchArg(argc, argv, 2, 50);
+
+    if (elements == 0 || !(da = createArray(elements, elements)))
+    {
+        fprintf(stderr, "Unable to create the array\n");
+        return 1;
+    }
+
+    /* Baseline: keep the expired elements in the original and the others in a clone */
+    start = benchNow();
+    copy = daClone(da, &err);
+    daRetainIf(da, &err, expired, &limit, &removed);
+    daRemoveIf(copy, &err, expired, &limit, &removed);
+    report("daClone + daRetainIf/RemoveIf", benchNow() - start, elements);
+    daDestroy(copy, &err);
+    daDestroy(da, &err);
+
+    da = createArray(elements, 0);
+    start = benchNow();
+    daPartition(da, &err, expired, &limit, &split);
+    report("daPartition", benchNow() - start, elements);
+    daDestroy(da, &err);
+
+    da = createArray(elements, 0);
+    start = benchNow();
+    daPartitionBlock(da, &err, expiredBlock, &limit, &split);
+    report("daPartitionBlock", benchNow() - start, elements);
+    daDestroy(da, &err);
+
+    da = createArray(elements, elements);
+    start = benchNow();
+    daStablePartitionBlock(da, &err, expiredBlock, &limit, &split);
+    report("daStablePartitionBlock", benchNow() - start, elements);
+    daDestroy(da, &err);
+
+    da = createArray(elements, 0);
+    start = benchNow();
+    daStablePartitionBlock(da, &err, expiredBlock, &limit, &split);
+    report("daStablePartitionBlock, no scratch", benchNow() - start, elements);
+    daDestroy(da, &err);
+
+    printf("%lu elements of %lu bytes, %lu%% expired, split at %lu\n", (unsigned long)elements, (unsigned long)sizeof(unsigned long), limit, (unsigned long)split);
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include "bench.h"
+#include "dynar.h"
+
+/*
+ * Benchmark of daMin() and daSum() against a loop over daGet().
+ *
+ * Usage: benchReduce [elements] [threads]
+ *
+ * The array holds pseudo random 4 byte ints and 8 byte doubles, every reduction runs over the whole array.
+ * The parallel variants only use more than one thread if the library was built with THREADS=1.
+ */
+
+/**
+ * @brief Fills an array of @p elements elements of the type @p type with pseudo random values.
+ */
+static DaStruct *createArray(int type, size_t elements)
+{
+    int err;
+    int value;
+    double real;
+    size_t i;
+    DaDesc desc;
+    DaStruct *da;
+
+    desc.elements = elements;
+    desc.bytesPerElement = (type == DA_KEY_S32) ? sizeof(int) : sizeof(double);
+    desc.maxBytes = elements * desc.bytesPerElement;
+
+    if (!(da = daCreate(&desc, &err)))
+    {
+        return NULL;
+    }
+
+    srand(1);
+    for (i = 0; i < elements; i++)
+    {
+        value = rand() - RAND_MAX / 2;
+        real = value / 7.0;
+        daAppend(da, &err, (type == DA_KEY_S32) ? (void *)&value : (void *)&real);
+    }
+
+    return da;
+}
+
+/**
+ * @brief Runs the benchmark for one element type and prints a line per reduction.
+ */
+static void benchType(int type, const char *name, size_t elements, size_t threads)
+{
+    int err;
+    int imin;
+    double dmin;
+    double sum;
+    double start;
+    double loop;
+    double reduce;
+    size_t i;
+    size_t index;
+    void *element;
+    DaStruct *da;
+
+    if (!(da = createArray(type, elements)))
+    {
+        fprintf(stderr, "Unable to create the array\n");
+        return;
+    }
+
+    /* Minimum */
+    start = benchNow();
+    element = daGet(da, &err, 0);
+    imin = (type == DA_KEY_S32) ? *(int *)element : 0;
+    dmin = (type == DA_KEY_F64) ? *(double *)element : 0.0;
+    for (i = 1; i < elements; i++)
+    {
+        element = daGet(da, &err, i);
+        if (type == DA_KEY_S32 && *(int *)element < imin)
+        {
+            imin = *(int *)element;
+        }
+        else if (type == DA_KEY_F64 && *(double *)element < dmin)
+        {
+            dmin = *(double *)element;
+        }
+    }
+    loop = benchNow() - start;
+
+    start = benchNow();
+    daMin(da, &err, type, 0, 0, elements - 1, NULL, &index);
+    reduce = benchNow() - start;
+
+    printf("%-6s %-14s %10.2f %10.2f %8.1f\n", name, "min", loop * 1e9 / elements, reduce * 1e9 / elements, loop / reduce);
+
+    start = benchNow();
+    daMinParallel(da, &err, type, 0, 0, elements - 1, NULL, &index, threads);
+    reduce = benchNow() - start;
+
+    printf("%-6s %-14s %10.2f %10.2f %8.1f\n", name, "min parallel", loop * 1e9 / elements, reduce * 1e9 / elements, loop / reduce);
+
+    /* Sum */
+    start = benchNow();
+    for (i = 0, sum = 0.0; i < elements; i++)
+    {
+        element = daGet(da, &err, i);
+        sum += (type == DA_KEY_S32) ? *(int *)element : *(double *)element;
+    }
+    loop = benchNow() - start;
+
+    start = benchNow();
+    daSum(da, &err, type, 0, 0, elements - 1, &sum);
+    reduce = benchNow() - start;
+
+    printf("%-6s %-14s %10.2f %10.2f %8.1f\n", name, "sum", loop * 1e9 / elements, reduce * 1e9 / elements, loop / reduce);
+
+    start = benchNow();
+    daSumParallel(da, &err, type, 0, 0, elements - 1, &sum, threads);
+    reduce = benchNow() - start;
+
+    printf("%-6s %-14s %10.2f %10.2f %8.1f\n", name, "sum parallel", loop * 1e9 / elements, reduce * 1e9 / elements, loop / reduce);
+
+    if (imin > 0 && dmin > 0 && sum == 0.0)
+    {
+        printf("unexpected result\n");
+    }
+
+    daDestroy(da, &err);
+}
+
+int main(int argc, char **argv)
+{
+    size_t elements;
+    size_t threads;
+
+    elements = benchArg(argc, argv, 1, 10000000);
+    threads = benchArg(argc, argv, 2, 4);
+
+    if (elements == 0)
+    {
+        fprintf(stderr, "The array must not be empty\n");
+        return 1;
+    }
+
+    printf("%lu elements, %lu threads\n\n", (unsigned long)elements, (unsigned long)threads);
+    printf("%-6s %-14s %10s %10s %8s\n", "type", "reduction", "daGet [ns]", "typed [ns]", "speedup");
+
+    benchType(DA_KEY_S32, "int32", elements, threads);
+    benchType(DA_KEY_F64, "double", elements, threads);
+
+    return 0;
+}
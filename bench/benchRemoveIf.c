@@ -0,0 +1,122 @@
+#include "bench.h"
+#include "dynar.h"
+
+/*
+ * Benchmark of daRemoveIf() and daRemoveIfBlock() against a loop over daRemove().
+ *
+ * Usage: benchRemoveIf [elements] [percent]
+ *
+ * The array holds 8 byte timestamps, @c percent percent of them are expired and get removed.
+ * The quadratic daRemove() loop only runs for up to 100000 elements.
+ */
+
+/**
+ * @brief Returns whether the timestamp @p element is older than the one @p ctx points to.
+ */
+static int expired(const void *element, void *ctx)
+{
+    return *(const unsigned long *)element < *(const unsigned long *)ctx;
+}
+
+/**
+ * @brief Marks the timestamps in @p elements older than the one @p ctx points to.
+ */
+static void expiredBlock(const void *elements, size_t n, unsigned char *results, void *ctx)
+{
+    const unsigned long *stamps;
+    unsigned long limit;
+    size_t i;
+
+    stamps = elements;
+    limit = *(const unsigned long *)ctx;
+
+    for (i = 0; i < n; i++)
+    {
+        results[i] = (unsigned char)(stamps[i] < limit);
+    }
+}
+
+/**
+ * @brief Creates an array of @p elements pseudo random timestamps below 100.
+ */
+static DaStruct *createArray(size_t elements)
+{
+    int err;
+    size_t i;
+    unsigned long stamp;
+    DaDesc desc;
+    DaStruct *da;
+
+    desc.elements = elements;
+    desc.bytesPerElement = sizeof(unsigned long);
+    desc.maxBytes = elements * sizeof(unsigned long);
+
+    if (!(da = daCreate(&desc, &err)))
+    {
+        return NULL;
+    }
+
+    srand(1);
+    for (i = 0; i < elements; i++)
+    {
+        stamp = (unsigned long)(rand() % 100);
+        daAppend(da, &err, &stamp);
+    }
+
+    return da;
+}
+
+int main(int argc, char **argv)
+{
+    int err;
+    size_t i;
+    size_t elements;
+    size_t small;
+    size_t removed;
+    unsigned long limit;
+    double start;
+    double loop;
+    double single;
+    double block;
+    DaStruct *da;
+
+    elements = benchArg(argc, argv, 1, 10000000);
+    limit = (unsigned long)benchArg(argc, argv, 2, 10);
+    small = (elements < 100000) ? elements : 100000;
+
+    if (!(da = createArray(small)))
+    {
+        fprintf(stderr, "Unable to create the array\n");
+        return 1;
+    }
+
+    start = benchNow();
+    for (i = daSize(da, &err); i > 0; i--)
+    {
+        if (expired(daGet(da, &err, i - 1), &limit))
+        {
+            daRemove(da, &err, i - 1);
+        }
+    }
+    loop = (benchNow() - start) / small;
+    daDestroy(da, &err);
+
+    da = createArray(elements);
+    start = benchNow();
+    daRemoveIf(da, &err, expired, &limit, &removed);
+    single = (benchNow() - start) / elements;
+    daDestroy(da, &err);
+
+    da = createArray(elements);
+    start = benchNow();
+    daRemoveIfBlock(da, &err, expiredBlock, &limit, &removed);
+    block = (benchNow() - start) / elements;
+    daDestroy(da, &err);
+
+    printf("%lu elements of %lu bytes, %lu%% expired, %lu removed\n", (unsigned long)elements, (unsigned long)sizeof(unsigned long), limit, (unsigned long)removed);
+    printf("daRemove loop (%lu elements): %8.2f ns per element\n", (unsigned long)small, loop * 1e9);
+    printf("daRemoveIf:                    %8.2f ns per element, %.2f s in total\n", single * 1e9, single * elements);
+    printf("daRemoveIfBlock:               %8.2f ns per element, %.2f s in total\n", block * 1e9, block * elements);
+
+    return 0;
+}
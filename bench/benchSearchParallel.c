@@ -0,0 +1,82 @@
+#include "bench.h"
+#include "dynar.h"
+
+/*
+ * Scaling benchmark of daIndexOfParallel() and daLastIndexOfParallel().
+ *
+ * Usage: benchSearchParallel [elements] [max threads] [repetitions]
+ *
+ * The searched element is placed in the middle of an array of 8 byte elements so
+ * both the forward and the backward search have to scan half of the array.
+ * Build with "make bench THREADS=1", otherwise all rows show the serial time.
+ */
+int main(int argc, char **argv)
+{
+    int err;
+    size_t i;
+    size_t index;
+    size_t threads;
+    size_t elements;
+    size_t maxThreads;
+    size_t repetitions;
+    double start;
+    double serial;
+    double forward;
+    double backward;
+    char element[8];
+    DaDesc desc;
+    DaStruct *da;
+
+    elements = benchArg(argc, argv, 1, 16 * 1024 * 1024);
+    maxThreads = benchArg(argc, argv, 2, 8);
+    repetitions = benchArg(argc, argv, 3, 5);
+
+    desc.elements = elements;
+    desc.bytesPerElement = sizeof(element);
+    desc.maxBytes = elements * sizeof(element);
+
+    if (!(da = daCreate(&desc, &err)))
+    {
+        fprintf(stderr, "daCreate: %s\n", daErrToString(err));
+        return 1;
+    }
+
+    memset(da->firstAddr, 'a', elements * sizeof(element));
+    da->used = elements;
+
+    memset(element, 'b', sizeof(element));
+    daSet(da, &err, element, elements / 2);
+
+    start = benchNow();
+    for (i = 0; i < repetitions; i++)
+    {
+        daIndexOf(da, &err, element, &index);
+    }
+    serial = (benchNow() - start) / repetitions;
+
+    printf("%lu elements of %lu bytes, match at %lu\n", (unsigned long)elements, (unsigned long)sizeof(element), (unsigned long)index);
+    printf("daIndexOf: %.3f ms\n\n", serial * 1e3);
+    printf("%8s %14s %14s %8s\n", "threads", "IndexOf [ms]", "LastIndex [ms]", "speedup");
+
+    for (threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        start = benchNow();
+        for (i = 0; i < repetitions; i++)
+        {
+            daIndexOfParallel(da, &err, element, &index, threads);
+        }
+        forward = (benchNow() - start) / repetitions;
+
+        start = benchNow();
+        for (i = 0; i < repetitions; i++)
+        {
+            daLastIndexOfParallel(da, &err, element, &index, threads);
+        }
+        backward = (benchNow() - start) / repetitions;
+
+        printf("%8lu %14.3f %14.3f %8.2f\n", (unsigned long)threads, forward * 1e3, backward * 1e3, serial / forward);
+    }
+
+    daDestroy(da, &err);
+    return 0;
+}
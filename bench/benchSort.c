@@ -0,0 +1,114 @@
+#include "bench.h"
+#include "dynar.h"
+
+/*
+ * Benchmark of daSort(), daSortStable() and daSortByKey() against qsort() on the element buffer.
+ *
+ * Usage: benchSort [elements]
+ *
+ * The elements of 4, 8, 16 and 64 bytes start with a pseudo random 4 byte unsigned key,
+ * every function sorts the same unsorted content.
+ */
+
+/**
+ * @brief Compares the unsigned int keys at the start of the elements @p a and @p b.
+ */
+static int compareKey(const void *a, const void *b)
+{
+    unsigned int x;
+    unsigned int y;
+
+    memcpy(&x, a, sizeof(x));
+    memcpy(&y, b, sizeof(y));
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Fills @p elements of @p bytesPerElement bytes at @p buffer with pseudo random keys.
+ */
+static void fill(unsigned char *buffer, size_t elements, size_t bytesPerElement)
+{
+    unsigned int key;
+    size_t i;
+
+    srand(1);
+    for (i = 0; i < elements; i++)
+    {
+        key = ((unsigned int)rand() << 16) ^ (unsigned int)rand();
+        memset(buffer + (i * bytesPerElement), (int)(i & 0xff), bytesPerElement);
+        memcpy(buffer + (i * bytesPerElement), &key, sizeof(key));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    static const size_t widths[] = { 4, 8, 16, 64 };
+    int err;
+    int run;
+    size_t w;
+    size_t elements;
+    size_t bytesPerElement;
+    unsigned char *unsorted;
+    double start;
+    double times[4];
+    DaDesc desc;
+    DaStruct *da;
+
+    elements = benchArg(argc, argv, 1, 2000000);
+
+    printf("%lu elements, ns per element\n", (unsigned long)elements);
+    printf("bytes      qsort     daSort  daSortStable  daSortByKey\n");
+
+    for (w = 0; w < sizeof(widths) / sizeof(widths[0]); w++)
+    {
+        bytesPerElement = widths[w];
+        desc.elements = elements;
+        desc.bytesPerElement = bytesPerElement;
+        desc.maxBytes = elements * bytesPerElement;
+
+        if (!(da = daCreate(&desc, &err)) || !(unsorted = malloc(elements * bytesPerElement)))
+        {
+            fprintf(stderr, "Unable to create the array\n");
+            return 1;
+        }
+
+        fill(unsorted, elements, bytesPerElement);
+        daAppendSlot(da, &err, elements, DA_DIRTY);
+
+        for (run = 0; run < 4; run++)
+        {
+            memcpy(da->firstAddr, unsorted, elements * bytesPerElement);
+            start = benchNow();
+
+            switch (run)
+            {
+            case 0:
+                qsort(da->firstAddr, elements, bytesPerElement, compareKey);
+                break;
+
+            case 1:
+                daSort(da, &err, compareKey);
+                break;
+
+            case 2:
+                daSortStable(da, &err, compareKey);
+                break;
+
+            default:
+                daSortByKey(da, &err, DA_KEY_U32, 0);
+                break;
+            }
+
+            times[run] = (benchNow() - start) / elements;
+        }
+
+        printf("%5lu %10.2f %10.2f %13.2f %12.2f\n", (unsigned long)bytesPerElement,
+               times[0] * 1e9, times[1] * 1e9, times[2] * 1e9, times[3] * 1e9);
+
+        free(unsorted);
+        daDestroy(da, &err);
+    }
+
+    return 0;
+}
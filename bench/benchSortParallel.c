@@ -0,0 +1,82 @@
+#include "bench.h"
+#include "dynar.h"
+
+/*
+ * Scaling benchmark of daSortParallel() for 1 to N threads.
+ *
+ * Usage: benchSortParallel [elements] [max threads]
+ *
+ * The array holds pseudo random 8 byte unsigned longs and gets sorted from the same content for every thread count,
+ * the last column shows the speedup against a single thread.
+ * Build with "make bench THREADS=1", otherwise all rows show the serial time.
+ */
+
+/**
+ * @brief Compares the unsigned longs @p a and @p b.
+ */
+static int compare(const void *a, const void *b)
+{
+    unsigned long x;
+    unsigned long y;
+
+    x = *(const unsigned long *)a;
+    y = *(const unsigned long *)b;
+
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char **argv)
+{
+    int err;
+    size_t i;
+    size_t elements;
+    size_t threads;
+    size_t maxThreads;
+    unsigned long *unsorted;
+    double start;
+    double single;
+    double elapsed;
+    DaDesc desc;
+    DaStruct *da;
+
+    elements = benchArg(argc, argv, 1, 10000000);
+    maxThreads = benchArg(argc, argv, 2, 8);
+
+    desc.elements = elements;
+    desc.bytesPerElement = sizeof(unsigned long);
+    desc.maxBytes = 2 * elements * sizeof(unsigned long);
+
+    if (!(da = daCreate(&desc, &err)) || !(unsorted = malloc(elements * sizeof(unsigned long))))
+    {
+        fprintf(stderr, "Unable to create the array\n");
+        return 1;
+    }
+
+    srand(1);
+    for (i = 0; i < elements; i++)
+    {
+        unsorted[i] = ((unsigned long)rand() << 16) ^ (unsigned long)rand();
+    }
+
+    daAppendN(da, &err, unsorted, elements);
+
+    printf("%lu elements of %lu bytes\n", (unsigned long)elements, (unsigned long)sizeof(unsigned long));
+    printf("threads    seconds  speedup\n");
+
+    for (threads = 1, single = 0; threads <= maxThreads; threads++)
+    {
+        memcpy(da->firstAddr, unsorted, elements * sizeof(unsigned long));
+
+        start = benchNow();
+        daSortParallel(da, &err, compare, threads);
+        elapsed = benchNow() - start;
+        single = (threads == 1) ? elapsed : single;
+
+        printf("%7lu %10.3f %8.2f\n", (unsigned long)threads, elapsed, single / elapsed);
+    }
+
+    free(unsorted);
+    daDestroy(da, &err);
+
+    return 0;
+}
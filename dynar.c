@@ -22,521 +22,7248 @@
  *    SOFTWARE.
  */
 
+#ifdef DA_THREADS
+#define _POSIX_C_SOURCE 200112L
+#endif
+
 #include "dynar.h"
 
+#include <stddef.h>
+#include <limits.h>
+
+#ifdef DA_THREADS
+#include <pthread.h>
+#endif
+
+#if defined(__GNUC__)
+/**
+ * Hints the CPU to load the cache line at @p addr.
+ */
+#define DA_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define DA_PREFETCH(addr) ((void)0)
+#endif
+
+/**
+ * Minimum number of bytes of an array before the binary searches prefetch the next probes.
+ */
+#define DA_PREFETCH_THRESHOLD (512 * 1024)
+
+/**
+ * Number of elements whose matches fit into the bit mask of daScanMask().
+ */
+#define DA_MASK_BITS (sizeof(unsigned long) * 8)
+
 static int paramNotValid(const DaStruct *da, int *err);
 
 /**
- * @brief The function reallocates the dynamic array to increase the space.
+ * @brief The structure is the common header of all jobs executed by daParallelRun().
  *
- * The array remains unchanged in the event of an error.
+ * Every job type embeds it as its first member.
+ * The threads take work from a job by claiming block numbers with daJobClaim().
+ */
+typedef struct str_da_job
+{
+    /**
+     * Function every thread executes with the job as argument.
+     */
+    void (*run)(struct str_da_job *job);
+
+    /**
+     * Next block that gets handed out.
+     */
+    size_t next;
+
+    /**
+     * Number of blocks of the job.
+     */
+    size_t blocks;
+
+#ifdef DA_THREADS
+    /**
+     * 1 if more than one thread works on the job, 0 otherwise.
+     */
+    int shared;
+
+    /**
+     * Protects the job members shared between the threads if DaJob#shared is set.
+     */
+    pthread_mutex_t lock;
+#endif
+
+} DaJob;
+
+/**
+ * @brief The structure describes which bytes of an element a search compares.
+ */
+typedef struct str_da_match
+{
+    /**
+     * The bytes the elements get compared with.
+     */
+    const void *key;
+
+    /**
+     * Offset of the compared bytes within each element.
+     */
+    size_t offset;
+
+    /**
+     * Number of compared bytes.
+     */
+    size_t length;
+
+    /**
+     * Only the bits set in these DaMatch#length bytes get compared or NULL to compare all bits.
+     */
+    const void *mask;
+
+    /**
+     * The masked key if it fits into an unsigned long.
+     */
+    unsigned long word;
+
+    /**
+     * The mask if it fits into an unsigned long.
+     */
+    unsigned long maskWord;
+
+} DaMatch;
+
+/**
+ * @brief The structure describes a parallel search for an element.
+ */
+typedef struct str_da_search_job
+{
+    /**
+     * Common job header.
+     */
+    DaJob job;
+
+    /**
+     * Search this array.
+     */
+    const DaStruct *da;
+
+    /**
+     * Search the array for elements matching this key.
+     */
+    const DaMatch *match;
+
+    /**
+     * Number of elements per block.
+     */
+    size_t blockElements;
+
+    /**
+     * 1 for a search from the end of the array, 0 otherwise.
+     */
+    int reverse;
+
+    /**
+     * 1 if any match ends the search, 0 if the first or last match must be found.
+     */
+    int any;
+
+    /**
+     * Best match found so far or DaStruct#used if there is none yet.
+     */
+    size_t best;
+
+} DaSearchJob;
+
+/**
+ * @brief The function locks the shared members of @p job.
  *
- * @param[in]  da  The array that should be reallocated.
- * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in] job Lock this job.
+ */
+static void daJobLock(DaJob *job)
+{
+#ifdef DA_THREADS
+    if (job->shared)
+    {
+        pthread_mutex_lock(&job->lock);
+    }
+#else
+    (void)job;
+#endif
+}
+
+/**
+ * @brief The function unlocks the shared members of @p job.
  *
- * @returns Returns 0 on success.
- * @returns Otherwise, -1 is returned and @p err is set appropriately.
+ * @param[in] job Unlock this job.
+ */
+static void daJobUnlock(DaJob *job)
+{
+#ifdef DA_THREADS
+    if (job->shared)
+    {
+        pthread_mutex_unlock(&job->lock);
+    }
+#else
+    (void)job;
+#endif
+}
+
+/**
+ * @brief The function hands out the next block of @p job.
  *
- * @b Errors @n
- * ::DA_OK on success. @n
- * ::DA_FATAL | ::DA_ENOMEM if no space is left on device.@n
- * ::DA_PARAM_ERR | ::DA_EXCEEDS_SIZE_LIMIT if the array can't be increased anymore. @n
- * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer. @n
+ * @param[in]  job   Take the block from this job.
+ * @param[out] block Number of the claimed block.
+ *
+ * @returns The function returns 1 if a block was claimed and 0 if all blocks are gone.
  */
-static int daRealloc(DaStruct *da, int *err)
+static int daJobClaim(DaJob *job, size_t *block)
 {
-    size_t bytes;
-    size_t nrElements;
-    void *newArray;
+    int claimed;
+
+    daJobLock(job);
+
+    claimed = 0;
+    if (job->next < job->blocks)
+    {
+        *block = job->next++;
+        claimed = 1;
+    }
+
+    daJobUnlock(job);
+
+    return claimed;
+}
+
+#ifdef DA_THREADS
+/**
+ * @brief Entry point of the threads started by daParallelRun().
+ *
+ * @param[in] arg The job the thread works on.
+ *
+ * @returns Always NULL.
+ */
+static void *daThreadMain(void *arg)
+{
+    DaJob *job;
+
+    job = arg;
+    job->run(job);
+
+    return NULL;
+}
+#endif
+
+/**
+ * @brief The function executes @p job with up to @p threads threads including the calling one.
+ *
+ * The calling thread always works on the job as well, so the job gets finished even if no additional
+ * thread could be started or the library was built without @c DA_THREADS.
+ *
+ * @param[in] job     Execute this job.
+ * @param[in] threads Maximum number of threads.
+ */
+static void daParallelRun(DaJob *job, size_t threads)
+{
+#ifdef DA_THREADS
+    pthread_t *ids;
+    size_t started;
+    size_t i;
+
+    ids = NULL;
+    job->shared = 0;
+
+    if (threads > job->blocks)
+    {
+        threads = job->blocks;
+    }
+
+    if (threads > 1 && (ids = malloc((threads - 1) * sizeof(pthread_t))) && pthread_mutex_init(&job->lock, NULL) == 0)
+    {
+        job->shared = 1;
+
+        for (started = 0; started < threads - 1; started++)
+        {
+            if (pthread_create(&ids[started], NULL, daThreadMain, job) != 0)
+            {
+                break;
+            }
+        }
+
+        job->run(job);
+
+        for (i = 0; i < started; i++)
+        {
+            pthread_join(ids[i], NULL);
+        }
+
+        pthread_mutex_destroy(&job->lock);
+    }
+    else
+    {
+        job->run(job);
+    }
+
+    free(ids);
+#else
+    (void)threads;
+    job->run(job);
+#endif
+}
+
+/**
+ * @brief The function prepares @p match to compare @p length bytes at @p offset of each element with @p key.
+ *
+ * @param[out] match  Initialize this structure.
+ * @param[in]  key    The bytes the elements get compared with.
+ * @param[in]  offset Offset of the compared bytes within each element.
+ * @param[in]  length Number of compared bytes.
+ * @param[in]  mask   Only compare the bits set in these @p length bytes or NULL to compare all bits.
+ */
+static void daMatchInit(DaMatch *match, const void *key, size_t offset, size_t length, const void *mask)
+{
+    match->key = key;
+    match->offset = offset;
+    match->length = length;
+    match->mask = mask;
+    match->word = 0;
+    match->maskWord = 0;
+
+    if (mask && length <= sizeof(unsigned long))
+    {
+        memcpy(&match->word, key, length);
+        memcpy(&match->maskWord, mask, length);
+        match->word &= match->maskWord;
+    }
+}
+
+/**
+ * @brief The function compares the masked bytes of an element with the key of @p match.
+ *
+ * @param[in] match The masked key.
+ * @param[in] bytes The compared bytes of the element.
+ *
+ * @returns The function returns 1 if the bytes match and 0 otherwise.
+ */
+static int daMatchMasked(const DaMatch *match, const char *bytes)
+{
+    const unsigned char *key;
+    const unsigned char *mask;
+    unsigned long word;
+    size_t i;
+
+    if (match->length <= sizeof(unsigned long))
+    {
+        word = 0;
+        memcpy(&word, bytes, match->length);
+        return (word & match->maskWord) == match->word;
+    }
+
+    key = match->key;
+    mask = match->mask;
+
+    for (i = 0; i < match->length; i++)
+    {
+        if (((unsigned char)bytes[i] & mask[i]) != (key[i] & mask[i]))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief The function searches the elements in [@p from, @p to) for the first one that matches.
+ *
+ * Common key sizes are compared with constant sizes so the compiler can replace the calls to memcmp() by plain loads.
+ *
+ * @param[in] da    Search this array.
+ * @param[in] match Search the array for elements matching this key.
+ * @param[in] from  First index to check (0 based).
+ * @param[in] to    Index after the last one to check.
+ *
+ * @returns The function returns the index of the first match or @p to if there is none.
+ */
+static size_t daScanFirst(const DaStruct *da, const DaMatch *match, size_t from, size_t to)
+{
+    const char *base;
+    const char *found;
+    const void *key;
+    size_t stride;
+    size_t i;
+
+    stride = da->bytesPerElement;
+    base = (const char *)da->firstAddr + match->offset;
+    key = match->key;
+    i = from;
+
+    if (match->mask)
+    {
+        for (; i < to && !daMatchMasked(match, base + (i * stride)); i++);
+        return i;
+    }
+
+    switch (match->length)
+    {
+    case 1:
+        if (stride == 1)
+        {
+            found = memchr(base + from, *(const unsigned char *)key, to - from);
+            return found ? (size_t)(found - base) : to;
+        }
+
+        for (; i < to && base[i * stride] != *(const char *)key; i++);
+        break;
+
+    case 2:
+        for (; i < to && memcmp(base + (i * stride), key, 2) != 0; i++);
+        break;
+
+    case 4:
+        for (; i < to && memcmp(base + (i * stride), key, 4) != 0; i++);
+        break;
+
+    case 8:
+        for (; i < to && memcmp(base + (i * stride), key, 8) != 0; i++);
+        break;
+
+    default:
+        for (; i < to && memcmp(base + (i * stride), key, match->length) != 0; i++);
+        break;
+    }
+
+    return i;
+}
+
+/**
+ * @brief The function searches the elements in [@p from, @p to) for the last one that matches.
+ *
+ * @param[in] da    Search this array.
+ * @param[in] match Search the array for elements matching this key.
+ * @param[in] from  First index to check (0 based).
+ * @param[in] to    Index after the last one to check.
+ *
+ * @returns The function returns the index of the last match or @p to if there is none.
+ */
+static size_t daScanLast(const DaStruct *da, const DaMatch *match, size_t from, size_t to)
+{
+    const char *base;
+    const void *key;
+    size_t stride;
+    size_t i;
+
+    stride = da->bytesPerElement;
+    base = (const char *)da->firstAddr + match->offset;
+    key = match->key;
+    i = to;
+
+    if (match->mask)
+    {
+        for (; i > from && !daMatchMasked(match, base + ((i - 1) * stride)); i--);
+    }
+    else
+    {
+        switch (match->length)
+        {
+        case 1:
+            for (; i > from && base[(i - 1) * stride] != *(const char *)key; i--);
+            break;
+
+        case 2:
+            for (; i > from && memcmp(base + ((i - 1) * stride), key, 2) != 0; i--);
+            break;
+
+        case 4:
+            for (; i > from && memcmp(base + ((i - 1) * stride), key, 4) != 0; i--);
+            break;
+
+        case 8:
+            for (; i > from && memcmp(base + ((i - 1) * stride), key, 8) != 0; i--);
+            break;
+
+        default:
+            for (; i > from && memcmp(base + ((i - 1) * stride), key, match->length) != 0; i--);
+            break;
+        }
+    }
+
+    return (i == from) ? to : i - 1;
+}
+
+/**
+ * @brief The function compares the @p n elements starting at @p from with the key of @p match.
+ *
+ * Every element gets compared, the results get collected without branches.
+ *
+ * @param[in] da    Compare the elements of this array.
+ * @param[in] match The key.
+ * @param[in] from  First index to compare (0 based).
+ * @param[in] n     Number of elements, at most ::DA_MASK_BITS.
+ *
+ * @returns The function returns a bit mask whose bit @c j is set if the element @p from + @c j matches.
+ */
+static unsigned long daScanMask(const DaStruct *da, const DaMatch *match, size_t from, size_t n)
+{
+    const char *base;
+    const void *key;
+    unsigned long bits;
+    size_t stride;
+    size_t j;
+
+    stride = da->bytesPerElement;
+    base = (const char *)da->firstAddr + match->offset + (from * stride);
+    key = match->key;
+    bits = 0;
+
+    if (match->mask)
+    {
+        for (j = 0; j < n; j++)
+        {
+            bits |= (unsigned long)daMatchMasked(match, base + (j * stride)) << j;
+        }
+
+        return bits;
+    }
+
+    switch (match->length)
+    {
+    case 1:
+        for (j = 0; j < n; j++)
+        {
+            bits |= (unsigned long)(base[j * stride] == *(const char *)key) << j;
+        }
+        break;
+
+    case 2:
+        for (j = 0; j < n; j++)
+        {
+            bits |= (unsigned long)(memcmp(base + (j * stride), key, 2) == 0) << j;
+        }
+        break;
+
+    case 4:
+        for (j = 0; j < n; j++)
+        {
+            bits |= (unsigned long)(memcmp(base + (j * stride), key, 4) == 0) << j;
+        }
+        break;
+
+    case 8:
+        for (j = 0; j < n; j++)
+        {
+            bits |= (unsigned long)(memcmp(base + (j * stride), key, 8) == 0) << j;
+        }
+        break;
+
+    default:
+        for (j = 0; j < n; j++)
+        {
+            bits |= (unsigned long)(memcmp(base + (j * stride), key, match->length) == 0) << j;
+        }
+        break;
+    }
+
+    return bits;
+}
+
+/**
+ * @brief The structure is one slot of the hash index.
+ */
+typedef struct str_da_index_entry
+{
+    /**
+     * Hash of the element bytes.
+     */
+    size_t hash;
+
+    /**
+     * Position of the element plus one, 0 marks an empty slot.
+     */
+    size_t pos;
+
+} DaIndexEntry;
+
+/**
+ * @brief The structure holds the hash index of an array.
+ *
+ * The index is an open addressing hash table with linear probing that holds one entry per element.
+ */
+struct str_da_index
+{
+    /**
+     * The slots of the table or a NULL pointer if the index is suspended.
+     */
+    DaIndexEntry *entries;
+
+    /**
+     * Number of slots, always a power of two.
+     */
+    size_t slots;
+
+    /**
+     * Number of used slots.
+     */
+    size_t count;
+
+    /**
+     * Byte limit of the table.
+     */
+    size_t maxBytes;
+};
+
+/**
+ * @brief The function calculates the FNV-1a hash of @p bytes.
+ *
+ * @param[in] bytes Hash these bytes.
+ * @param[in] n     Number of bytes.
+ *
+ * @returns The hash value.
+ */
+static size_t daHash(const void *bytes, size_t n)
+{
+    const unsigned char *cur;
+    size_t hash;
+
+    cur = bytes;
+    hash = 2166136261UL;
+
+    while (n--)
+    {
+        hash ^= *cur++;
+        hash *= 16777619UL;
+    }
+
+    /* Fold the high bits in, the table only uses the low ones */
+    return hash ^ (hash >> 16);
+}
+
+/**
+ * @brief The function suspends the index until the next change of the array rebuilds it.
+ *
+ * @param[in] ix Suspend this index.
+ */
+static void daIndexSuspend(struct str_da_index *ix)
+{
+    free(ix->entries);
+    ix->entries = NULL;
+    ix->slots = 0;
+    ix->count = 0;
+}
+
+/**
+ * @brief The function returns the number of slots the index needs for @p elements entries.
+ *
+ * The load factor of the table is kept at or below 1/2.
+ *
+ * @param[in] elements Number of entries.
+ *
+ * @returns The number of slots, a power of two.
+ */
+static size_t daIndexSlots(size_t elements)
+{
+    size_t slots;
+
+    for (slots = 16; slots / 2 < elements; slots *= 2);
+
+    return slots;
+}
+
+/**
+ * @brief The function (re)creates the table of the index for @p elements entries.
+ *
+ * The index gets suspended if the table would exceed the byte limit or no memory is left.
+ *
+ * @param[in] ix       Resize this index.
+ * @param[in] elements Number of entries the table must be able to hold.
+ *
+ * @returns The function returns 0 on success and -1 if the index got suspended.
+ */
+static int daIndexResize(struct str_da_index *ix, size_t elements)
+{
+    DaIndexEntry *entries;
+    size_t slots;
+    size_t mask;
+    size_t i;
+    size_t j;
+
+    slots = daIndexSlots(elements);
+    entries = NULL;
+
+    if (slots <= ix->maxBytes / sizeof(DaIndexEntry))
+    {
+        entries = calloc(slots, sizeof(DaIndexEntry));
+    }
+
+    if (!entries)
+    {
+        daIndexSuspend(ix);
+        return -1;
+    }
+
+    mask = slots - 1;
+
+    for (i = 0; i < ix->slots; i++)
+    {
+        if (ix->entries[i].pos)
+        {
+            for (j = ix->entries[i].hash & mask; entries[j].pos; j = (j + 1) & mask);
+            entries[j] = ix->entries[i];
+        }
+    }
+
+    free(ix->entries);
+    ix->entries = entries;
+    ix->slots = slots;
+    return 0;
+}
+
+/**
+ * @brief The function adds the element at @p pos to the index.
+ *
+ * The table must have room for the entry.
+ *
+ * @param[in] da  The array the index belongs to.
+ * @param[in] pos Position of the element.
+ */
+static void daIndexAdd(DaStruct *da, size_t pos)
+{
+    struct str_da_index *ix;
+    size_t hash;
+    size_t mask;
+    size_t i;
+
+    ix = da->index;
+    mask = ix->slots - 1;
+    hash = daHash((char *)da->firstAddr + (pos * da->bytesPerElement), da->bytesPerElement);
+
+    for (i = hash & mask; ix->entries[i].pos; i = (i + 1) & mask);
+
+    ix->entries[i].hash = hash;
+    ix->entries[i].pos = pos + 1;
+    ix->count++;
+}
+
+/**
+ * @brief The function returns the slot of the entry for the element at @p pos.
+ *
+ * The bytes of the element must still be in the array.
+ *
+ * @param[in] da  The array the index belongs to.
+ * @param[in] pos Position of the element.
+ *
+ * @returns The slot of the entry or the number of slots if the element was changed behind the back of the index.
+ */
+static size_t daIndexSlot(const DaStruct *da, size_t pos)
+{
+    const struct str_da_index *ix;
+    size_t hash;
+    size_t mask;
+    size_t i;
+
+    ix = da->index;
+    mask = ix->slots - 1;
+    hash = daHash((char *)da->firstAddr + (pos * da->bytesPerElement), da->bytesPerElement);
+
+    for (i = hash & mask; ix->entries[i].pos; i = (i + 1) & mask)
+    {
+        if (ix->entries[i].pos == pos + 1)
+        {
+            return i;
+        }
+    }
+
+    return ix->slots;
+}
+
+/**
+ * @brief The function deletes the entry in @p slot and closes the gap it leaves in the probe sequence.
+ *
+ * @param[in] ix   Delete the entry from this index.
+ * @param[in] slot Slot of the entry.
+ */
+static void daIndexErase(struct str_da_index *ix, size_t slot)
+{
+    size_t mask;
+    size_t home;
+    size_t j;
+
+    mask = ix->slots - 1;
+    j = slot;
+
+    for (;;)
+    {
+        j = (j + 1) & mask;
+
+        if (!ix->entries[j].pos)
+        {
+            break;
+        }
+
+        home = ix->entries[j].hash & mask;
+
+        /* The entry stays if its home slot lies cyclically in (slot, j] */
+        if ((slot <= j) ? (slot < home && home <= j) : (slot < home || home <= j))
+        {
+            continue;
+        }
+
+        ix->entries[slot] = ix->entries[j];
+        slot = j;
+    }
+
+    ix->entries[slot].pos = 0;
+    ix->count--;
+}
+
+/**
+ * @brief The function moves all entries at or behind position @p from by @p n positions.
+ *
+ * @param[in] ix     Renumber this index.
+ * @param[in] from   First position that gets moved.
+ * @param[in] n      Number of positions.
+ * @param[in] ahead  1 to add @p n to the positions, 0 to subtract it.
+ */
+static void daIndexShift(struct str_da_index *ix, size_t from, size_t n, int ahead)
+{
+    size_t i;
+
+    for (i = 0; i < ix->slots; i++)
+    {
+        if (ix->entries[i].pos > from)
+        {
+            ix->entries[i].pos = ahead ? ix->entries[i].pos + n : ix->entries[i].pos - n;
+        }
+    }
+}
+
+/**
+ * @brief The function returns whether the index of @p da can answer lookups.
+ *
+ * Lookups only read the index, so concurrent lookups don't race.
+ *
+ * @param[in] da Check the index of this array.
+ *
+ * @returns The function returns 1 if the index is usable and 0 otherwise.
+ */
+static int daIndexUsable(const DaStruct *da)
+{
+    return da->index && da->index->entries;
+}
+
+/**
+ * @brief The function rebuilds a suspended index of @p da from the current elements if it fits into its limit again.
+ *
+ * Only functions that change the array call it, lookups never write to the index.
+ *
+ * @param[in] da Rebuild the index of this array.
+ *
+ * @returns The function returns 1 if the index is usable and 0 otherwise.
+ */
+static int daIndexRebuild(DaStruct *da)
+{
+    size_t i;
+
+    if (!da->index)
+    {
+        return 0;
+    }
+
+    if (!da->index->entries)
+    {
+        if (daIndexResize(da->index, da->used) != 0)
+        {
+            return 0;
+        }
+
+        for (i = 0; i < da->used; i++)
+        {
+            daIndexAdd(da, i);
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief The function looks the @p element up in the index.
+ *
+ * @param[in] da      Search this array.
+ * @param[in] element Search the array for this element.
+ * @param[in] reverse 1 to find the last match, 0 to find the first one.
+ * @param[in] any     1 if any match is good enough.
+ *
+ * @returns The function returns the index of the match or DaStruct#used if there is none.
+ */
+static size_t daIndexLookup(const DaStruct *da, const void *element, int reverse, int any)
+{
+    const struct str_da_index *ix;
+    size_t hash;
+    size_t mask;
+    size_t best;
+    size_t pos;
+    size_t i;
+
+    ix = da->index;
+    mask = ix->slots - 1;
+    hash = daHash(element, da->bytesPerElement);
+    best = da->used;
+
+    for (i = hash & mask; ix->entries[i].pos; i = (i + 1) & mask)
+    {
+        pos = ix->entries[i].pos - 1;
+
+        if (ix->entries[i].hash != hash || memcmp((char *)da->firstAddr + (pos * da->bytesPerElement), element, da->bytesPerElement) != 0)
+        {
+            continue;
+        }
+
+        if (any)
+        {
+            return pos;
+        }
+        else if (best == da->used || (reverse ? pos > best : pos < best))
+        {
+            best = pos;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @brief The function counts the occurences of @p element with the index.
+ *
+ * @param[in] da      Search this array.
+ * @param[in] element Count the elements equal to this one.
+ *
+ * @returns The function returns the number of occurences.
+ */
+static size_t daIndexCount(const DaStruct *da, const void *element)
+{
+    const struct str_da_index *ix;
+    size_t count;
+    size_t hash;
+    size_t mask;
+    size_t i;
+
+    ix = da->index;
+    mask = ix->slots - 1;
+    hash = daHash(element, da->bytesPerElement);
+    count = 0;
+
+    for (i = hash & mask; ix->entries[i].pos; i = (i + 1) & mask)
+    {
+        count += ix->entries[i].hash == hash
+                 && memcmp((char *)da->firstAddr + ((ix->entries[i].pos - 1) * da->bytesPerElement), element, da->bytesPerElement) == 0;
+    }
+
+    return count;
+}
+
+/**
+ * Number of bytes of a Bloom filter block, the size of a common cache line.
+ */
+#define DA_BLOOM_BLOCK 64
+
+/**
+ * @brief The structure holds the Bloom filter of an array.
+ *
+ * The filter consists of blocks of ::DA_BLOOM_BLOCK bytes, the bits of an element all lie in a single block.
+ */
+struct str_da_bloom
+{
+    /**
+     * The bits of the filter or a NULL pointer if the filter is suspended.
+     */
+    unsigned char *bits;
+
+    /**
+     * Number of blocks, always a power of two.
+     */
+    size_t blocks;
+
+    /**
+     * Number of elements the filter was sized for.
+     */
+    size_t capacity;
+
+    /**
+     * Number of filter bits per element.
+     */
+    size_t bitsPerElement;
+
+    /**
+     * Number of bits an element sets.
+     */
+    size_t hashes;
+
+    /**
+     * Byte limit of the filter.
+     */
+    size_t maxBytes;
+
+    /**
+     * Number of elements added since the last rebuild.
+     */
+    size_t elements;
+
+    /**
+     * Number of elements removed or overwritten since the last rebuild.
+     */
+    size_t stale;
+
+    /**
+     * Number of rebuilds.
+     */
+    size_t rebuilds;
+
+    /**
+     * 1 if lookups update the counters below, see daBloomTrack().
+     */
+    int track;
+
+    /**
+     * Number of lookups that consulted the filter.
+     */
+    size_t lookups;
+
+    /**
+     * Number of lookups the filter rejected.
+     */
+    size_t rejected;
+
+    /**
+     * Number of lookups that passed the filter without a match.
+     */
+    size_t falsePositives;
+};
+
+/**
+ * @brief The function returns the number of blocks the filter needs for @p capacity elements.
+ *
+ * @param[in] capacity       Number of elements.
+ * @param[in] bitsPerElement Number of filter bits per element.
+ *
+ * @returns The number of blocks, a power of two, or 0 if the size of the filter overflows.
+ */
+static size_t daBloomBlocks(size_t capacity, size_t bitsPerElement)
+{
+    size_t blocks;
+    size_t needed;
+
+    if (capacity > (size_t)-1 / bitsPerElement)
+    {
+        return 0;
+    }
+
+    needed = (capacity * bitsPerElement + DA_BLOOM_BLOCK * 8 - 1) / (DA_BLOOM_BLOCK * 8);
+
+    for (blocks = 1; blocks < needed; blocks *= 2)
+    {
+        if (blocks > (size_t)-1 / (2 * DA_BLOOM_BLOCK))
+        {
+            return 0;
+        }
+    }
+
+    return blocks;
+}
+
+/**
+ * @brief The function returns the block of @p element and the first bit and the step of its bits within the block.
+ *
+ * @param[in]  bl      The filter.
+ * @param[in]  element The element.
+ * @param[in]  n       Number of bytes of the element.
+ * @param[out] bit     First bit within the block.
+ * @param[out] step    Distance between the bits, always odd so all bits differ.
+ *
+ * @returns The first byte of the block.
+ */
+static unsigned char *daBloomBlock(const struct str_da_bloom *bl, const void *element, size_t n, size_t *bit, size_t *step)
+{
+    size_t hash;
+    size_t mixed;
+
+    hash = daHash(element, n);
+
+    /* The bit positions and the block use different bits of the remixed hash */
+    mixed = hash * 2654435769UL;
+    mixed ^= mixed >> 15;
+    mixed *= 2246822519UL;
+    mixed ^= mixed >> 13;
+    *bit = mixed & (DA_BLOOM_BLOCK * 8 - 1);
+    *step = ((mixed >> 9) & (DA_BLOOM_BLOCK * 8 - 1)) | 1;
+
+    return bl->bits + (((hash ^ (mixed >> 18)) & (bl->blocks - 1)) * DA_BLOOM_BLOCK);
+}
+
+/**
+ * @brief The function adds @p element to the filter.
+ *
+ * @param[in] bl      Add the element to this filter.
+ * @param[in] element The element.
+ * @param[in] n       Number of bytes of the element.
+ */
+static void daBloomAdd(struct str_da_bloom *bl, const void *element, size_t n)
+{
+    unsigned char *block;
+    size_t bit;
+    size_t step;
+    size_t i;
+
+    block = daBloomBlock(bl, element, n, &bit, &step);
+
+    for (i = 0; i < bl->hashes; i++)
+    {
+        block[bit >> 3] |= (unsigned char)(1 << (bit & 7));
+        bit = (bit + step) & (DA_BLOOM_BLOCK * 8 - 1);
+    }
+
+    bl->elements++;
+}
+
+/**
+ * @brief The function returns whether @p element may have been added to the filter.
+ *
+ * @param[in] bl      Check this filter.
+ * @param[in] element The element.
+ * @param[in] n       Number of bytes of the element.
+ *
+ * @returns The function returns 0 if the element definitely wasn't added and 1 otherwise.
+ */
+static int daBloomQuery(const struct str_da_bloom *bl, const void *element, size_t n)
+{
+    const unsigned char *block;
+    size_t bit;
+    size_t step;
+    size_t i;
+    int all;
+
+    block = daBloomBlock(bl, element, n, &bit, &step);
+    all = 1;
+
+    /* No early exit, the bits share a cache line */
+    for (i = 0; i < bl->hashes; i++)
+    {
+        all &= block[bit >> 3] >> (bit & 7);
+        bit = (bit + step) & (DA_BLOOM_BLOCK * 8 - 1);
+    }
+
+    return all & 1;
+}
+
+/**
+ * @brief The function suspends the filter until the next change of the array rebuilds it.
+ *
+ * @param[in] bl Suspend this filter.
+ */
+static void daBloomSuspend(struct str_da_bloom *bl)
+{
+    free(bl->bits);
+    bl->bits = NULL;
+    bl->blocks = 0;
+}
+
+/**
+ * @brief The function rebuilds the filter of @p da from the current elements if necessary.
+ *
+ * The filter gets rebuilt for twice the current elements if it is suspended, half of it is stale or the array
+ * outgrew it. Only functions that change the array call it, lookups never write to the filter.
+ *
+ * @param[in] da Check the filter of this array.
+ *
+ * @returns The function returns 1 if the filter is usable and 0 otherwise.
+ */
+static int daBloomRebuild(DaStruct *da)
+{
+    struct str_da_bloom *bl;
+    size_t blocks;
+    size_t i;
+
+    if (!(bl = da->bloom))
+    {
+        return 0;
+    }
+
+    if (bl->bits && bl->elements <= bl->capacity && (bl->stale == 0 || 2 * bl->stale < bl->elements))
+    {
+        return 1;
+    }
+
+    daBloomSuspend(bl);
+
+    bl->capacity = (da->used < 32) ? 64 : 2 * da->used;
+    blocks = daBloomBlocks(bl->capacity, bl->bitsPerElement);
+
+    if (blocks == 0 || blocks > bl->maxBytes / DA_BLOOM_BLOCK || !(bl->bits = calloc(blocks, DA_BLOOM_BLOCK)))
+    {
+        return 0;
+    }
+
+    bl->blocks = blocks;
+    bl->elements = 0;
+    bl->stale = 0;
+    bl->rebuilds++;
+
+    for (i = 0; i < da->used; i++)
+    {
+        daBloomAdd(bl, (char *)da->firstAddr + (i * da->bytesPerElement), da->bytesPerElement);
+    }
+
+    return 1;
+}
+
+/**
+ * @brief The function asks the filter of @p da whether @p element is missing.
+ *
+ * The lookup counters only get updated if daBloomTrack() enabled them, otherwise the filter is only read.
+ *
+ * @param[in] da      Search this array.
+ * @param[in] element Search the array for this element.
+ *
+ * @returns The function returns 1 if the filter rejects the element and 0 if the array has to be searched.
+ */
+static int daBloomReject(DaStruct *da, const void *element)
+{
+    struct str_da_bloom *bl;
+    int passed;
+
+    if (!(bl = da->bloom) || !bl->bits)
+    {
+        return 0;
+    }
+
+    passed = daBloomQuery(bl, element, da->bytesPerElement);
+
+    if (bl->track)
+    {
+        bl->lookups++;
+        bl->rejected += !passed;
+    }
+
+    return !passed;
+}
+
+/**
+ * @brief The function counts a lookup that passed the filter of @p da without finding the element.
+ *
+ * @param[in] da The searched array.
+ */
+static void daBloomMissed(DaStruct *da)
+{
+    if (da->bloom && da->bloom->bits && da->bloom->track)
+    {
+        da->bloom->falsePositives++;
+    }
+}
+
+/**
+ * @brief The function updates the index and the filter after @p n elements were inserted at @p pos.
+ *
+ * Elements written over others in place are handled like inserted ones without shifting, after daSidecarRemove()
+ * dropped the old ones.
+ *
+ * @param[in] da    The changed array.
+ * @param[in] pos   Position of the first inserted element.
+ * @param[in] n     Number of inserted elements.
+ * @param[in] shift 1 if the elements behind were moved to make room, 0 if the elements were written in place.
+ */
+static void daSidecarInsert(DaStruct *da, size_t pos, size_t n, int shift)
+{
+    struct str_da_index *ix;
+    size_t i;
+
+    if (da->bloom && da->bloom->bits)
+    {
+        for (i = pos; i < pos + n; i++)
+        {
+            daBloomAdd(da->bloom, (char *)da->firstAddr + (i * da->bytesPerElement), da->bytesPerElement);
+        }
+    }
+
+    /* A suspended or outgrown filter gets rebuilt with the inserted elements */
+    if (da->bloom)
+    {
+        daBloomRebuild(da);
+    }
+
+    ix = da->index;
+
+    /* A suspended index gets rebuilt with the inserted elements */
+    if (!ix || !ix->entries)
+    {
+        daIndexRebuild(da);
+        return;
+    }
+
+    if ((ix->count + n > ix->slots / 2) && daIndexResize(ix, ix->count + n) != 0)
+    {
+        return;
+    }
+
+    if (shift && pos + n < da->used)
+    {
+        daIndexShift(ix, pos, n, 1);
+    }
+
+    for (i = pos; i < pos + n; i++)
+    {
+        daIndexAdd(da, i);
+    }
+}
+
+/**
+ * @brief The function updates the index and the filter before @p n elements at @p pos get removed.
+ *
+ * @param[in] da    The array that gets changed.
+ * @param[in] pos   Position of the first element that gets removed.
+ * @param[in] n     Number of elements that get removed.
+ * @param[in] shift 1 if the elements behind move to close the gap, 0 if they keep their positions.
+ */
+static void daSidecarRemove(DaStruct *da, size_t pos, size_t n, int shift)
+{
+    struct str_da_index *ix;
+    size_t slot;
+    size_t i;
+
+    if (da->bloom && daBloomRebuild(da))
+    {
+        da->bloom->stale += n;
+    }
+
+    ix = da->index;
+
+    /* A suspended index gets rebuilt first and updated like an intact one */
+    if (!ix || !daIndexRebuild(da))
+    {
+        return;
+    }
+
+    for (i = pos; i < pos + n; i++)
+    {
+        if ((slot = daIndexSlot(da, i)) == ix->slots)
+        {
+            daIndexSuspend(ix);
+            return;
+        }
+
+        daIndexErase(ix, slot);
+    }
+
+    if (shift && pos + n < da->used)
+    {
+        daIndexShift(ix, pos + n, n, 0);
+    }
+}
+
+/**
+ * @brief The function updates the index and the filter before the element at @p pos gets overwritten by @p element.
+ *
+ * @param[in] da      The array that gets changed.
+ * @param[in] pos     Position of the element that gets overwritten.
+ * @param[in] element The new element.
+ */
+static void daSidecarSet(DaStruct *da, size_t pos, const void *element)
+{
+    struct str_da_index *ix;
+    size_t slot;
+    size_t hash;
+
+    if (da->bloom && daBloomRebuild(da))
+    {
+        da->bloom->stale++;
+        daBloomAdd(da->bloom, element, da->bytesPerElement);
+    }
+
+    ix = da->index;
+
+    if (!ix || !daIndexRebuild(da))
+    {
+        return;
+    }
+
+    hash = daHash(element, da->bytesPerElement);
+
+    if ((slot = daIndexSlot(da, pos)) == ix->slots)
+    {
+        daIndexSuspend(ix);
+    }
+    else if (ix->entries[slot].hash != hash)
+    {
+        daIndexErase(ix, slot);
+
+        for (slot = hash & (ix->slots - 1); ix->entries[slot].pos; slot = (slot + 1) & (ix->slots - 1));
+
+        ix->entries[slot].hash = hash;
+        ix->entries[slot].pos = pos + 1;
+        ix->count++;
+    }
+}
+
+/**
+ * @brief The function updates the index before the element at @p from gets moved to @p to.
+ *
+ * The element at @p to must already be removed from the index.
+ *
+ * @param[in] da   The array that gets changed.
+ * @param[in] from Current position of the element.
+ * @param[in] to   New position of the element.
+ */
+static void daSidecarMove(DaStruct *da, size_t from, size_t to)
+{
+    size_t slot;
+
+    if (!da->index || !da->index->entries)
+    {
+        return;
+    }
+
+    if ((slot = daIndexSlot(da, from)) == da->index->slots)
+    {
+        daIndexSuspend(da->index);
+        return;
+    }
+
+    da->index->entries[slot].pos = to + 1;
+}
+
+/**
+ * @brief The function updates the index and the filter after all elements were removed.
+ *
+ * @param[in] da The cleared array.
+ */
+static void daSidecarClear(DaStruct *da)
+{
+    if (da->bloom && da->bloom->bits)
+    {
+        memset(da->bloom->bits, 0, da->bloom->blocks * DA_BLOOM_BLOCK);
+        da->bloom->elements = 0;
+        da->bloom->stale = 0;
+    }
+    else if (da->bloom)
+    {
+        daBloomRebuild(da);
+    }
+
+    if (!da->index)
+    {
+        return;
+    }
+    else if (!da->index->entries)
+    {
+        daIndexRebuild(da);
+        return;
+    }
+
+    memset(da->index->entries, 0, da->index->slots * sizeof(DaIndexEntry));
+    da->index->count = 0;
+}
+
+/**
+ * @brief The function suspends the index and the filter until the next change of the array rebuilds them.
+ *
+ * @param[in] da The array whose elements are about to be written by the caller.
+ */
+static void daSidecarSuspend(DaStruct *da)
+{
+    if (da->bloom && da->bloom->bits)
+    {
+        daBloomSuspend(da->bloom);
+    }
+
+    if (da->index && da->index->entries)
+    {
+        daIndexSuspend(da->index);
+    }
+}
+
+/**
+ * @brief The function rebuilds the index and the filter from the current elements.
+ *
+ * @param[in] da The array whose elements changed without the index and the filter noticing.
+ */
+static void daSidecarRebuild(DaStruct *da)
+{
+    daSidecarSuspend(da);
+
+    if (da->bloom)
+    {
+        daBloomRebuild(da);
+    }
+
+    if (da->index)
+    {
+        daIndexRebuild(da);
+    }
+}
+
+/**
+ * @brief The function updates the index after the elements changed their positions.
+ *
+ * Renumbering the index would cost more than rebuilding it.
+ * The filter doesn't depend on the positions.
+ *
+ * @param[in] da The reordered array.
+ */
+static void daSidecarReorder(DaStruct *da)
+{
+    if (da->index)
+    {
+        if (da->index->entries)
+        {
+            daIndexSuspend(da->index);
+        }
+
+        daIndexRebuild(da);
+    }
+}
+
+/**
+ * @brief The function updates the index and the filter after @p n elements were removed all over the array.
+ *
+ * @param[in] da The compacted array.
+ * @param[in] n  Number of removed elements.
+ */
+static void daSidecarCompact(DaStruct *da, size_t n)
+{
+    if (n == 0)
+    {
+        return;
+    }
+
+    if (da->bloom)
+    {
+        da->bloom->stale += n;
+        daBloomRebuild(da);
+    }
+
+    daSidecarReorder(da);
+}
+
+/**
+ * @brief The function is executed by every thread of a parallel search.
+ *
+ * @param[in] job The search job.
+ */
+static void daSearchWorker(DaJob *job)
+{
+    DaSearchJob *search;
+    size_t block;
+    size_t from;
+    size_t to;
+    size_t match;
+    int done;
+
+    search = (DaSearchJob *)job;
+
+    while (daJobClaim(job, &block))
+    {
+        if (search->reverse)
+        {
+            block = job->blocks - 1 - block;
+        }
+
+        from = block * search->blockElements;
+        to = from + search->blockElements;
+        to = (to > search->da->used) ? search->da->used : to;
+
+        /* Blocks are handed out in order, so every following block is worse than a known match */
+        daJobLock(job);
+        done = search->best != search->da->used && (search->any || (search->reverse ? to <= search->best : from > search->best));
+        daJobUnlock(job);
+
+        if (done)
+        {
+            break;
+        }
+
+        match = search->reverse ? daScanLast(search->da, search->match, from, to)
+                                : daScanFirst(search->da, search->match, from, to);
+
+        if (match != to)
+        {
+            daJobLock(job);
+            if (search->best == search->da->used || (search->reverse ? match > search->best : match < search->best))
+            {
+                search->best = match;
+            }
+            daJobUnlock(job);
+        }
+    }
+}
+
+/**
+ * @brief The function searches the array for elements matching @p match with up to @p threads threads.
+ *
+ * Searches that compare whole elements consult the Bloom filter first and use the hash index.
+ *
+ * @param[in] da      Search this array.
+ * @param[in] match   Search the array for elements matching this key.
+ * @param[in] threads Maximum number of threads.
+ * @param[in] reverse 1 to find the last match, 0 to find the first one.
+ * @param[in] any     1 if any match is good enough.
+ *
+ * @returns The function returns the index of the match or DaStruct#used if there is none.
+ */
+static size_t daSearch(DaStruct *da, const DaMatch *match, size_t threads, int reverse, int any)
+{
+    DaSearchJob search;
+    size_t found;
+    int whole;
+
+    whole = match->length == da->bytesPerElement && !match->mask;
+
+    if (whole && daBloomReject(da, match->key))
+    {
+        return da->used;
+    }
+
+    if (whole && daIndexUsable(da))
+    {
+        found = daIndexLookup(da, match->key, reverse, any);
+    }
+    else if (threads < 2 || da->used * da->bytesPerElement < DA_PARALLEL_THRESHOLD)
+    {
+        found = reverse ? daScanLast(da, match, 0, da->used) : daScanFirst(da, match, 0, da->used);
+    }
+    else
+    {
+        search.blockElements = DA_PARALLEL_BLOCK / da->bytesPerElement;
+        search.blockElements = (search.blockElements == 0) ? 1 : search.blockElements;
+
+        search.job.run = daSearchWorker;
+        search.job.next = 0;
+        search.job.blocks = (da->used + search.blockElements - 1) / search.blockElements;
+        search.da = da;
+        search.match = match;
+        search.reverse = reverse;
+        search.any = any;
+        search.best = da->used;
+
+        daParallelRun(&search.job, threads);
+        found = search.best;
+    }
+
+    if (whole && found == da->used)
+    {
+        daBloomMissed(da);
+    }
+
+    return found;
+}
+
+/**
+ * @brief The function reallocates the dynamic array to hold @p nrElements elements.
+ *
+ * The array remains unchanged in the event of an error.
+ *
+ * @param[in]  da         The array that should be reallocated.
+ * @param[out] err        Indicates what went wrong in the event of an error.
+ * @param[in]  nrElements New capacity, neither less than DaStruct#used nor exceeding DaStruct#maxBytes.
+ *
+ * @returns Returns 0 on success.
+ * @returns Otherwise, -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device.
+ */
+static int daReallocTo(DaStruct *da, int *err, size_t nrElements)
+{
+    void *newArray;
+
+    newArray = calloc(1, nrElements * da->bytesPerElement);
+
+    if (!newArray)
+    {
+        *err = DA_FATAL | DA_ENOMEM;
+        return -1;
+    }
+
+    memcpy(newArray, da->firstAddr, da->used * da->bytesPerElement);
+
+    free(da->firstAddr);
+
+    da->firstAddr = newArray;
+    da->max = nrElements;
+
+    *err = DA_OK;
+    return 0;
+}
+
+/**
+ * @brief The function reallocates the dynamic array to increase the space.
+ *
+ * The array remains unchanged in the event of an error.
+ *
+ * @param[in]  da  The array that should be reallocated.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ *
+ * @returns Returns 0 on success.
+ * @returns Otherwise, -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device.@n
+ * ::DA_PARAM_ERR | ::DA_EXCEEDS_SIZE_LIMIT if the array can't be increased anymore. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer. @n
+ */
+static int daRealloc(DaStruct *da, int *err)
+{
+    size_t bytes;
+    size_t nrElements;
+
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+
+    bytes = da->max * da->bytesPerElement;
+
+    if (bytes == da->maxBytes)
+    {
+        *err = DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT;
+        return -1;
+    }
+    else if (bytes <= (da->maxBytes / 2))
+    {
+        /* Enough room to double the array space */
+        nrElements = da->max * 2;
+    }
+    else
+    {
+        /* Calculate maximum possible number of elements for this array */
+        nrElements = da->maxBytes / da->bytesPerElement;
+    }
+
+    if (nrElements <= da->max || (nrElements * da->bytesPerElement) > da->maxBytes)
+    {
+        *err = DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT;
+        return -1;
+    }
+
+    return daReallocTo(da, err, nrElements);
+}
+
+/**
+ * @brief The function makes room for @p n more elements.
+ *
+ * The capacity doubles like it does for daAppend() until it fits, but the array gets reallocated at most once.
+ * The content of the array remains unchanged in the event of an error.
+ *
+ * @param[in]  da  The array that needs the room.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  n   Number of additional elements.
+ *
+ * @returns Returns 0 on success.
+ * @returns Otherwise, -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device.@n
+ * ::DA_PARAM_ERR | ::DA_EXCEEDS_SIZE_LIMIT if the array can't hold @p n more elements.
+ */
+static int daReserve(DaStruct *da, int *err, size_t n)
+{
+    size_t limit;
+    size_t nrElements;
+
+    limit = da->maxBytes / da->bytesPerElement;
+
+    if (n > limit - da->used)
+    {
+        *err = DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT;
+        return -1;
+    }
+    else if (da->max - da->used >= n)
+    {
+        *err = DA_OK;
+        return 0;
+    }
+
+    for (nrElements = da->max; nrElements - da->used < n;)
+    {
+        nrElements = (nrElements <= limit / 2) ? nrElements * 2 : limit;
+    }
+
+    return daReallocTo(da, err, nrElements);
+}
+
+DaStruct *daCreate(DaDesc *desc, int *err)
+{
+    DaStruct *da;
+    da = NULL;
+
+    if (!err)
+    {
+        return NULL;
+    }
+    else if (!desc)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return NULL;
+    }
+
+    if (desc->elements == 0 || desc->bytesPerElement == 0 || desc->maxBytes == 0)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return NULL;
+    }
+    else if (desc->elements * desc->bytesPerElement > desc->maxBytes)
+    {
+        *err = DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT;
+        return NULL;
+    }
+
+    da = calloc(1, sizeof(DaStruct));
+
+    if (!da)
+    {
+        goto err;
+    }
+
+    da->magic = DA_MAGIC;
+    da->firstAddr = calloc(1, desc->elements * desc->bytesPerElement);
+
+    if (!da->firstAddr)
+    {
+        goto err;
+    }
+
+    da->used = 0;
+    da->max = desc->elements;
+    da->bytesPerElement = desc->bytesPerElement;
+    da->maxBytes = desc->maxBytes;
+
+    *err = DA_OK;
+    return da;
+
+err:
+
+    if (da)
+    {
+        da->magic = 0;
+        free(da->firstAddr);
+        free(da);
+    }
+
+    *err = DA_FATAL | DA_ENOMEM;
+    return NULL;
+}
+
+DaStruct *daAdopt(DaDesc *desc, int *err, void *buffer, size_t used, size_t capacity)
+{
+    DaStruct *da;
+
+    if (!err)
+    {
+        return NULL;
+    }
+    else if (!desc || !buffer)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return NULL;
+    }
+
+    if (capacity == 0 || desc->bytesPerElement == 0 || desc->maxBytes == 0)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return NULL;
+    }
+    else if (used > capacity)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return NULL;
+    }
+    else if (capacity > desc->maxBytes / desc->bytesPerElement)
+    {
+        *err = DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT;
+        return NULL;
+    }
+
+    da = calloc(1, sizeof(DaStruct));
+
+    if (!da)
+    {
+        *err = DA_FATAL | DA_ENOMEM;
+        return NULL;
+    }
+
+    da->magic = DA_MAGIC;
+    da->firstAddr = buffer;
+    da->used = used;
+    da->max = capacity;
+    da->bytesPerElement = desc->bytesPerElement;
+    da->maxBytes = desc->maxBytes;
+
+    *err = DA_OK;
+    return da;
+}
+
+/**
+ * @brief The function frees the header of an array, including its hash index and Bloom filter, but not the elements.
+ *
+ * @param[in] da The array whose header should be freed.
+ */
+static void daFreeHeader(DaStruct *da)
+{
+    if (da->index)
+    {
+        free(da->index->entries);
+        free(da->index);
+    }
+
+    if (da->bloom)
+    {
+        free(da->bloom->bits);
+        free(da->bloom);
+    }
+
+    da->magic = 0;
+    free(da);
+}
+
+int daDestroy(DaStruct *da, int *err)
+{
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+
+    memset(da->firstAddr, '0', da->max * da->bytesPerElement);
+    free(da->firstAddr);
+    daFreeHeader(da);
+
+    *err = DA_OK;
+    return 0;
+}
+
+void *daDetach(DaStruct *da, int *err, size_t *used, size_t *capacity)
+{
+    void *buffer;
+
+    if (paramNotValid(da, err))
+    {
+        return NULL;
+    }
+    else if (!used)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return NULL;
+    }
+
+    buffer = da->firstAddr;
+    *used = da->used;
+
+    if (capacity)
+    {
+        *capacity = da->max;
+    }
+
+    daFreeHeader(da);
+
+    *err = DA_OK;
+    return buffer;
+}
+
+
+size_t daSize(DaStruct *da, int *err)
+{
+    if (paramNotValid(da, err))
+    {
+        return 0;
+    }
+
+    *err = DA_OK;
+    return da->used;
+}
+
+
+int daIsEmpty(DaStruct *da, int *err)
+{
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+
+    *err = DA_OK;
+    return (da->used > 0) ? 0 : 1;
+}
+
+void *daGet(DaStruct *da, int *err, size_t pos)
+{
+    if (paramNotValid(da, err))
+    {
+        return NULL;
+    }
+
+    if (pos >= da->used)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return NULL;
+    }
+
+    *err = DA_OK;
+    return ((char *)da->firstAddr + (pos * da->bytesPerElement));
+}
+
+void *daGetFirst(DaStruct *da, int *err)
+{
+    if (paramNotValid(da, err))
+    {
+        return NULL;
+    }
+
+    if (da->used == 0)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return NULL;
+    }
+
+    *err = DA_OK;
+    return da->firstAddr;
+}
+
+void *daGetLast(DaStruct *da, int *err)
+{
+    if (paramNotValid(da, err))
+    {
+        return NULL;
+    }
+
+    if (da->used == 0)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return NULL;
+    }
+
+    *err = DA_OK;
+    return ((char *)da->firstAddr + ((da->used - 1) * da->bytesPerElement));
+}
+
+int daClear(DaStruct *da, int *err, int mode)
+{
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+
+    switch (mode)
+    {
+    case DA_FAST:
+        break;
+
+    case DA_SECURE:
+        memset(da->firstAddr, '0', da->used * da->bytesPerElement);
+        break;
+
+    default:
+        *err = (DA_PARAM_ERR | DA_UNKNOWN_MODE);
+        return -1;
+        break;
+    }
+
+    da->used = 0;
+    daSidecarClear(da);
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daContains(DaStruct *da, int *err, const void *element)
+{
+    return daContainsParallel(da, err, element, 1);
+}
+
+int daContainsParallel(DaStruct *da, int *err, const void *element, size_t threads)
+{
+    DaMatch match;
+
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (!element)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    daMatchInit(&match, element, 0, da->bytesPerElement, NULL);
+
+    if (daSearch(da, &match, threads, 0, 1) == da->used)
+    {
+        *err = DA_NOT_FOUND;
+        return 0;
+    }
+
+    *err = DA_OK;
+    return 1;
+}
+
+void *daSet(DaStruct *da, int *err, const void *element, size_t pos)
+{
+    if (paramNotValid(da, err))
+    {
+        return NULL;
+    }
+    else if (!element)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return NULL;
+    }
+
+    if (pos >= da->used)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return NULL;
+    }
+
+    daSidecarSet(da, pos, element);
+
+    return memcpy((char *)da->firstAddr + (pos * da->bytesPerElement), element, da->bytesPerElement);
+}
+
+void *daSetRange(DaStruct *da, int *err, size_t pos, const void *src, size_t n)
+{
+    char *dst;
+
+    if (paramNotValid(da, err))
+    {
+        return NULL;
+    }
+    else if (!src)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return NULL;
+    }
+
+    if (pos > da->used || n > da->used - pos)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return NULL;
+    }
+
+    dst = (char *)da->firstAddr + (pos * da->bytesPerElement);
+
+    /* The old elements leave the index and the filter before they get overwritten, the new ones join afterwards */
+    daSidecarRemove(da, pos, n, 0);
+
+    /* The source may overlap the range */
+    memmove(dst, src, n * da->bytesPerElement);
+
+    daSidecarInsert(da, pos, n, 0);
+
+    *err = DA_OK;
+    return dst;
+}
+
+/**
+ * @brief The function fills @p n elements at @p dst with copies of @p element.
+ *
+ * @param[in] dst     First element.
+ * @param[in] element The element, it may be one of the @p n elements.
+ * @param[in] n       Number of elements.
+ * @param[in] stride  Size of an element.
+ */
+static void daReplicate(char *dst, const void *element, size_t n, size_t stride)
+{
+    size_t done;
+    size_t chunk;
+
+    if (n == 0)
+    {
+        return;
+    }
+    else if (stride == 1)
+    {
+        memset(dst, *(const unsigned char *)element, n);
+        return;
+    }
+
+    memmove(dst, element, stride);
+
+    for (done = 1; done < n; done += chunk)
+    {
+        chunk = (n - done < done) ? n - done : done;
+        memcpy(dst + (done * stride), dst, chunk * stride);
+    }
+}
+
+void *daFill(DaStruct *da, int *err, size_t from, size_t to, const void *element)
+{
+    char *dst;
+
+    if (paramNotValid(da, err))
+    {
+        return NULL;
+    }
+    else if (!element)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return NULL;
+    }
+
+    if (from > to || to >= da->used)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return NULL;
+    }
+
+    daSidecarRemove(da, from, to - from + 1, 0);
+
+    dst = (char *)da->firstAddr + (from * da->bytesPerElement);
+    daReplicate(dst, element, to - from + 1, da->bytesPerElement);
+
+    daSidecarInsert(da, from, to - from + 1, 0);
+
+    *err = DA_OK;
+    return dst;
+}
+
+int daResize(DaStruct *da, int *err, size_t n, const void *element)
+{
+    size_t offset;
+    size_t used;
+    int inside;
+
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+
+    *err = DA_OK;
+
+    if (n < da->used)
+    {
+        daSidecarRemove(da, n, da->used - n, 1);
+        da->used = n;
+        return 0;
+    }
+    else if (n == da->used)
+    {
+        return 0;
+    }
+
+    /* The element may move with the array */
+    inside = element && (const char *)element >= (char *)da->firstAddr &&
+             (const char *)element < (char *)da->firstAddr + (da->used * da->bytesPerElement);
+    offset = inside ? (size_t)((const char *)element - (char *)da->firstAddr) : 0;
+
+    if (daReserve(da, err, n - da->used) != 0)
+    {
+        return -1;
+    }
+
+    if (element)
+    {
+        daReplicate((char *)da->firstAddr + (da->used * da->bytesPerElement), inside ? (char *)da->firstAddr + offset : element,
+                    n - da->used, da->bytesPerElement);
+    }
+    else
+    {
+        memset((char *)da->firstAddr + (da->used * da->bytesPerElement), 0, (n - da->used) * da->bytesPerElement);
+    }
+
+    used = da->used;
+    da->used = n;
+    daSidecarInsert(da, used, n - used, 1);
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daIndexOf(DaStruct *da, int *err, const void *element, size_t *index)
+{
+    return daIndexOfParallel(da, err, element, index, 1);
+}
+
+int daIndexOfParallel(DaStruct *da, int *err, const void *element, size_t *index, size_t threads)
+{
+    DaMatch match;
+    size_t i;
+
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (!element || !index)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    daMatchInit(&match, element, 0, da->bytesPerElement, NULL);
+
+    if ((i = daSearch(da, &match, threads, 0, 0)) == da->used)
+    {
+        *err = DA_NOT_FOUND;
+        return 0;
+    }
+
+    *index = i;
+    *err = DA_OK;
+    return 1;
+}
+
+int daIndexOfMany(DaStruct *da, int *err, const void *keys, size_t n, size_t *indexes)
+{
+    size_t *slots;
+    size_t *next;
+    size_t nrSlots;
+    size_t missing;
+    size_t hash;
+    size_t mask;
+    size_t i;
+    size_t j;
+    size_t k;
+    const char *cur;
+    const char *key;
+
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (!keys || !indexes)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    for (k = 0; k < n; k++)
+    {
+        indexes[k] = DA_NPOS;
+    }
+
+    missing = n;
+    key = keys;
+    cur = da->firstAddr;
+
+    if (daIndexUsable(da))
+    {
+        for (k = 0; k < n; k++, key += da->bytesPerElement)
+        {
+            if ((i = daIndexLookup(da, key, 0, 0)) != da->used)
+            {
+                indexes[k] = i;
+                missing--;
+            }
+        }
+    }
+    else if (n <= DA_FEW_KEYS)
+    {
+        for (i = 0; i < da->used && missing > 0; i++, cur += da->bytesPerElement)
+        {
+            for (k = 0, key = keys; k < n; k++, key += da->bytesPerElement)
+            {
+                if (indexes[k] == DA_NPOS && memcmp(cur, key, da->bytesPerElement) == 0)
+                {
+                    indexes[k] = i;
+                    missing--;
+                }
+            }
+        }
+    }
+    else
+    {
+        /* Hash table of the keys, a duplicate takes over the slot and chains the earlier occurences behind it */
+        nrSlots = daIndexSlots(n);
+        mask = nrSlots - 1;
+        slots = calloc(nrSlots, sizeof(size_t));
+        next = malloc(n * sizeof(size_t));
+
+        if (!slots || !next)
+        {
+            free(slots);
+            free(next);
+            *err = DA_FATAL | DA_ENOMEM;
+            return -1;
+        }
+
+        for (k = 0; k < n; k++, key += da->bytesPerElement)
+        {
+            next[k] = DA_NPOS;
+
+            for (j = daHash(key, da->bytesPerElement) & mask; slots[j]; j = (j + 1) & mask)
+            {
+                if (memcmp((const char *)keys + ((slots[j] - 1) * da->bytesPerElement), key, da->bytesPerElement) == 0)
+                {
+                    break;
+                }
+            }
+
+            /* Every occurence gets the same index, so prepending keeps the chain correct in O(1) */
+            if (slots[j])
+            {
+                next[k] = slots[j] - 1;
+            }
+
+            slots[j] = k + 1;
+        }
+
+        for (i = 0; i < da->used && missing > 0; i++, cur += da->bytesPerElement)
+        {
+            hash = daHash(cur, da->bytesPerElement);
+
+            for (j = hash & mask; slots[j]; j = (j + 1) & mask)
+            {
+                k = slots[j] - 1;
+
+                if (memcmp((const char *)keys + (k * da->bytesPerElement), cur, da->bytesPerElement) == 0)
+                {
+                    for (; k != DA_NPOS && indexes[k] == DA_NPOS; k = next[k])
+                    {
+                        indexes[k] = i;
+                        missing--;
+                    }
+
+                    break;
+                }
+            }
+        }
+
+        free(slots);
+        free(next);
+    }
+
+    if (missing > 0)
+    {
+        *err = DA_NOT_FOUND;
+        return 0;
+    }
+
+    *err = DA_OK;
+    return 1;
+}
+
+int daCount(DaStruct *da, int *err, const void *element, size_t *count)
+{
+    DaMatch match;
+    unsigned long bits;
+    size_t n;
+    size_t i;
+
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (!element || !count)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    *count = 0;
+    *err = DA_OK;
+
+    if (daBloomReject(da, element))
+    {
+        return 0;
+    }
+
+    if (daIndexUsable(da))
+    {
+        *count = daIndexCount(da, element);
+    }
+    else
+    {
+        daMatchInit(&match, element, 0, da->bytesPerElement, NULL);
+
+        for (i = 0; i < da->used; i += n)
+        {
+            n = (da->used - i < DA_MASK_BITS) ? da->used - i : DA_MASK_BITS;
+
+            for (bits = daScanMask(da, &match, i, n); bits; bits &= bits - 1)
+            {
+                (*count)++;
+            }
+        }
+    }
+
+    if (*count == 0)
+    {
+        daBloomMissed(da);
+    }
+
+    return 0;
+}
+
+int daFindAll(DaStruct *da, int *err, const void *element, DaStruct *out)
+{
+    DaMatch match;
+    size_t found[DA_MASK_BITS];
+    unsigned long bits;
+    size_t n;
+    size_t i;
+    size_t j;
+    size_t k;
+
+    if (paramNotValid(da, err) || paramNotValid(out, err))
+    {
+        return -1;
+    }
+    else if (!element)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+    else if (out == da || out->bytesPerElement != sizeof(size_t))
+    {
+        *err = DA_PARAM_ERR | DA_INCOMPATIBLE;
+        return -1;
+    }
+
+    out->used = 0;
+    daSidecarClear(out);
+    *err = DA_OK;
+
+    if (daBloomReject(da, element))
+    {
+        return 0;
+    }
+
+    daMatchInit(&match, element, 0, da->bytesPerElement, NULL);
+
+    for (i = 0; i < da->used; i += n)
+    {
+        n = (da->used - i < DA_MASK_BITS) ? da->used - i : DA_MASK_BITS;
+
+        if (!(bits = daScanMask(da, &match, i, n)))
+        {
+            continue;
+        }
+
+        /* Every index gets written, only the matching ones advance the output */
+        for (j = 0, k = 0; j < n; j++)
+        {
+            found[k] = i + j;
+            k += (bits >> j) & 1;
+        }
+
+        if (daReserve(out, err, k) != 0)
+        {
+            out->used = 0;
+            daSidecarClear(out);
+            return -1;
+        }
+
+        memcpy((char *)out->firstAddr + (out->used * sizeof(size_t)), found, k * sizeof(size_t));
+        out->used += k;
+        daSidecarInsert(out, out->used - k, k, 1);
+    }
+
+    if (out->used == 0)
+    {
+        daBloomMissed(da);
+    }
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daLastIndexOf(DaStruct *da, int *err, const void *element, size_t *index)
+{
+    return daLastIndexOfParallel(da, err, element, index, 1);
+}
+
+int daLastIndexOfParallel(DaStruct *da, int *err, const void *element, size_t *index, size_t threads)
+{
+    DaMatch match;
+    size_t i;
+
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (!element || !index)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    daMatchInit(&match, element, 0, da->bytesPerElement, NULL);
+
+    if ((i = daSearch(da, &match, threads, 1, 0)) == da->used)
+    {
+        *err = DA_NOT_FOUND;
+        return 0;
+    }
+
+    *index = i;
+    *err = DA_OK;
+    return 1;
+}
+
+/**
+ * @brief The function checks the parameters of the functions searching for a key within the elements.
+ *
+ * @param[in]  da     The searched array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  key    The searched key.
+ * @param[in]  offset Offset of the key within each element.
+ * @param[in]  length Length of the key.
+ *
+ * @returns The function returns 0 if the parameters are valid and -1 otherwise.
+ */
+static int daKeyNotValid(const DaStruct *da, int *err, const void *key, size_t offset, size_t length)
+{
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (!key)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+    else if (length == 0 || offset >= da->bytesPerElement || length > da->bytesPerElement - offset)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return -1;
+    }
+
+    return 0;
+}
+
+int daContainsKey(DaStruct *da, int *err, const void *key, size_t offset, size_t length, const void *mask)
+{
+    DaMatch match;
+
+    if (daKeyNotValid(da, err, key, offset, length))
+    {
+        return -1;
+    }
+
+    daMatchInit(&match, key, offset, length, mask);
+
+    if (daSearch(da, &match, 1, 0, 1) == da->used)
+    {
+        *err = DA_NOT_FOUND;
+        return 0;
+    }
+
+    *err = DA_OK;
+    return 1;
+}
+
+int daIndexOfKey(DaStruct *da, int *err, const void *key, size_t offset, size_t length, const void *mask, size_t *index)
+{
+    DaMatch match;
+    size_t i;
+
+    if (daKeyNotValid(da, err, key, offset, length))
+    {
+        return -1;
+    }
+    else if (!index)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    daMatchInit(&match, key, offset, length, mask);
+
+    if ((i = daSearch(da, &match, 1, 0, 0)) == da->used)
+    {
+        *err = DA_NOT_FOUND;
+        return 0;
+    }
+
+    *index = i;
+    *err = DA_OK;
+    return 1;
+}
+
+int daLastIndexOfKey(DaStruct *da, int *err, const void *key, size_t offset, size_t length, const void *mask, size_t *index)
+{
+    DaMatch match;
+    size_t i;
+
+    if (daKeyNotValid(da, err, key, offset, length))
+    {
+        return -1;
+    }
+    else if (!index)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    daMatchInit(&match, key, offset, length, mask);
+
+    if ((i = daSearch(da, &match, 1, 1, 0)) == da->used)
+    {
+        *err = DA_NOT_FOUND;
+        return 0;
+    }
+
+    *index = i;
+    *err = DA_OK;
+    return 1;
+}
+
+/**
+ * The element @p p of the sequence searched by daSequenceKmp(), counted from its end for a reverse search.
+ */
+#define DA_SEQUENCE(p) (sequence + ((reverse ? n - 1 - (p) : (p)) * stride))
+
+/**
+ * @brief The function searches the array for the @p n elements of @p sequence with a Knuth-Morris-Pratt automaton.
+ *
+ * @param[in]  da       Search this array.
+ * @param[in]  sequence The elements to search for.
+ * @param[in]  n        Number of elements of the @p sequence.
+ * @param[in]  bound    First possible start of a match or, for a reverse search, the element behind the last possible end.
+ * @param[in]  reverse  1 to search for the last occurence, 0 to search for the first one.
+ * @param[out] index    Receives the index of the occurence or DaStruct#used if there is none.
+ *
+ * @returns The function returns 0 on success and -1 if the automaton couldn't be allocated.
+ */
+static int daSequenceKmp(const DaStruct *da, const char *sequence, size_t n, size_t bound, int reverse, size_t *index)
+{
+    const char *base;
+    const char *element;
+    size_t *fail;
+    size_t stride;
+    size_t count;
+    size_t p;
+    size_t k;
+    size_t j;
+
+    if (!(fail = malloc(n * sizeof(size_t))))
+    {
+        return -1;
+    }
+
+    base = da->firstAddr;
+    stride = da->bytesPerElement;
+
+    /* fail[p] is the length of the longest proper border of the first p + 1 elements */
+    fail[0] = 0;
+    for (p = 1, k = 0; p < n; p++)
+    {
+        while (k > 0 && memcmp(DA_SEQUENCE(p), DA_SEQUENCE(k), stride) != 0)
+        {
+            k = fail[k - 1];
+        }
+
+        k += (memcmp(DA_SEQUENCE(p), DA_SEQUENCE(k), stride) == 0);
+        fail[p] = k;
+    }
+
+    *index = da->used;
+    count = reverse ? bound : da->used - bound;
+
+    for (j = 0, k = 0; j < count; j++)
+    {
+        element = base + ((reverse ? bound - 1 - j : bound + j) * stride);
+
+        while (k > 0 && memcmp(element, DA_SEQUENCE(k), stride) != 0)
+        {
+            k = fail[k - 1];
+        }
+
+        if (memcmp(element, DA_SEQUENCE(k), stride) == 0 && ++k == n)
+        {
+            *index = reverse ? bound - 1 - j : bound + j - (n - 1);
+            break;
+        }
+    }
+
+    free(fail);
+    return 0;
+}
+
+/**
+ * @brief The function searches the array for the first or last occurence of the @p n elements of @p sequence.
+ *
+ * Candidates get found by scanning for the element at the start of the search direction, their opposite end gets
+ * compared before the rest. Once the compared elements outweigh twice the passed positions, daSequenceKmp() takes over.
+ *
+ * @param[in] da       Search this array.
+ * @param[in] sequence The elements to search for.
+ * @param[in] n        Number of elements of the @p sequence, at least 2 and at most DaStruct#used.
+ * @param[in] reverse  1 to search for the last occurence, 0 to search for the first one.
+ *
+ * @returns The function returns the index of the occurence or DaStruct#used if there is none.
+ */
+static size_t daSequenceSearch(const DaStruct *da, const char *sequence, size_t n, int reverse)
+{
+    DaMatch match;
+    const char *base;
+    const char *opposite;
+    size_t stride;
+    size_t first;
+    size_t last;
+    size_t start;
+    size_t work;
+    size_t index;
+
+    base = da->firstAddr;
+    stride = da->bytesPerElement;
+
+    /* Possible starts of a match */
+    first = 0;
+    last = da->used - n;
+    work = 0;
+
+    daMatchInit(&match, reverse ? sequence + ((n - 1) * stride) : sequence, 0, stride, NULL);
+    opposite = reverse ? sequence : sequence + ((n - 1) * stride);
+
+    for (;;)
+    {
+        if (reverse)
+        {
+            if ((start = daScanLast(da, &match, first + n - 1, last + n)) == last + n)
+            {
+                break;
+            }
+
+            start -= n - 1;
+        }
+        else if ((start = daScanFirst(da, &match, first, last + 1)) == last + 1)
+        {
+            break;
+        }
+
+        if (memcmp(base + (reverse ? start : start + n - 1) * stride, opposite, stride) == 0)
+        {
+            if (memcmp(base + (start * stride), sequence, n * stride) == 0)
+            {
+                return start;
+            }
+
+            work += n;
+        }
+
+        work++;
+
+        if (reverse ? start == first : start == last)
+        {
+            break;
+        }
+        else if (work > 2 * (reverse ? da->used - n - start : start) + n &&
+                 daSequenceKmp(da, sequence, n, reverse ? start + n - 1 : start + 1, reverse, &index) == 0)
+        {
+            return index;
+        }
+
+        if (reverse)
+        {
+            last = start - 1;
+        }
+        else
+        {
+            first = start + 1;
+        }
+    }
+
+    return da->used;
+}
+
+/**
+ * @brief The function implements daIndexOfSequence() and daLastIndexOfSequence().
+ *
+ * @param[in]  da       Search this array.
+ * @param[out] err      Indicates what went wrong in the event of an error.
+ * @param[in]  sequence The elements to search for.
+ * @param[in]  n        Number of elements of the @p sequence.
+ * @param[out] index    Index of the first element of the occurence (0 based).
+ * @param[in]  reverse  1 to search for the last occurence, 0 to search for the first one.
+ *
+ * @returns Returns 1 if the array contains the @p sequence, 0 if it doesn't and -1 in the event of an error.
+ */
+static int daIndexOfSequenceDir(DaStruct *da, int *err, const void *sequence, size_t n, size_t *index, int reverse)
+{
+    DaMatch match;
+    size_t i;
+
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (!sequence || !index)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+    else if (n == 0)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return -1;
+    }
+
+    if (n > da->used)
+    {
+        i = da->used;
+    }
+    else if (n == 1)
+    {
+        /* A single element may use the index and the filter */
+        daMatchInit(&match, sequence, 0, da->bytesPerElement, NULL);
+        i = daSearch(da, &match, 1, reverse, 0);
+    }
+    else
+    {
+        i = daSequenceSearch(da, sequence, n, reverse);
+    }
+
+    if (i == da->used)
+    {
+        *err = DA_NOT_FOUND;
+        return 0;
+    }
+
+    *index = i;
+    *err = DA_OK;
+    return 1;
+}
+
+int daIndexOfSequence(DaStruct *da, int *err, const void *sequence, size_t n, size_t *index)
+{
+    return daIndexOfSequenceDir(da, err, sequence, n, index, 0);
+}
+
+int daLastIndexOfSequence(DaStruct *da, int *err, const void *sequence, size_t n, size_t *index)
+{
+    return daIndexOfSequenceDir(da, err, sequence, n, index, 1);
+}
+
+/**
+ * @brief The function returns the width of the key type @p type.
+ *
+ * @param[in] type One of ::DA_KEY_U8 to ::DA_KEY_F64.
+ *
+ * @returns The function returns the number of bytes of the key or 0 if @p type is unknown.
+ */
+static size_t daKeyWidth(int type)
+{
+    size_t width;
+
+    width = (size_t)(type & 0xff);
+
+    switch (type & ~0xff)
+    {
+    case DA_KEY_UNSIGNED:
+    case DA_KEY_SIGNED:
+        return (width == 1 || width == 2 || width == 4 || width == 8) ? width : 0;
+
+    case DA_KEY_FLOAT:
+        return (width == 4 || width == 8) ? width : 0;
+
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief The function returns whether the host stores integers with the least significant byte first.
+ *
+ * @returns The function returns 1 on little endian hosts and 0 otherwise.
+ */
+static int daLittleEndian(void)
+{
+    unsigned int one;
+
+    one = 1;
+    return *(unsigned char *)&one == 1;
+}
+
+/**
+ * @brief The function converts a key into bytes whose lexicographic order equals the numeric order of the keys.
+ *
+ * The bytes get stored most significant first, the sign bit of signed keys gets flipped and
+ * negative floating point keys get inverted completely.
+ *
+ * @param[in]  type Type of the key.
+ * @param[in]  src  The key in host byte order.
+ * @param[out] dst  Receives the width of the key in bytes.
+ */
+static void daKeyBytes(int type, const void *src, unsigned char *dst)
+{
+    const unsigned char *key;
+    size_t width;
+    size_t i;
+    int little;
+
+    key = src;
+    width = daKeyWidth(type);
+    little = daLittleEndian();
+
+    for (i = 0; i < width; i++)
+    {
+        dst[i] = little ? key[width - 1 - i] : key[i];
+    }
+
+    if ((type & ~0xff) == DA_KEY_SIGNED || ((type & ~0xff) == DA_KEY_FLOAT && !(dst[0] & 0x80)))
+    {
+        dst[0] ^= 0x80;
+    }
+    else if ((type & ~0xff) == DA_KEY_FLOAT)
+    {
+        for (i = 0; i < width; i++)
+        {
+            dst[i] = (unsigned char)~dst[i];
+        }
+    }
+}
+
+/**
+ * @brief The function compares two keys of the type @p type.
+ *
+ * @param[in] type Type of the keys.
+ * @param[in] a    First key.
+ * @param[in] b    Second key.
+ *
+ * @returns The function returns a negative value, zero or a positive value if @p a is less than, equal to or greater than @p b.
+ */
+static int daKeyCompare(int type, const void *a, const void *b)
+{
+    unsigned char bytesA[8];
+    unsigned char bytesB[8];
+
+    daKeyBytes(type, a, bytesA);
+    daKeyBytes(type, b, bytesB);
+
+    return memcmp(bytesA, bytesB, daKeyWidth(type));
+}
+
+/**
+ * @brief The function checks the parameters of the functions working on a typed key field.
+ *
+ * @param[in]  da     The array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  type   Type of the key field.
+ * @param[in]  offset Offset of the key field within each element.
+ *
+ * @returns The function returns 0 if the parameters are valid and -1 otherwise.
+ */
+static int daTypeNotValid(const DaStruct *da, int *err, int type, size_t offset)
+{
+    size_t width;
+
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+
+    if ((width = daKeyWidth(type)) == 0)
+    {
+        *err = DA_PARAM_ERR | DA_UNKNOWN_MODE;
+        return -1;
+    }
+    else if (offset >= da->bytesPerElement || width > da->bytesPerElement - offset)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * Converts the key field @p v of the unsigned type @p UT into an unsigned integer of the same order,
+ * @p flip and @p all depend on the key kind.
+ */
+#define DA_KEY_ORDER(UT, v) ((UT)((v) ^ (((UT)((UT)0 - (UT)((v) >> (sizeof(UT) * 8 - 1))) & all) | flip)))
+
+/**
+ * The branchless search loop of daBound() for keys of the width of the unsigned type @p UT.
+ */
+#define DA_BOUND_TYPED(UT) \
+    { \
+        UT value; \
+        UT keyValue; \
+        UT flip; \
+        UT all; \
+        \
+        flip = (UT)(kind == DA_KEY_UNSIGNED ? 0 : (UT)1 << (sizeof(UT) * 8 - 1)); \
+        all = (UT)(kind == DA_KEY_FLOAT ? ~(UT)0 : 0); \
+        memcpy(&keyValue, key, sizeof(UT)); \
+        keyValue = DA_KEY_ORDER(UT, keyValue); \
+        \
+        while (n > 1) \
+        { \
+            half = n / 2; \
+            \
+            if (prefetch) \
+            { \
+                DA_PREFETCH(base + ((first + half / 2) * bytesPerElement)); \
+                DA_PREFETCH(base + ((first + half + half / 2) * bytesPerElement)); \
+            } \
+            \
+            memcpy(&value, base + ((first + half) * bytesPerElement), sizeof(UT)); \
+            value = DA_KEY_ORDER(UT, value); \
+            first += ((value < keyValue) | (upper & (value == keyValue))) ? half : 0; \
+            n -= half; \
+        } \
+        \
+        memcpy(&value, base + (first * bytesPerElement), sizeof(UT)); \
+        value = DA_KEY_ORDER(UT, value); \
+        return first + ((value < keyValue) | (upper & (value == keyValue))); \
+    }
+
+/**
+ * @brief The function returns the lower or upper bound of the @p key in the sorted array.
+ *
+ * The search halves the range without branching on the comparison results, so the loop only depends on
+ * the array size. Arrays exceeding ::DA_PREFETCH_THRESHOLD bytes get both possible next probes prefetched.
+ *
+ * @param[in] da     Search this array.
+ * @param[in] key    Search the array for this key.
+ * @param[in] cmp    Compares the @p key with an element or a NULL pointer to compare the typed key field.
+ * @param[in] type   Type of the key field if @p cmp is a NULL pointer.
+ * @param[in] offset Offset of the key field if @p cmp is a NULL pointer.
+ * @param[in] upper  1 for the upper bound, 0 for the lower bound.
+ *
+ * @returns The function returns the index of the bound.
+ */
+static size_t daBound(const DaStruct *da, const void *key, DaCompare cmp, int type, size_t offset, int upper)
+{
+    const char *base;
+    size_t first;
+    size_t bytesPerElement;
+    size_t width;
+    size_t half;
+    size_t n;
+    int prefetch;
+    int kind;
+    int c;
+
+    n = da->used;
+    first = 0;
+
+    if (n == 0)
+    {
+        return 0;
+    }
+
+    bytesPerElement = da->bytesPerElement;
+    base = (const char *)da->firstAddr + (cmp ? 0 : offset);
+    prefetch = n * bytesPerElement > DA_PREFETCH_THRESHOLD;
+    width = cmp ? 0 : daKeyWidth(type);
+    kind = type & ~0xff;
+
+    if (cmp)
+    {
+        while (n > 1)
+        {
+            half = n / 2;
+
+            if (prefetch)
+            {
+                DA_PREFETCH(base + ((first + half / 2) * bytesPerElement));
+                DA_PREFETCH(base + ((first + half + half / 2) * bytesPerElement));
+            }
+
+            c = cmp(key, base + ((first + half) * bytesPerElement));
+            first = (c > 0 || (upper && c == 0)) ? first + half : first;
+            n -= half;
+        }
+
+        c = cmp(key, base + (first * bytesPerElement));
+        return first + (c > 0 || (upper && c == 0));
+    }
+
+    switch (width)
+    {
+    case 1:
+        DA_BOUND_TYPED(unsigned char)
+
+    case 2:
+        if (sizeof(unsigned short) == 2)
+        DA_BOUND_TYPED(unsigned short)
+        break;
+
+    case 4:
+        if (sizeof(unsigned int) == 4)
+        DA_BOUND_TYPED(unsigned int)
+        break;
+
+    default:
+        if (sizeof(unsigned long) == 8)
+        DA_BOUND_TYPED(unsigned long)
+        break;
+    }
+
+    /* No unsigned integer of the key width */
+    while (n > 1)
+    {
+        half = n / 2;
+        c = daKeyCompare(type, key, base + ((first + half) * bytesPerElement));
+        first = (c > 0 || (upper && c == 0)) ? first + half : first;
+        n -= half;
+    }
+
+    c = daKeyCompare(type, key, base + (first * bytesPerElement));
+    return first + (c > 0 || (upper && c == 0));
+}
+
+int daLowerBound(DaStruct *da, int *err, const void *key, DaCompare cmp, size_t *index)
+{
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (!key || !cmp || !index)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    *index = daBound(da, key, cmp, 0, 0, 0);
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daUpperBound(DaStruct *da, int *err, const void *key, DaCompare cmp, size_t *index)
+{
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (!key || !cmp || !index)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    *index = daBound(da, key, cmp, 0, 0, 1);
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daBinarySearch(DaStruct *da, int *err, const void *key, DaCompare cmp, size_t *index)
+{
+    if (daLowerBound(da, err, key, cmp, index) != 0)
+    {
+        return -1;
+    }
+
+    if (*index == da->used || cmp(key, (char *)da->firstAddr + (*index * da->bytesPerElement)) != 0)
+    {
+        *err = DA_NOT_FOUND;
+        return 0;
+    }
+
+    *err = DA_OK;
+    return 1;
+}
+
+int daEqualRange(DaStruct *da, int *err, const void *key, DaCompare cmp, size_t *first, size_t *last)
+{
+    if (!last)
+    {
+        if (!paramNotValid(da, err))
+        {
+            *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        }
+
+        return -1;
+    }
+
+    if (daLowerBound(da, err, key, cmp, first) != 0)
+    {
+        return -1;
+    }
+
+    *last = daBound(da, key, cmp, 0, 0, 1);
+
+    if (*first == *last)
+    {
+        *err = DA_NOT_FOUND;
+        return 0;
+    }
+
+    *err = DA_OK;
+    return 1;
+}
+
+int daLowerBoundKey(DaStruct *da, int *err, const void *key, int type, size_t offset, size_t *index)
+{
+    if (daTypeNotValid(da, err, type, offset))
+    {
+        return -1;
+    }
+    else if (!key || !index)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    *index = daBound(da, key, NULL, type, offset, 0);
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daUpperBoundKey(DaStruct *da, int *err, const void *key, int type, size_t offset, size_t *index)
+{
+    if (daTypeNotValid(da, err, type, offset))
+    {
+        return -1;
+    }
+    else if (!key || !index)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    *index = daBound(da, key, NULL, type, offset, 1);
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daBinarySearchKey(DaStruct *da, int *err, const void *key, int type, size_t offset, size_t *index)
+{
+    if (daLowerBoundKey(da, err, key, type, offset, index) != 0)
+    {
+        return -1;
+    }
+
+    /* Keys are equal in the order of daKeyBytes() if all their bits are equal */
+    if (*index == da->used || memcmp(key, (char *)da->firstAddr + (*index * da->bytesPerElement) + offset, daKeyWidth(type)) != 0)
+    {
+        *err = DA_NOT_FOUND;
+        return 0;
+    }
+
+    *err = DA_OK;
+    return 1;
+}
+
+int daEqualRangeKey(DaStruct *da, int *err, const void *key, int type, size_t offset, size_t *first, size_t *last)
+{
+    if (!last)
+    {
+        if (!paramNotValid(da, err))
+        {
+            *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        }
+
+        return -1;
+    }
+
+    if (daLowerBoundKey(da, err, key, type, offset, first) != 0)
+    {
+        return -1;
+    }
+
+    *last = daBound(da, key, NULL, type, offset, 1);
+
+    if (*first == *last)
+    {
+        *err = DA_NOT_FOUND;
+        return 0;
+    }
+
+    *err = DA_OK;
+    return 1;
+}
+
+/**
+ * Number of elements up to which the sorts use insertion sort.
+ */
+#define DA_SORT_SMALL 16
+
+/**
+ * @brief The structure holds the key and the position of an element sorted indirectly by daSortByKey().
+ */
+typedef struct str_da_sort_item
+{
+    /**
+     * Position of the element before the sort.
+     */
+    size_t index;
+
+    /**
+     * Copy of the key field of the element.
+     */
+    unsigned char key[8];
+
+} DaSortItem;
+
+/**
+ * @brief The function exchanges @p n bytes at @p a with the ones at @p b.
+ *
+ * @param[in] a First memory area.
+ * @param[in] b Second memory area, it must not overlap @p a.
+ * @param[in] n Number of bytes.
+ */
+static void daSwapBytes(char *a, char *b, size_t n)
+{
+    unsigned char tmp[64];
+    unsigned long word;
+    size_t chunk;
+
+    /* Elements of the size of a word get swapped through a register */
+    if (n == sizeof(word))
+    {
+        memcpy(&word, a, sizeof(word));
+        memcpy(a, b, sizeof(word));
+        memcpy(b, &word, sizeof(word));
+        return;
+    }
+
+    while (n > 0)
+    {
+        chunk = n < sizeof(tmp) ? n : sizeof(tmp);
+        memcpy(tmp, a, chunk);
+        memcpy(a, b, chunk);
+        memcpy(b, tmp, chunk);
+        a += chunk;
+        b += chunk;
+        n -= chunk;
+    }
+}
+
+/**
+ * @brief The function sorts @p n elements by insertion sort, equal elements keep their order.
+ *
+ * @param[in] base   First element.
+ * @param[in] n      Number of elements.
+ * @param[in] stride Size of an element.
+ * @param[in] cmp    Compares two elements.
+ */
+static void daInsertionSort(char *base, size_t n, size_t stride, DaCompare cmp)
+{
+    size_t i;
+    size_t j;
+
+    for (i = 1; i < n; i++)
+    {
+        for (j = i; j > 0 && cmp(base + ((j - 1) * stride), base + (j * stride)) > 0; j--)
+        {
+            daSwapBytes(base + ((j - 1) * stride), base + (j * stride), stride);
+        }
+    }
+}
+
+/**
+ * @brief The function moves the element at @p root down the heap of @p n elements until both children are smaller.
+ */
+static void daSiftDown(char *base, size_t root, size_t n, size_t stride, DaCompare cmp)
+{
+    size_t child;
+
+    while ((child = (2 * root) + 1) < n)
+    {
+        if (child + 1 < n && cmp(base + (child * stride), base + ((child + 1) * stride)) < 0)
+        {
+            child++;
+        }
+
+        if (cmp(base + (root * stride), base + (child * stride)) >= 0)
+        {
+            return;
+        }
+
+        daSwapBytes(base + (root * stride), base + (child * stride), stride);
+        root = child;
+    }
+}
+
+/**
+ * @brief The function sorts @p n elements by heapsort.
+ */
+static void daHeapSort(char *base, size_t n, size_t stride, DaCompare cmp)
+{
+    size_t i;
+
+    for (i = n / 2; i-- > 0;)
+    {
+        daSiftDown(base, i, n, stride, cmp);
+    }
+
+    for (i = n - 1; i > 0; i--)
+    {
+        daSwapBytes(base, base + (i * stride), stride);
+        daSiftDown(base, 0, i, stride, cmp);
+    }
+}
+
+/**
+ * @brief The function sorts @p n elements by introsort.
+ *
+ * The median of the first, middle and last element becomes the pivot, the elements equal to the pivot get spread
+ * over both partitions so many duplicates don't unbalance them. The smaller partition gets sorted recursively,
+ * the larger one by the loop. Partitions that are still unbalanced after @p depth levels get sorted by heapsort.
+ *
+ * @param[in] base   First element.
+ * @param[in] n      Number of elements.
+ * @param[in] stride Size of an element.
+ * @param[in] cmp    Compares two elements.
+ * @param[in] depth  Remaining number of partitioning levels.
+ */
+static void daIntroSort(char *base, size_t n, size_t stride, DaCompare cmp, size_t depth)
+{
+    char *mid;
+    char *last;
+    size_t i;
+    size_t j;
+
+    while (n > DA_SORT_SMALL)
+    {
+        if (depth-- == 0)
+        {
+            daHeapSort(base, n, stride, cmp);
+            return;
+        }
+
+        mid = base + ((n / 2) * stride);
+        last = base + ((n - 1) * stride);
+
+        if (cmp(mid, base) < 0)
+        {
+            daSwapBytes(mid, base, stride);
+        }
+
+        if (cmp(last, mid) < 0)
+        {
+            daSwapBytes(last, mid, stride);
+
+            if (cmp(mid, base) < 0)
+            {
+                daSwapBytes(mid, base, stride);
+            }
+        }
+
+        /* The pivot stays at the front during the partitioning */
+        daSwapBytes(base, mid, stride);
+
+        i = 0;
+        j = n;
+
+        for (;;)
+        {
+            do
+            {
+                i++;
+            }
+            while (i < n && cmp(base + (i * stride), base) < 0);
+
+            do
+            {
+                j--;
+            }
+            while (j > 0 && cmp(base, base + (j * stride)) < 0);
+
+            if (i >= j)
+            {
+                break;
+            }
+
+            daSwapBytes(base + (i * stride), base + (j * stride), stride);
+        }
+
+        if (j > 0)
+        {
+            daSwapBytes(base, base + (j * stride), stride);
+        }
+
+        if (j < n - j - 1)
+        {
+            daIntroSort(base, j, stride, cmp, depth);
+            base += (j + 1) * stride;
+            n -= j + 1;
+        }
+        else
+        {
+            daIntroSort(base + ((j + 1) * stride), n - j - 1, stride, cmp, depth);
+            n = j;
+        }
+    }
+
+    daInsertionSort(base, n, stride, cmp);
+}
+
+/**
+ * @brief The function merges the sorted runs [@p lo, @p mid) and [@p mid, @p hi) of @p src into @p dst.
+ *
+ * Equal elements of the first run come first. Runs that are already in order get copied at once.
+ */
+static void daMergeRuns(const char *src, char *dst, size_t lo, size_t mid, size_t hi, size_t stride, DaCompare cmp)
+{
+    size_t i;
+    size_t j;
+    size_t k;
+
+    if (mid == hi || cmp(src + ((mid - 1) * stride), src + (mid * stride)) <= 0)
+    {
+        memcpy(dst + (lo * stride), src + (lo * stride), (hi - lo) * stride);
+        return;
+    }
+
+    for (i = lo, j = mid, k = lo; i < mid && j < hi; k++)
+    {
+        if (cmp(src + (j * stride), src + (i * stride)) < 0)
+        {
+            memcpy(dst + (k * stride), src + (j++ * stride), stride);
+        }
+        else
+        {
+            memcpy(dst + (k * stride), src + (i++ * stride), stride);
+        }
+    }
+
+    memcpy(dst + (k * stride), src + (i * stride), (mid - i) * stride);
+    k += mid - i;
+    memcpy(dst + (k * stride), src + (j * stride), (hi - j) * stride);
+}
+
+/**
+ * @brief The function sorts @p n elements by a bottom up merge sort, equal elements keep their order.
+ *
+ * @param[in] base    First element.
+ * @param[in] scratch Temporary buffer of @p n elements.
+ * @param[in] n       Number of elements.
+ * @param[in] stride  Size of an element.
+ * @param[in] cmp     Compares two elements.
+ */
+static void daMergeSort(char *base, char *scratch, size_t n, size_t stride, DaCompare cmp)
+{
+    char *src;
+    char *dst;
+    char *tmp;
+    size_t width;
+    size_t lo;
+
+    for (lo = 0; lo < n; lo += DA_SORT_SMALL)
+    {
+        daInsertionSort(base + (lo * stride), n - lo < DA_SORT_SMALL ? n - lo : DA_SORT_SMALL, stride, cmp);
+    }
+
+    src = base;
+    dst = scratch;
+
+    for (width = DA_SORT_SMALL; width < n; width *= 2)
+    {
+        for (lo = 0; lo < n; lo += 2 * width)
+        {
+            daMergeRuns(src, dst, lo, n - lo < width ? n : lo + width, n - lo < 2 * width ? n : lo + (2 * width), stride, cmp);
+        }
+
+        tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    if (src != base)
+    {
+        memcpy(base, src, n * stride);
+    }
+}
+
+/**
+ * @brief The function sorts @p n records by the key at @p offset with a least significant digit radix sort.
+ *
+ * The bytes of the keys get ordered like daKeyBytes() does: the sign bit of signed keys and of positive
+ * floating point keys gets flipped, negative floating point keys get inverted completely.
+ * A single scan counts the bytes of all passes, passes in which all keys share the byte get skipped.
+ * Every other pass moves the records between @p src and @p dst.
+ *
+ * @param[in] src    The records.
+ * @param[in] dst    Temporary buffer of @p n records.
+ * @param[in] n      Number of records.
+ * @param[in] stride Size of a record.
+ * @param[in] offset Offset of the key within a record.
+ * @param[in] type   Type of the key.
+ *
+ * @returns The function returns either @p src or @p dst, the one that holds the sorted records.
+ */
+static char *daRadixSort(char *src, char *dst, size_t n, size_t stride, size_t offset, int type)
+{
+    size_t counts[8][256];
+    size_t pos[8];
+    unsigned char flip[8];
+    const unsigned char *key;
+    unsigned char invert;
+    size_t width;
+    size_t top;
+    size_t pass;
+    size_t sum;
+    size_t count;
+    size_t i;
+    int floating;
+    int little;
+    char *tmp;
+
+    width = daKeyWidth(type);
+    floating = (type & ~0xff) == DA_KEY_FLOAT;
+    little = daLittleEndian();
+    top = little ? width - 1 : 0;
+
+    /* Pass 0 works on the least significant byte */
+    for (pass = 0; pass < width; pass++)
+    {
+        pos[pass] = little ? pass : width - 1 - pass;
+        flip[pass] = (unsigned char)((pass == width - 1 && (type & ~0xff) != DA_KEY_UNSIGNED) ? 0x80 : 0);
+    }
+
+    memset(counts, 0, sizeof(counts));
+
+    for (i = 0; i < n; i++)
+    {
+        key = (unsigned char *)src + (i * stride) + offset;
+        invert = (unsigned char)((floating && (key[top] & 0x80)) ? 0xff : 0);
+
+        for (pass = 0; pass < width; pass++)
+        {
+            counts[pass][key[pos[pass]] ^ (invert | flip[pass])]++;
+        }
+    }
+
+    for (pass = 0; pass < width; pass++)
+    {
+        key = (unsigned char *)src + offset;
+        invert = (unsigned char)((floating && (key[top] & 0x80)) ? 0xff : 0);
+
+        if (counts[pass][key[pos[pass]] ^ (invert | flip[pass])] == n)
+        {
+            continue;
+        }
+
+        for (i = 0, sum = 0; i < 256; i++)
+        {
+            count = counts[pass][i];
+            counts[pass][i] = sum;
+            sum += count;
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            key = (unsigned char *)src + (i * stride) + offset;
+            invert = (unsigned char)((floating && (key[top] & 0x80)) ? 0xff : 0);
+            count = counts[pass][key[pos[pass]] ^ (invert | flip[pass])]++;
+            memcpy(dst + (count * stride), src + (i * stride), stride);
+        }
+
+        tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    return src;
+}
+
+/**
+ * @brief The function sorts the large elements of the array indirectly by the key at @p offset.
+ *
+ * The keys get radix sorted together with the element positions, afterwards every cycle of the permutation
+ * gets moved through a single element buffer.
+ *
+ * @param[in] da     Sort this array.
+ * @param[in] type   Type of the key.
+ * @param[in] offset Offset of the key within each element.
+ *
+ * @returns The function returns 0 on success and -1 if no space is left on device.
+ */
+static int daSortIndirect(DaStruct *da, int type, size_t offset)
+{
+    DaSortItem *items;
+    DaSortItem *sorted;
+    char *base;
+    char *element;
+    size_t stride;
+    size_t width;
+    size_t i;
+    size_t j;
+    size_t k;
+
+    base = da->firstAddr;
+    stride = da->bytesPerElement;
+    width = daKeyWidth(type);
+
+    if (!(items = malloc((2 * da->used * sizeof(DaSortItem)) + stride)))
+    {
+        return -1;
+    }
+
+    element = (char *)(items + (2 * da->used));
+
+    for (i = 0; i < da->used; i++)
+    {
+        items[i].index = i;
+        memcpy(items[i].key, base + (i * stride) + offset, width);
+    }
+
+    sorted = (DaSortItem *)daRadixSort((char *)items, (char *)(items + da->used), da->used, sizeof(DaSortItem),
+                                       offsetof(DaSortItem, key), type);
+
+    /* The element at position i moves to the position j whose item refers to it */
+    for (i = 0; i < da->used; i++)
+    {
+        if (sorted[i].index == i)
+        {
+            continue;
+        }
+
+        memcpy(element, base + (i * stride), stride);
+
+        for (j = i; sorted[j].index != i; j = k)
+        {
+            k = sorted[j].index;
+            memcpy(base + (j * stride), base + (k * stride), stride);
+            sorted[j].index = j;
+        }
+
+        memcpy(base + (j * stride), element, stride);
+        sorted[j].index = j;
+    }
+
+    free(items);
+    return 0;
+}
+
+/**
+ * The reversal loop of daReverseElements() for elements of the size of the type @p T.
+ */
+#define DA_REVERSE_TYPED(T) \
+    { \
+        T x; \
+        T y; \
+        \
+        for (i = 0; i < n / 2; i++) \
+        { \
+            memcpy(&x, base + (i * sizeof(T)), sizeof(T)); \
+            memcpy(&y, base + ((n - 1 - i) * sizeof(T)), sizeof(T)); \
+            memcpy(base + (i * sizeof(T)), &y, sizeof(T)); \
+            memcpy(base + ((n - 1 - i) * sizeof(T)), &x, sizeof(T)); \
+        } \
+        return; \
+    }
+
+/**
+ * @brief The function reverses the order of @p n elements.
+ */
+static void daReverseElements(char *base, size_t n, size_t stride)
+{
+    size_t i;
+
+    if (stride == sizeof(unsigned int))
+    DA_REVERSE_TYPED(unsigned int)
+
+    if (stride == sizeof(unsigned long))
+    DA_REVERSE_TYPED(unsigned long)
+
+    for (i = 0; i < n / 2; i++)
+    {
+        daSwapBytes(base + (i * stride), base + ((n - 1 - i) * stride), stride);
+    }
+}
+
+/**
+ * @brief The function exchanges the @p left elements at @p base with the @p right elements behind them.
+ *
+ * The shorter block gets swapped with the end respectively the start of the longer one, which puts it into its final
+ * place, and the rest of the longer block remains to be rotated.
+ */
+static void daRotateElements(char *base, size_t left, size_t right, size_t stride)
+{
+    while (left > 0 && right > 0)
+    {
+        if (left <= right)
+        {
+            daSwapBytes(base, base + (right * stride), left * stride);
+            right -= left;
+        }
+        else
+        {
+            daSwapBytes(base, base + (left * stride), right * stride);
+            base += right * stride;
+            left -= right;
+        }
+    }
+}
+
+/**
+ * @brief The function merges the sorted runs of @p left and @p right elements at @p base without additional memory.
+ *
+ * The larger run gets split in the middle, the matching part of the other run gets rotated in front of the
+ * upper half and both halves get merged recursively.
+ */
+static void daMergeInPlace(char *base, size_t left, size_t right, size_t stride, DaCompare cmp)
+{
+    size_t cutLeft;
+    size_t cutRight;
+    size_t first;
+    size_t half;
+    size_t n;
+
+    while (left > 0 && right > 0)
+    {
+        if (left + right == 2)
+        {
+            if (cmp(base + stride, base) < 0)
+            {
+                daSwapBytes(base, base + stride, stride);
+            }
+
+            return;
+        }
+
+        if (left > right)
+        {
+            /* Lower bound of the middle element of the left run in the right run */
+            cutLeft = left / 2;
+
+            for (first = 0, n = right; n > 0;)
+            {
+                half = n / 2;
+
+                if (cmp(base + ((left + first + half) * stride), base + (cutLeft * stride)) < 0)
+                {
+                    first += half + 1;
+                    n -= half + 1;
+                }
+                else
+                {
+                    n = half;
+                }
+            }
+
+            cutRight = first;
+        }
+        else
+        {
+            /* Upper bound of the middle element of the right run in the left run */
+            cutRight = right / 2;
+
+            for (first = 0, n = left; n > 0;)
+            {
+                half = n / 2;
+
+                if (cmp(base + ((left + cutRight) * stride), base + ((first + half) * stride)) >= 0)
+                {
+                    first += half + 1;
+                    n -= half + 1;
+                }
+                else
+                {
+                    n = half;
+                }
+            }
+
+            cutLeft = first;
+        }
+
+        daRotateElements(base + (cutLeft * stride), left - cutLeft, cutRight, stride);
+        daMergeInPlace(base, cutLeft, cutRight, stride, cmp);
+
+        base += (cutLeft + cutRight) * stride;
+        left -= cutLeft;
+        right -= cutRight;
+    }
+}
+
+/**
+ * @brief The structure describes a parallel sort.
+ */
+typedef struct str_da_sort_job
+{
+    /**
+     * Common job header.
+     */
+    DaJob job;
+
+    /**
+     * The elements that get sorted or merged.
+     */
+    char *src;
+
+    /**
+     * Receives the merged runs or NULL to merge within DaSortJob#src.
+     */
+    char *dst;
+
+    /**
+     * Number of elements.
+     */
+    size_t n;
+
+    /**
+     * Number of runs the elements got split into.
+     */
+    size_t runs;
+
+    /**
+     * Number of runs merged into each of the two merged runs or 0 to sort the runs.
+     */
+    size_t step;
+
+    /**
+     * Size of an element.
+     */
+    size_t stride;
+
+    /**
+     * Compares two elements.
+     */
+    DaCompare cmp;
+
+} DaSortJob;
+
+/**
+ * @brief The function returns the first element of the @p run of a parallel sort.
+ */
+static size_t daSortBound(const DaSortJob *sort, size_t run)
+{
+    if (run >= sort->runs)
+    {
+        return sort->n;
+    }
+
+    return (run * (sort->n / sort->runs)) + (run < sort->n % sort->runs ? run : sort->n % sort->runs);
+}
+
+/**
+ * @brief The function is executed by every thread of a parallel sort.
+ *
+ * Every block is either a run that gets sorted or a pair of adjacent runs that get merged.
+ *
+ * @param[in] job The sort job.
+ */
+static void daSortWorker(DaJob *job)
+{
+    DaSortJob *sort;
+    size_t block;
+    size_t depth;
+    size_t lo;
+    size_t mid;
+    size_t hi;
+    size_t n;
+
+    sort = (DaSortJob *)job;
+
+    while (daJobClaim(job, &block))
+    {
+        if (sort->step == 0)
+        {
+            lo = daSortBound(sort, block);
+            hi = daSortBound(sort, block + 1);
+
+            for (n = hi - lo, depth = 0; n > 1; n /= 2)
+            {
+                depth += 2;
+            }
+
+            daIntroSort(sort->src + (lo * sort->stride), hi - lo, sort->stride, sort->cmp, depth);
+            continue;
+        }
+
+        lo = daSortBound(sort, block * 2 * sort->step);
+        mid = daSortBound(sort, (block * 2 * sort->step) + sort->step);
+        hi = daSortBound(sort, (block * 2 * sort->step) + (2 * sort->step));
+
+        if (sort->dst)
+        {
+            daMergeRuns(sort->src, sort->dst, lo, mid, hi, sort->stride, sort->cmp);
+        }
+        else
+        {
+            daMergeInPlace(sort->src + (lo * sort->stride), mid - lo, hi - mid, sort->stride, sort->cmp);
+        }
+    }
+}
+
+/**
+ * @brief The function checks the parameters of daSort() and daSortStable().
+ */
+static int daSortNotValid(const DaStruct *da, int *err, DaCompare cmp)
+{
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (!cmp)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    return 0;
+}
+
+int daSort(DaStruct *da, int *err, DaCompare cmp)
+{
+    size_t depth;
+    size_t n;
+
+    if (daSortNotValid(da, err, cmp))
+    {
+        return -1;
+    }
+
+    for (n = da->used, depth = 0; n > 1; n /= 2)
+    {
+        depth += 2;
+    }
+
+    daIntroSort(da->firstAddr, da->used, da->bytesPerElement, cmp, depth);
+    daSidecarReorder(da);
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daSortStable(DaStruct *da, int *err, DaCompare cmp)
+{
+    char *scratch;
+
+    if (daSortNotValid(da, err, cmp))
+    {
+        return -1;
+    }
+
+    if (da->used <= DA_SORT_SMALL)
+    {
+        daInsertionSort(da->firstAddr, da->used, da->bytesPerElement, cmp);
+    }
+    else
+    {
+        if (!(scratch = malloc(da->used * da->bytesPerElement)))
+        {
+            *err = DA_FATAL | DA_ENOMEM;
+            return -1;
+        }
+
+        daMergeSort(da->firstAddr, scratch, da->used, da->bytesPerElement, cmp);
+        free(scratch);
+    }
+
+    daSidecarReorder(da);
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daSortParallel(DaStruct *da, int *err, DaCompare cmp, size_t threads)
+{
+    DaSortJob sort;
+    char *scratch;
+    char *tmp;
+    size_t bytes;
+
+    if (daSortNotValid(da, err, cmp))
+    {
+        return -1;
+    }
+
+    bytes = da->used * da->bytesPerElement;
+
+    if (threads < 2 || bytes < DA_PARALLEL_THRESHOLD)
+    {
+        return daSort(da, err, cmp);
+    }
+
+    /* A run per thread, rounded up to a power of two so every merge round halves the runs */
+    sort.runs = 1;
+    while (sort.runs < threads && sort.runs < da->used / DA_SORT_SMALL)
+    {
+        sort.runs *= 2;
+    }
+
+    /* The scratch buffer must fit into the bytes the array may still grow by */
+    scratch = NULL;
+    if (bytes <= da->maxBytes - (da->max * da->bytesPerElement))
+    {
+        scratch = malloc(bytes);
+    }
+
+    sort.job.run = daSortWorker;
+    sort.job.next = 0;
+    sort.job.blocks = sort.runs;
+    sort.src = da->firstAddr;
+    sort.dst = NULL;
+    sort.n = da->used;
+    sort.step = 0;
+    sort.stride = da->bytesPerElement;
+    sort.cmp = cmp;
+
+    daParallelRun(&sort.job, threads);
+
+    /* Merging without a scratch buffer rotates the runs in place */
+    for (sort.dst = scratch, sort.step = 1; sort.step < sort.runs; sort.step *= 2)
+    {
+        sort.job.next = 0;
+        sort.job.blocks = sort.runs / (2 * sort.step);
+
+        daParallelRun(&sort.job, threads);
+
+        if (scratch)
+        {
+            tmp = sort.src;
+            sort.src = sort.dst;
+            sort.dst = tmp;
+        }
+    }
+
+    if (sort.src != da->firstAddr)
+    {
+        memcpy(da->firstAddr, sort.src, bytes);
+    }
+
+    free(scratch);
+    daSidecarReorder(da);
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daSortByKey(DaStruct *da, int *err, int type, size_t offset)
+{
+    char *scratch;
+    char *sorted;
+
+    if (daTypeNotValid(da, err, type, offset))
+    {
+        return -1;
+    }
+
+    if (da->used > 1)
+    {
+        if (da->bytesPerElement > DA_SORT_INDIRECT)
+        {
+            if (daSortIndirect(da, type, offset))
+            {
+                *err = DA_FATAL | DA_ENOMEM;
+                return -1;
+            }
+        }
+        else
+        {
+            if (!(scratch = malloc(da->used * da->bytesPerElement)))
+            {
+                *err = DA_FATAL | DA_ENOMEM;
+                return -1;
+            }
+
+            sorted = daRadixSort(da->firstAddr, scratch, da->used, da->bytesPerElement, offset, type);
+
+            if (sorted != da->firstAddr)
+            {
+                memcpy(da->firstAddr, sorted, da->used * da->bytesPerElement);
+            }
+
+            free(scratch);
+        }
+    }
+
+    daSidecarReorder(da);
+
+    *err = DA_OK;
+    return 0;
+}
+
+/**
+ * Operation of daSetOperation(): All elements of both arrays.
+ */
+#define DA_SET_MERGE      0
+/**
+ * Operation of daSetOperation(): Equal elements of both arrays once.
+ */
+#define DA_SET_UNION      1
+/**
+ * Operation of daSetOperation(): The elements of the first array that are in the second one.
+ */
+#define DA_SET_INTERSECT  2
+/**
+ * Operation of daSetOperation(): The elements of the first array that aren't in the second one.
+ */
+#define DA_SET_DIFFERENCE 3
+
+/**
+ * @brief The function returns the first element from @p lo on that isn't less than @p key.
+ *
+ * The element at @p lo must be less than @p key. The probes start next to it at growing distances of 1, 2, 4, ...
+ * elements, the last gap gets binary searched.
+ *
+ * @param[in] base   First element of the array.
+ * @param[in] lo     Element that is less than @p key.
+ * @param[in] hi     End of the searched elements.
+ * @param[in] stride Size of an element.
+ * @param[in] key    Search for this element.
+ * @param[in] cmp    Compares two elements.
+ *
+ * @returns The function returns the index of the element or @p hi if all elements are less than @p key.
+ */
+static size_t daGallop(const char *base, size_t lo, size_t hi, size_t stride, const void *key, DaCompare cmp)
+{
+    size_t step;
+    size_t probe;
+    size_t half;
+    size_t n;
+
+    for (step = 1;; step *= 2)
+    {
+        if (hi - lo <= step)
+        {
+            probe = hi;
+            break;
+        }
+
+        probe = lo + step;
+
+        if (cmp(base + (probe * stride), key) >= 0)
+        {
+            break;
+        }
+
+        lo = probe;
+    }
+
+    /* All elements up to lo are less, the one at probe isn't */
+    for (lo++, n = probe - lo; n > 0;)
+    {
+        half = n / 2;
+
+        if (cmp(base + ((lo + half) * stride), key) < 0)
+        {
+            lo += half + 1;
+            n -= half + 1;
+        }
+        else
+        {
+            n = half;
+        }
+    }
+
+    return lo;
+}
+
+/**
+ * @brief The function appends @p n elements at @p src to @p dst.
+ *
+ * @returns The function returns 0 on success and -1 if @p dst can't hold them.
+ */
+static int daSetEmit(DaStruct *dst, int *err, const char *src, size_t n)
+{
+    if (n == 0)
+    {
+        return 0;
+    }
+    else if (daReserve(dst, err, n) != 0)
+    {
+        return -1;
+    }
+
+    memcpy((char *)dst->firstAddr + (dst->used * dst->bytesPerElement), src, n * dst->bytesPerElement);
+    dst->used += n;
+
+    return 0;
+}
+
+/**
+ * @brief The function combines the sorted arrays @p a and @p b into @p dst.
+ *
+ * @param[out] dst Receives the result.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  a   First array.
+ * @param[in]  b   Second array.
+ * @param[in]  cmp Compares two elements.
+ * @param[in]  op  One of ::DA_SET_MERGE to ::DA_SET_DIFFERENCE.
+ *
+ * @returns The function returns 0 on success and -1 in the event of an error.
+ */
+static int daSetOperation(DaStruct *dst, int *err, const DaStruct *a, const DaStruct *b, DaCompare cmp, int op)
+{
+    const char *baseA;
+    const char *baseB;
+    size_t stride;
+    size_t i;
+    size_t j;
+    size_t k;
+    int keepA;
+    int keepB;
+    int failed;
+    int c;
+
+    if (paramNotValid(dst, err) || paramNotValid(a, err) || paramNotValid(b, err))
+    {
+        return -1;
+    }
+    else if (!cmp)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+    else if (dst == a || dst == b || dst->bytesPerElement != a->bytesPerElement || dst->bytesPerElement != b->bytesPerElement)
+    {
+        *err = DA_PARAM_ERR | DA_INCOMPATIBLE;
+        return -1;
+    }
+
+    dst->used = 0;
+    daSidecarClear(dst);
+
+    baseA = a->firstAddr;
+    baseB = b->firstAddr;
+    stride = a->bytesPerElement;
+
+    /* Whether elements without an equal one in the other array get taken */
+    keepA = op != DA_SET_INTERSECT;
+    keepB = op == DA_SET_MERGE || op == DA_SET_UNION;
+
+    *err = DA_OK;
+    failed = op == DA_SET_MERGE && daReserve(dst, err, a->used + b->used) != 0;
+
+    for (i = 0, j = 0; !failed && i < a->used && j < b->used;)
+    {
+        c = cmp(baseA + (i * stride), baseB + (j * stride));
+
+        if (c < 0)
+        {
+            k = daGallop(baseA, i, a->used, stride, baseB + (j * stride), cmp);
+            failed = keepA && daSetEmit(dst, err, baseA + (i * stride), k - i);
+            i = k;
+        }
+        else if (c > 0)
+        {
+            k = daGallop(baseB, j, b->used, stride, baseA + (i * stride), cmp);
+            failed = keepB && daSetEmit(dst, err, baseB + (j * stride), k - j);
+            j = k;
+        }
+        else if (op == DA_SET_MERGE)
+        {
+            /* The equal elements of b follow the ones of a */
+            failed = daSetEmit(dst, err, baseA + (i++ * stride), 1);
+        }
+        else
+        {
+            failed = op != DA_SET_DIFFERENCE && daSetEmit(dst, err, baseA + (i * stride), 1);
+            i++;
+            j++;
+        }
+    }
+
+    if (!failed && keepA)
+    {
+        failed = daSetEmit(dst, err, baseA + (i * stride), a->used - i);
+    }
+
+    if (!failed && keepB)
+    {
+        failed = daSetEmit(dst, err, baseB + (j * stride), b->used - j);
+    }
+
+    if (failed)
+    {
+        dst->used = 0;
+        return -1;
+    }
+
+    daSidecarRebuild(dst);
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daMerge(DaStruct *dst, int *err, const DaStruct *a, const DaStruct *b, DaCompare cmp)
+{
+    return daSetOperation(dst, err, a, b, cmp, DA_SET_MERGE);
+}
+
+int daUnion(DaStruct *dst, int *err, const DaStruct *a, const DaStruct *b, DaCompare cmp)
+{
+    return daSetOperation(dst, err, a, b, cmp, DA_SET_UNION);
+}
+
+int daIntersect(DaStruct *dst, int *err, const DaStruct *a, const DaStruct *b, DaCompare cmp)
+{
+    return daSetOperation(dst, err, a, b, cmp, DA_SET_INTERSECT);
+}
+
+int daDifference(DaStruct *dst, int *err, const DaStruct *a, const DaStruct *b, DaCompare cmp)
+{
+    return daSetOperation(dst, err, a, b, cmp, DA_SET_DIFFERENCE);
+}
+
+/**
+ * @brief The function checks the parameters of the functions working on the elements @p from to @p to.
+ *
+ * @returns The function returns 0 if the parameters are valid and -1 otherwise.
+ */
+static int daSpanNotValid(const DaStruct *da, int *err, size_t from, size_t to)
+{
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (from > to || to >= da->used)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return -1;
+    }
+
+    return 0;
+}
+
+int daSwap(DaStruct *da, int *err, size_t i, size_t j)
+{
+    struct str_da_index *ix;
+    size_t slotI;
+    size_t slotJ;
+
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (i >= da->used || j >= da->used)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return -1;
+    }
+
+    *err = DA_OK;
+
+    if (i == j)
+    {
+        return 0;
+    }
+
+    /* The entries keep their slots, only the positions get exchanged */
+    ix = da->index;
+    slotI = 0;
+    slotJ = 0;
+
+    if (ix && ix->entries && ((slotI = daIndexSlot(da, i)) == ix->slots || (slotJ = daIndexSlot(da, j)) == ix->slots))
+    {
+        daIndexSuspend(ix);
+    }
+
+    daSwapBytes((char *)da->firstAddr + (i * da->bytesPerElement), (char *)da->firstAddr + (j * da->bytesPerElement), da->bytesPerElement);
+
+    if (ix && ix->entries)
+    {
+        ix->entries[slotI].pos = j + 1;
+        ix->entries[slotJ].pos = i + 1;
+    }
+
+    return 0;
+}
+
+int daReverse(DaStruct *da, int *err, size_t from, size_t to)
+{
+    if (daSpanNotValid(da, err, from, to))
+    {
+        return -1;
+    }
+
+    if (from < to)
+    {
+        daReverseElements((char *)da->firstAddr + (from * da->bytesPerElement), to - from + 1, da->bytesPerElement);
+        daSidecarReorder(da);
+    }
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daRotate(DaStruct *da, int *err, size_t from, size_t to, size_t k)
+{
+    size_t n;
+
+    if (daSpanNotValid(da, err, from, to))
+    {
+        return -1;
+    }
+
+    n = to - from + 1;
+    k %= n;
+
+    if (k > 0)
+    {
+        daRotateElements((char *)da->firstAddr + (from * da->bytesPerElement), k, n - k, da->bytesPerElement);
+        daSidecarReorder(da);
+    }
+
+    *err = DA_OK;
+    return 0;
+}
+
+/**
+ * @brief The structure accumulates the sum of a numeric field.
+ *
+ * Integers get added exactly to a two's complement number of two unsigned longs,
+ * floating point numbers with Kahan's compensated summation.
+ */
+typedef struct str_da_sum
+{
+    /**
+     * Low word of the integer sum.
+     */
+    unsigned long lo;
+
+    /**
+     * High word of the integer sum.
+     */
+    unsigned long hi;
+
+    /**
+     * Floating point sum.
+     */
+    double sum;
+
+    /**
+     * Negative error of DaSum#sum.
+     */
+    double comp;
+
+} DaSum;
+
+/**
+ * @brief The structure describes a parallel reduction of a numeric field.
+ */
+typedef struct str_da_numeric_job
+{
+    /**
+     * Common job header.
+     */
+    DaJob job;
+
+    /**
+     * Reduce the elements of this array.
+     */
+    const DaStruct *da;
+
+    /**
+     * Type of the field.
+     */
+    int type;
+
+    /**
+     * Offset of the field within each element.
+     */
+    size_t offset;
+
+    /**
+     * First element of the range.
+     */
+    size_t from;
+
+    /**
+     * Element behind the range.
+     */
+    size_t to;
+
+    /**
+     * Number of elements per block.
+     */
+    size_t blockElements;
+
+    /**
+     * 1 to search the largest value, 0 to search the smallest one.
+     */
+    int max;
+
+    /**
+     * 1 to sum up the range, 0 to search the smallest or largest value.
+     */
+    int sum;
+
+    /**
+     * Index of the smallest or largest value found so far or ::DA_NPOS.
+     */
+    size_t best;
+
+    /**
+     * Sum of the blocks finished so far.
+     */
+    DaSum acc;
+
+} DaNumericJob;
+
+/**
+ * @brief The function converts the numeric field @p src of the type @p type into a double.
+ *
+ * @param[in] type Type of the field.
+ * @param[in] src  The field.
+ *
+ * @returns The value of the field.
+ */
+static double daKeyDouble(int type, const void *src)
+{
+    const unsigned char *bytes;
+    float f;
+    double d;
+    double scale;
+    size_t width;
+    size_t i;
+    int little;
+
+    if (type == DA_KEY_F32)
+    {
+        memcpy(&f, src, sizeof(f));
+        return f;
+    }
+    else if (type == DA_KEY_F64)
+    {
+        memcpy(&d, src, sizeof(d));
+        return d;
+    }
+
+    bytes = src;
+    width = daKeyWidth(type);
+    little = daLittleEndian();
+
+    for (i = 0, d = 0.0, scale = 1.0; i < width; i++, scale *= 256.0)
+    {
+        d = d * 256.0 + bytes[little ? width - 1 - i : i];
+    }
+
+    /* Two's complement */
+    if ((type & ~0xff) == DA_KEY_SIGNED && (bytes[little ? width - 1 : 0] & 0x80))
+    {
+        d -= scale;
+    }
+
+    return d;
+}
+
+/**
+ * @brief The function adds @p x to the floating point sum of @p acc.
+ *
+ * @param[in] acc The accumulator.
+ * @param[in] x   Add this value.
+ */
+static void daSumAddDouble(DaSum *acc, double x)
+{
+    double y;
+    double t;
+
+    y = x - acc->comp;
+    t = acc->sum + y;
+    acc->comp = (t - acc->sum) - y;
+    acc->sum = t;
+}
+
+/**
+ * @brief The function adds the sum @p part to @p acc.
+ *
+ * @param[in] acc  The accumulator.
+ * @param[in] part Add this sum.
+ */
+static void daSumMerge(DaSum *acc, const DaSum *part)
+{
+    acc->lo += part->lo;
+    acc->hi += part->hi + (acc->lo < part->lo);
+    daSumAddDouble(acc, part->sum);
+    daSumAddDouble(acc, -part->comp);
+}
+
+/**
+ * @brief The function converts the sum of @p acc into a double.
+ *
+ * @param[in] acc The accumulator.
+ *
+ * @returns The sum.
+ */
+static double daSumValue(const DaSum *acc)
+{
+    unsigned long lo;
+    unsigned long hi;
+    double value;
+    int negative;
+
+    lo = acc->lo;
+    hi = acc->hi;
+    negative = (int)(hi >> (sizeof(unsigned long) * 8 - 1));
+
+    if (negative)
+    {
+        lo = ~lo + 1;
+        hi = ~hi + (lo == 0);
+    }
+
+    value = (double)hi * ((double)~0UL + 1.0) + (double)lo;
+    value = negative ? -value : value;
+
+    return value + (acc->sum - acc->comp);
+}
+
+/**
+ * @brief The function converts the integer sum of @p acc into a long.
+ *
+ * Fields without a native type of their width get added as doubles, their sum is only exact below 2^53.
+ *
+ * @param[in]  acc   The accumulator.
+ * @param[out] value Receives the sum.
+ *
+ * @returns The function returns 0 on success and -1 if the sum doesn't fit into a long.
+ */
+static int daSumLongValue(const DaSum *acc, long *value)
+{
+    double rest;
+
+    if (acc->hi == 0 && acc->lo <= (unsigned long)LONG_MAX)
+    {
+        *value = (long)acc->lo;
+    }
+    else if (acc->hi == ~0UL && acc->lo > (unsigned long)LONG_MAX)
+    {
+        *value = -(long)~acc->lo - 1;
+    }
+    else
+    {
+        return -1;
+    }
+
+    rest = acc->sum - acc->comp;
+
+    if (rest == 0.0)
+    {
+        return 0;
+    }
+    else if (rest > 9007199254740992.0 || rest < -9007199254740992.0 || (rest > 0.0 && (double)LONG_MAX - rest < *value)
+             || (rest < 0.0 && (double)LONG_MIN - rest > *value))
+    {
+        return -1;
+    }
+
+    *value += (long)rest;
+    return 0;
+}
+
+/**
+ * The summation loop of daSumRange() for unsigned integer fields of the type @p T.
+ */
+#define DA_SUM_UNSIGNED(T) \
+    { \
+        T v; \
+        \
+        for (i = from; i < to; i++) \
+        { \
+            memcpy(&v, base + (i * stride), sizeof(T)); \
+            w = (unsigned long)v; \
+            lo += w; \
+            hi += (lo < w); \
+        } \
+    }
+
+/**
+ * The summation loop of daSumRange() for signed integer fields of the type @p T, sign extended to two words.
+ */
+#define DA_SUM_SIGNED(T) \
+    { \
+        T v; \
+        \
+        for (i = from; i < to; i++) \
+        { \
+            memcpy(&v, base + (i * stride), sizeof(T)); \
+            w = (unsigned long)(long)v; \
+            lo += w; \
+            hi += (lo < w) + (0UL - (unsigned long)(v < 0)); \
+        } \
+    }
+
+/**
+ * The compensated summation loop of daSumRange() for floating point fields of the type @p T.
+ */
+#define DA_SUM_FLOAT(T) \
+    { \
+        T v; \
+        double y; \
+        double t; \
+        \
+        for (i = from; i < to; i++) \
+        { \
+            memcpy(&v, base + (i * stride), sizeof(T)); \
+            y = (double)v - comp; \
+            t = sum + y; \
+            comp = (t - sum) - y; \
+            sum = t; \
+        } \
+    }
+
+/**
+ * @brief The function adds the numeric field of the elements in [@p from, @p to) to @p acc.
+ *
+ * @param[in] da     Sum up the elements of this array.
+ * @param[in] type   Type of the field.
+ * @param[in] offset Offset of the field within each element.
+ * @param[in] from   First element (0 based).
+ * @param[in] to     Element behind the last one.
+ * @param[in] acc    The accumulator.
+ */
+static void daSumRange(const DaStruct *da, int type, size_t offset, size_t from, size_t to, DaSum *acc)
+{
+    const char *base;
+    unsigned long lo;
+    unsigned long hi;
+    unsigned long w;
+    double sum;
+    double comp;
+    size_t stride;
+    size_t i;
+
+    base = (const char *)da->firstAddr + offset;
+    stride = da->bytesPerElement;
+    lo = acc->lo;
+    hi = acc->hi;
+    sum = acc->sum;
+    comp = acc->comp;
+
+    if (type == DA_KEY_U8)
+    DA_SUM_UNSIGNED(unsigned char)
+    else if (type == DA_KEY_S8)
+    DA_SUM_SIGNED(signed char)
+    else if (type == DA_KEY_U16 && sizeof(unsigned short) == 2)
+    DA_SUM_UNSIGNED(unsigned short)
+    else if (type == DA_KEY_S16 && sizeof(short) == 2)
+    DA_SUM_SIGNED(short)
+    else if (type == DA_KEY_U32 && sizeof(unsigned int) == 4)
+    DA_SUM_UNSIGNED(unsigned int)
+    else if (type == DA_KEY_S32 && sizeof(int) == 4)
+    DA_SUM_SIGNED(int)
+    else if (type == DA_KEY_U64 && sizeof(unsigned long) == 8)
+    DA_SUM_UNSIGNED(unsigned long)
+    else if (type == DA_KEY_S64 && sizeof(long) == 8)
+    DA_SUM_SIGNED(long)
+    else if (type == DA_KEY_F32 && sizeof(float) == 4)
+    DA_SUM_FLOAT(float)
+    else if (type == DA_KEY_F64 && sizeof(double) == 8)
+    DA_SUM_FLOAT(double)
+    else
+    {
+        /* No native type of the field width */
+        acc->sum = sum;
+        acc->comp = comp;
+
+        for (i = from; i < to; i++)
+        {
+            daSumAddDouble(acc, daKeyDouble(type, base + (i * stride)));
+        }
+
+        sum = acc->sum;
+        comp = acc->comp;
+    }
+
+    acc->lo = lo;
+    acc->hi = hi;
+    acc->sum = sum;
+    acc->comp = comp;
+}
+
+/**
+ * The branchless search loop of daArgMin() for fields of the width of the unsigned type @p UT.
+ * The order of the largest values gets inverted, so the loop always searches the smallest one.
+ */
+#define DA_ARGMIN_TYPED(UT) \
+    { \
+        UT value; \
+        UT best; \
+        UT flip; \
+        UT all; \
+        UT invert; \
+        \
+        flip = (UT)(kind == DA_KEY_UNSIGNED ? 0 : (UT)1 << (sizeof(UT) * 8 - 1)); \
+        all = (UT)(kind == DA_KEY_FLOAT ? ~(UT)0 : 0); \
+        invert = (UT)(max ? ~(UT)0 : 0); \
+        memcpy(&best, base + (from * stride), sizeof(UT)); \
+        best = (UT)(DA_KEY_ORDER(UT, best) ^ invert); \
+        \
+        for (i = from + 1; i < to; i++) \
+        { \
+            memcpy(&value, base + (i * stride), sizeof(UT)); \
+            value = (UT)(DA_KEY_ORDER(UT, value) ^ invert); \
+            index = (value < best) ? i : index; \
+            best = (value < best) ? value : best; \
+        } \
+        \
+        return index; \
+    }
+
+/**
+ * @brief The function returns the index of the first smallest or largest numeric field in [@p from, @p to).
+ *
+ * @param[in] da     Search this array.
+ * @param[in] type   Type of the field.
+ * @param[in] offset Offset of the field within each element.
+ * @param[in] from   First element (0 based).
+ * @param[in] to     Element behind the last one, greater than @p from.
+ * @param[in] max    1 to search the largest value, 0 to search the smallest one.
+ *
+ * @returns The index of the value.
+ */
+static size_t daArgMin(const DaStruct *da, int type, size_t offset, size_t from, size_t to, int max)
+{
+    const char *base;
+    size_t stride;
+    size_t index;
+    size_t i;
+    int kind;
+    int c;
+
+    base = (const char *)da->firstAddr + offset;
+    stride = da->bytesPerElement;
+    kind = type & ~0xff;
+    index = from;
+
+    switch (daKeyWidth(type))
+    {
+    case 1:
+        DA_ARGMIN_TYPED(unsigned char)
+
+    case 2:
+        if (sizeof(unsigned short) == 2)
+        DA_ARGMIN_TYPED(unsigned short)
+        break;
+
+    case 4:
+        if (sizeof(unsigned int) == 4)
+        DA_ARGMIN_TYPED(unsigned int)
+        break;
+
+    default:
+        if (sizeof(unsigned long) == 8)
+        DA_ARGMIN_TYPED(unsigned long)
+        break;
+    }
+
+    /* No unsigned integer of the field width */
+    for (i = from + 1; i < to; i++)
+    {
+        c = daKeyCompare(type, base + (i * stride), base + (index * stride));
+        index = (max ? c > 0 : c < 0) ? i : index;
+    }
+
+    return index;
+}
+
+/**
+ * @brief The function is executed by every thread of a parallel reduction.
+ *
+ * @param[in] job The reduction job.
+ */
+static void daNumericWorker(DaJob *job)
+{
+    DaNumericJob *numeric;
+    DaSum part;
+    const char *base;
+    size_t block;
+    size_t from;
+    size_t to;
+    size_t index;
+    int c;
+
+    numeric = (DaNumericJob *)job;
+    base = (const char *)numeric->da->firstAddr + numeric->offset;
+
+    while (daJobClaim(job, &block))
+    {
+        from = numeric->from + (block * numeric->blockElements);
+        to = (numeric->to - from > numeric->blockElements) ? from + numeric->blockElements : numeric->to;
+
+        if (numeric->sum)
+        {
+            memset(&part, 0, sizeof(part));
+            daSumRange(numeric->da, numeric->type, numeric->offset, from, to, &part);
+
+            daJobLock(job);
+            daSumMerge(&numeric->acc, &part);
+            daJobUnlock(job);
+            continue;
+        }
+
+        index = daArgMin(numeric->da, numeric->type, numeric->offset, from, to, numeric->max);
+
+        daJobLock(job);
+        if (numeric->best == DA_NPOS)
+        {
+            numeric->best = index;
+        }
+        else
+        {
+            /* Equal values keep the lower index */
+            c = daKeyCompare(numeric->type, base + (index * numeric->da->bytesPerElement),
+                             base + (numeric->best * numeric->da->bytesPerElement));
+
+            if ((numeric->max ? c > 0 : c < 0) || (c == 0 && index < numeric->best))
+            {
+                numeric->best = index;
+            }
+        }
+        daJobUnlock(job);
+    }
+}
+
+/**
+ * @brief The function reduces the numeric field of the elements in [@p from, @p to) with up to @p threads threads.
+ *
+ * @param[in]  da      Reduce the elements of this array.
+ * @param[in]  type    Type of the field.
+ * @param[in]  offset  Offset of the field within each element.
+ * @param[in]  from    First element (0 based).
+ * @param[in]  to      Element behind the last one, greater than @p from.
+ * @param[in]  threads Maximum number of threads.
+ * @param[in]  max     1 to search the largest value, 0 to search the smallest one.
+ * @param[out] acc     Receives the sum or a NULL pointer to search the smallest or largest value.
+ *
+ * @returns The index of the smallest or largest value if @p acc is a NULL pointer.
+ */
+static size_t daNumeric(const DaStruct *da, int type, size_t offset, size_t from, size_t to, size_t threads, int max, DaSum *acc)
+{
+    DaNumericJob numeric;
+
+    if (threads < 2 || (to - from) * da->bytesPerElement < DA_PARALLEL_THRESHOLD)
+    {
+        if (!acc)
+        {
+            return daArgMin(da, type, offset, from, to, max);
+        }
+
+        memset(acc, 0, sizeof(DaSum));
+        daSumRange(da, type, offset, from, to, acc);
+        return 0;
+    }
+
+    numeric.blockElements = DA_PARALLEL_BLOCK / da->bytesPerElement;
+    numeric.blockElements = (numeric.blockElements == 0) ? 1 : numeric.blockElements;
+
+    numeric.job.run = daNumericWorker;
+    numeric.job.next = 0;
+    numeric.job.blocks = (to - from + numeric.blockElements - 1) / numeric.blockElements;
+    numeric.da = da;
+    numeric.type = type;
+    numeric.offset = offset;
+    numeric.from = from;
+    numeric.to = to;
+    numeric.max = max;
+    numeric.sum = acc != NULL;
+    numeric.best = DA_NPOS;
+    memset(&numeric.acc, 0, sizeof(DaSum));
+
+    daParallelRun(&numeric.job, threads);
+
+    if (acc)
+    {
+        *acc = numeric.acc;
+    }
+
+    return numeric.best;
+}
+
+/**
+ * @brief The function checks the parameters of the reductions of a numeric field.
+ *
+ * @param[in]  da     The array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  type   Type of the field.
+ * @param[in]  offset Offset of the field within each element.
+ * @param[in]  from   First element of the range.
+ * @param[in]  to     Last element of the range.
+ *
+ * @returns The function returns 0 if the parameters are valid and -1 otherwise.
+ */
+static int daRangeNotValid(const DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to)
+{
+    if (daTypeNotValid(da, err, type, offset))
+    {
+        return -1;
+    }
+    else if (from > to || to >= da->used)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief The function implements daMinParallel() and daMaxParallel().
+ *
+ * @param[in]  da      Search this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  type    Type of the field.
+ * @param[in]  offset  Offset of the field within each element.
+ * @param[in]  from    First element of the range.
+ * @param[in]  to      Last element of the range.
+ * @param[out] value   Receives the value or a NULL pointer.
+ * @param[out] index   Receives the index or a NULL pointer.
+ * @param[in]  threads Maximum number of threads.
+ * @param[in]  max     1 to search the largest value, 0 to search the smallest one.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ */
+static int daMinMax(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, void *value, size_t *index, size_t threads, int max)
+{
+    size_t best;
+
+    if (daRangeNotValid(da, err, type, offset, from, to))
+    {
+        return -1;
+    }
+    else if (!value && !index)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    best = daNumeric(da, type, offset, from, to + 1, threads, max, NULL);
+
+    if (value)
+    {
+        memcpy(value, (char *)da->firstAddr + (best * da->bytesPerElement) + offset, daKeyWidth(type));
+    }
+
+    if (index)
+    {
+        *index = best;
+    }
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daMin(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, void *value, size_t *index)
+{
+    return daMinMax(da, err, type, offset, from, to, value, index, 1, 0);
+}
+
+int daMinParallel(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, void *value, size_t *index, size_t threads)
+{
+    return daMinMax(da, err, type, offset, from, to, value, index, threads, 0);
+}
+
+int daMax(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, void *value, size_t *index)
+{
+    return daMinMax(da, err, type, offset, from, to, value, index, 1, 1);
+}
+
+int daMaxParallel(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, void *value, size_t *index, size_t threads)
+{
+    return daMinMax(da, err, type, offset, from, to, value, index, threads, 1);
+}
+
+int daSum(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, double *sum)
+{
+    return daSumParallel(da, err, type, offset, from, to, sum, 1);
+}
+
+int daSumParallel(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, double *sum, size_t threads)
+{
+    DaSum acc;
+
+    if (daRangeNotValid(da, err, type, offset, from, to))
+    {
+        return -1;
+    }
+    else if (!sum)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    daNumeric(da, type, offset, from, to + 1, threads, 0, &acc);
+    *sum = daSumValue(&acc);
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daSumLong(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, long *sum)
+{
+    return daSumLongParallel(da, err, type, offset, from, to, sum, 1);
+}
+
+int daSumLongParallel(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, long *sum, size_t threads)
+{
+    DaSum acc;
+
+    if (daRangeNotValid(da, err, type, offset, from, to))
+    {
+        return -1;
+    }
+    else if (!sum)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+    else if ((type & ~0xff) == DA_KEY_FLOAT)
+    {
+        *err = DA_PARAM_ERR | DA_UNKNOWN_MODE;
+        return -1;
+    }
+
+    daNumeric(da, type, offset, from, to + 1, threads, 0, &acc);
+
+    if (daSumLongValue(&acc, sum) != 0)
+    {
+        *err = DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT;
+        return -1;
+    }
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daMean(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, double *mean)
+{
+    return daMeanParallel(da, err, type, offset, from, to, mean, 1);
+}
+
+int daMeanParallel(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, double *mean, size_t threads)
+{
+    if (daSumParallel(da, err, type, offset, from, to, mean, threads) != 0)
+    {
+        return -1;
+    }
+
+    *mean /= (double)(to - from + 1);
+    return 0;
+}
+
+/**
+ * @brief The structure describes a parallel traversal by daMapInPlaceParallel() or daReduceParallel().
+ */
+typedef struct str_da_traverse_job
+{
+    /**
+     * Common job header.
+     */
+    DaJob job;
+
+    /**
+     * Traverse this array.
+     */
+    DaStruct *da;
+
+    /**
+     * Number of elements per block.
+     */
+    size_t blockElements;
+
+    /**
+     * Changes a block or NULL for a reduction.
+     */
+    DaBlockMapper map;
+
+    /**
+     * Folds a block or NULL for a mapping.
+     */
+    DaBlockReducer reduce;
+
+    /**
+     * Passed to the callback.
+     */
+    void *ctx;
+
+    /**
+     * One accumulator per block for a reduction.
+     */
+    char *partials;
+
+    /**
+     * Size of an accumulator in bytes.
+     */
+    size_t accBytes;
+
+} DaTraverseJob;
+
+/**
+ * @brief The function returns the number of elements of the blocks passed to the traversal callbacks.
+ *
+ * @param[in] da The traversed array.
+ *
+ * @returns Number of elements per block, at least 1.
+ */
+static size_t daTraverseBlock(const DaStruct *da)
+{
+    size_t n;
+
+    n = DA_PARALLEL_BLOCK / da->bytesPerElement;
+
+    return (n == 0) ? 1 : n;
+}
+
+/**
+ * @brief The function is executed by every thread of a parallel traversal.
+ *
+ * @param[in] job The traversal job.
+ */
+static void daTraverseWorker(DaJob *job)
+{
+    DaTraverseJob *traverse;
+    char *elements;
+    size_t block;
+    size_t from;
+    size_t n;
+
+    traverse = (DaTraverseJob *)job;
+
+    while (daJobClaim(job, &block))
+    {
+        from = block * traverse->blockElements;
+        n = (traverse->da->used - from > traverse->blockElements) ? traverse->blockElements : traverse->da->used - from;
+        elements = (char *)traverse->da->firstAddr + (from * traverse->da->bytesPerElement);
+
+        if (traverse->map)
+        {
+            traverse->map(elements, n, from, traverse->ctx);
+        }
+        else
+        {
+            traverse->reduce(elements, n, from, traverse->partials + (block * traverse->accBytes), traverse->ctx);
+        }
+    }
+}
+
+int daForEach(DaStruct *da, int *err, DaBlockVisitor visit, void *ctx)
+{
+    size_t step;
+    size_t pos;
+    size_t n;
+
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (!visit)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    step = daTraverseBlock(da);
+    *err = DA_OK;
+
+    for (pos = 0; pos < da->used; pos += n)
+    {
+        n = (da->used - pos > step) ? step : da->used - pos;
+
+        if (visit((char *)da->firstAddr + (pos * da->bytesPerElement), n, pos, ctx) != 0)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int daMapInPlace(DaStruct *da, int *err, DaBlockMapper map, void *ctx)
+{
+    return daMapInPlaceParallel(da, err, map, ctx, 1);
+}
+
+int daMapInPlaceParallel(DaStruct *da, int *err, DaBlockMapper map, void *ctx, size_t threads)
+{
+    DaTraverseJob traverse;
+
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (!map)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    if (da->used > 0)
+    {
+        traverse.blockElements = daTraverseBlock(da);
+
+        traverse.job.run = daTraverseWorker;
+        traverse.job.next = 0;
+        traverse.job.blocks = (da->used + traverse.blockElements - 1) / traverse.blockElements;
+        traverse.da = da;
+        traverse.map = map;
+        traverse.reduce = NULL;
+        traverse.ctx = ctx;
+        traverse.partials = NULL;
+        traverse.accBytes = 0;
+
+        if (da->used * da->bytesPerElement < DA_PARALLEL_THRESHOLD)
+        {
+            threads = 1;
+        }
+
+        daParallelRun(&traverse.job, threads);
+        daSidecarRebuild(da);
+    }
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daReduce(DaStruct *da, int *err, DaBlockReducer reduce, void *acc, void *ctx)
+{
+    size_t step;
+    size_t pos;
+    size_t n;
+
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (!reduce || !acc)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    step = daTraverseBlock(da);
+
+    for (pos = 0; pos < da->used; pos += n)
+    {
+        n = (da->used - pos > step) ? step : da->used - pos;
+        reduce((char *)da->firstAddr + (pos * da->bytesPerElement), n, pos, acc, ctx);
+    }
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daReduceParallel(DaStruct *da, int *err, DaBlockReducer reduce, DaCombine combine, void *acc, size_t accBytes, void *ctx, size_t threads)
+{
+    DaTraverseJob traverse;
+    size_t i;
+
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (!reduce || !combine || !acc || accBytes == 0)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    if (threads < 2 || da->used * da->bytesPerElement < DA_PARALLEL_THRESHOLD)
+    {
+        return daReduce(da, err, reduce, acc, ctx);
+    }
+
+    traverse.blockElements = daTraverseBlock(da);
+
+    traverse.job.run = daTraverseWorker;
+    traverse.job.next = 0;
+    traverse.job.blocks = (da->used + traverse.blockElements - 1) / traverse.blockElements;
+    traverse.da = da;
+    traverse.map = NULL;
+    traverse.reduce = reduce;
+    traverse.ctx = ctx;
+    traverse.accBytes = accBytes;
+
+    if (traverse.job.blocks > (size_t)-1 / accBytes || !(traverse.partials = malloc(traverse.job.blocks * accBytes)))
+    {
+        return daReduce(da, err, reduce, acc, ctx);
+    }
+
+    /* Every block starts from the identity */
+    for (i = 0; i < traverse.job.blocks; i++)
+    {
+        memcpy(traverse.partials + (i * accBytes), acc, accBytes);
+    }
+
+    daParallelRun(&traverse.job, threads);
+
+    for (i = 0; i < traverse.job.blocks; i++)
+    {
+        combine(acc, traverse.partials + (i * accBytes), ctx);
+    }
+
+    free(traverse.partials);
+
+    *err = DA_OK;
+    return 0;
+}
+
+/**
+ * @brief The function checks a view and sets up an array header that covers the elements of the view.
+ *
+ * The header borrows the elements of the base array and has neither a hash index nor a Bloom filter, so the
+ * functions for arrays can work on the view. It must only be passed to functions that don't modify the array.
+ *
+ * @param[in]  view   Check this view.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[out] shadow Receives the header.
+ *
+ * @returns The function returns 0 if the view is valid and -1 otherwise.
+ */
+static int daViewNotValid(const DaView *view, int *err, DaStruct *shadow)
+{
+    const DaStruct *base;
+
+    if (!err)
+    {
+        return -1;
+    }
+    else if (!view)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    base = view->base;
+
+    if (paramNotValid(base, err))
+    {
+        return -1;
+    }
+    else if (view->length > base->used || view->offset > base->used - view->length)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return -1;
+    }
+
+    *shadow = *base;
+    shadow->firstAddr = (char *)base->firstAddr + (view->offset * base->bytesPerElement);
+    shadow->used = view->length;
+    shadow->max = view->length;
+    shadow->index = NULL;
+    shadow->bloom = NULL;
+
+    return 0;
+}
+
+int daView(DaStruct *da, int *err, size_t pos, size_t n, DaView *view)
+{
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (!view)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+    else if (n > da->used || pos > da->used - n)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return -1;
+    }
+
+    view->base = da;
+    view->offset = pos;
+    view->length = n;
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daViewSlice(const DaView *view, int *err, size_t pos, size_t n, DaView *out)
+{
+    DaStruct shadow;
+
+    if (daViewNotValid(view, err, &shadow))
+    {
+        return -1;
+    }
+    else if (!out)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+    else if (n > view->length || pos > view->length - n)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return -1;
+    }
+
+    out->base = view->base;
+    out->offset = view->offset + pos;
+    out->length = n;
+
+    *err = DA_OK;
+    return 0;
+}
+
+size_t daViewSize(const DaView *view, int *err)
+{
+    DaStruct shadow;
+
+    if (daViewNotValid(view, err, &shadow))
+    {
+        return 0;
+    }
+
+    *err = DA_OK;
+    return shadow.used;
+}
+
+void *daViewGet(const DaView *view, int *err, size_t pos)
+{
+    DaStruct shadow;
+
+    if (daViewNotValid(view, err, &shadow))
+    {
+        return NULL;
+    }
+
+    return daGet(&shadow, err, pos);
+}
+
+int daViewContains(const DaView *view, int *err, const void *element)
+{
+    DaStruct shadow;
+
+    if (daViewNotValid(view, err, &shadow))
+    {
+        return -1;
+    }
+
+    return daContains(&shadow, err, element);
+}
+
+int daViewIndexOf(const DaView *view, int *err, const void *element, size_t *index)
+{
+    DaStruct shadow;
+
+    if (daViewNotValid(view, err, &shadow))
+    {
+        return -1;
+    }
+
+    return daIndexOf(&shadow, err, element, index);
+}
+
+int daViewLastIndexOf(const DaView *view, int *err, const void *element, size_t *index)
+{
+    DaStruct shadow;
+
+    if (daViewNotValid(view, err, &shadow))
+    {
+        return -1;
+    }
+
+    return daLastIndexOf(&shadow, err, element, index);
+}
+
+int daViewCount(const DaView *view, int *err, const void *element, size_t *count)
+{
+    DaStruct shadow;
+
+    if (daViewNotValid(view, err, &shadow))
+    {
+        return -1;
+    }
+
+    return daCount(&shadow, err, element, count);
+}
+
+int daViewLowerBound(const DaView *view, int *err, const void *key, DaCompare cmp, size_t *index)
+{
+    DaStruct shadow;
+
+    if (daViewNotValid(view, err, &shadow))
+    {
+        return -1;
+    }
+
+    return daLowerBound(&shadow, err, key, cmp, index);
+}
+
+int daViewBinarySearch(const DaView *view, int *err, const void *key, DaCompare cmp, size_t *index)
+{
+    DaStruct shadow;
+
+    if (daViewNotValid(view, err, &shadow))
+    {
+        return -1;
+    }
+
+    return daBinarySearch(&shadow, err, key, cmp, index);
+}
+
+int daViewMin(const DaView *view, int *err, int type, size_t offset, void *value, size_t *index)
+{
+    DaStruct shadow;
+
+    if (daViewNotValid(view, err, &shadow))
+    {
+        return -1;
+    }
+    else if (shadow.used > 0)
+    {
+        return daMin(&shadow, err, type, offset, 0, shadow.used - 1, value, index);
+    }
+    else if (daTypeNotValid(&shadow, err, type, offset))
+    {
+        return -1;
+    }
+    else if (!value && !index)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    /* An empty view has no smallest value */
+    *err = DA_NOT_FOUND;
+    return 0;
+}
+
+int daViewMax(const DaView *view, int *err, int type, size_t offset, void *value, size_t *index)
+{
+    DaStruct shadow;
+
+    if (daViewNotValid(view, err, &shadow))
+    {
+        return -1;
+    }
+    else if (shadow.used > 0)
+    {
+        return daMax(&shadow, err, type, offset, 0, shadow.used - 1, value, index);
+    }
+    else if (daTypeNotValid(&shadow, err, type, offset))
+    {
+        return -1;
+    }
+    else if (!value && !index)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    /* An empty view has no largest value */
+    *err = DA_NOT_FOUND;
+    return 0;
+}
+
+int daViewSum(const DaView *view, int *err, int type, size_t offset, double *sum)
+{
+    DaStruct shadow;
+
+    if (daViewNotValid(view, err, &shadow))
+    {
+        return -1;
+    }
+    else if (shadow.used > 0)
+    {
+        return daSum(&shadow, err, type, offset, 0, shadow.used - 1, sum);
+    }
+    else if (daTypeNotValid(&shadow, err, type, offset))
+    {
+        return -1;
+    }
+    else if (!sum)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    *sum = 0.0;
+
+    *err = DA_OK;
+    return 0;
+}
+
+int daViewMean(const DaView *view, int *err, int type, size_t offset, double *mean)
+{
+    DaStruct shadow;
+
+    if (daViewNotValid(view, err, &shadow))
+    {
+        return -1;
+    }
+    else if (shadow.used > 0)
+    {
+        return daMean(&shadow, err, type, offset, 0, shadow.used - 1, mean);
+    }
+    else if (daTypeNotValid(&shadow, err, type, offset))
+    {
+        return -1;
+    }
+    else if (!mean)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    /* The mean of no elements is undefined */
+    *err = DA_NOT_FOUND;
+    return 0;
+}
+
+int daViewForEach(const DaView *view, int *err, DaBlockVisitor visit, void *ctx)
+{
+    DaStruct shadow;
+
+    if (daViewNotValid(view, err, &shadow))
+    {
+        return -1;
+    }
+
+    return daForEach(&shadow, err, visit, ctx);
+}
+
+int daViewReduce(const DaView *view, int *err, DaBlockReducer reduce, void *acc, void *ctx)
+{
+    DaStruct shadow;
+
+    if (daViewNotValid(view, err, &shadow))
+    {
+        return -1;
+    }
+
+    return daReduce(&shadow, err, reduce, acc, ctx);
+}
+
+DaStruct *daClone(const DaStruct *da, int *err)
+{
+    DaDesc desc;
+    DaStruct *clone;
+
+    if (paramNotValid(da, err))
+    {
+        return NULL;
+    }
+
+    desc.elements = da->max;
+    desc.bytesPerElement = da->bytesPerElement;
+    desc.maxBytes = da->maxBytes;
+
+    clone = daCreate(&desc, err);
+
+    if (clone)
+    {
+        clone->used = da->used;
+        memcpy(clone->firstAddr, da->firstAddr, clone->used * clone->bytesPerElement);
+    }
+
+    return clone;
+}
+
+int daConcat(DaStruct *dst, int *err, DaStruct *src)
+{
+    void *buffer;
+    size_t max;
+    size_t n;
+
+    if (paramNotValid(dst, err) || paramNotValid(src, err))
+    {
+        return -1;
+    }
+    else if (dst == src || dst->bytesPerElement != src->bytesPerElement)
+    {
+        *err = DA_PARAM_ERR | DA_INCOMPATIBLE;
+        return -1;
+    }
+
+    n = src->used;
+
+    if (dst->used == 0 && src->max <= dst->maxBytes / dst->bytesPerElement && dst->max <= src->maxBytes / src->bytesPerElement)
+    {
+        /* Both buffers fit into the other array, so they can be swapped */
+        buffer = dst->firstAddr;
+        max = dst->max;
+        dst->firstAddr = src->firstAddr;
+        dst->max = src->max;
+        src->firstAddr = buffer;
+        src->max = max;
+
+        daSidecarClear(dst);
+        dst->used = n;
+        daSidecarInsert(dst, 0, n, 1);
+    }
+    else
+    {
+        if (daReserve(dst, err, n) != 0)
+        {
+            return -1;
+        }
+
+        memcpy((char *)dst->firstAddr + (dst->used * dst->bytesPerElement), src->firstAddr, n * src->bytesPerElement);
+        dst->used += n;
+        daSidecarInsert(dst, dst->used - n, n, 1);
+    }
+
+    src->used = 0;
+    daSidecarClear(src);
+
+    *err = DA_OK;
+    return 0;
+}
+
+DaStruct *daSplitAt(DaStruct *da, int *err, size_t pos)
+{
+    DaDesc desc;
+    DaStruct *tail;
+    size_t n;
+
+    if (paramNotValid(da, err))
+    {
+        return NULL;
+    }
+    else if (pos > da->used)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return NULL;
+    }
+
+    n = da->used - pos;
+
+    desc.elements = (n > 0) ? n : 1;
+    desc.bytesPerElement = da->bytesPerElement;
+    desc.maxBytes = da->maxBytes;
+
+    if (!(tail = daCreate(&desc, err)))
+    {
+        return NULL;
+    }
+
+    memcpy(tail->firstAddr, (char *)da->firstAddr + (pos * da->bytesPerElement), n * da->bytesPerElement);
+    tail->used = n;
+
+    daSidecarRemove(da, pos, n, 1);
+    da->used = pos;
+
+    *err = DA_OK;
+    return tail;
+}
+
+void *daCopyRange(DaStruct *dst, int *err, size_t dstPos, const DaStruct *src, size_t from, size_t to)
+{
+    const char *first;
+    char *ret;
+    size_t extra;
+    size_t kept;
+    size_t n;
+
+    if (paramNotValid(dst, err) || paramNotValid(src, err))
+    {
+        return NULL;
+    }
+    else if (dst->bytesPerElement != src->bytesPerElement)
+    {
+        *err = DA_PARAM_ERR | DA_INCOMPATIBLE;
+        return NULL;
+    }
+    else if (from > to || to >= src->used || dstPos > dst->used)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return NULL;
+    }
+
+    n = to - from + 1;
+    kept = dst->used - dstPos;
+    extra = (n > kept) ? n - kept : 0;
+
+    /* src may be dst, so its address gets taken after growing */
+    if (extra > 0 && daReserve(dst, err, extra) != 0)
+    {
+        return NULL;
+    }
+
+    first = (const char *)src->firstAddr + (from * src->bytesPerElement);
+    ret = (char *)dst->firstAddr + (dstPos * dst->bytesPerElement);
+
+    /* The overwritten elements leave the index and the filter before the copy, the copied ones join afterwards */
+    daSidecarRemove(dst, dstPos, n - extra, 0);
+
+    memmove(ret, first, n * dst->bytesPerElement);
+    dst->used += extra;
+    daSidecarInsert(dst, dstPos, n, 0);
+
+    *err = DA_OK;
+    return ret;
+}
+
+int daIndexAttach(DaStruct *da, int *err, size_t maxBytes)
+{
+    struct str_da_index *ix;
+
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (maxBytes == 0)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    ix = calloc(1, sizeof(struct str_da_index));
+
+    if (!ix)
+    {
+        *err = DA_FATAL | DA_ENOMEM;
+        return -1;
+    }
+
+    ix->maxBytes = maxBytes;
+
+    if (daIndexSlots(da->used) > maxBytes / sizeof(DaIndexEntry))
+    {
+        free(ix);
+        *err = DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT;
+        return -1;
+    }
+
+    daIndexDetach(da, err);
+    da->index = ix;
+
+    /* The table of a new index gets built like the one of a suspended index */
+    if (!daIndexRebuild(da))
+    {
+        daIndexDetach(da, err);
+        *err = DA_FATAL | DA_ENOMEM;
+        return -1;
+    }
+
+    *err = DA_OK;
+    return 0;
+}
 
+int daIndexDetach(DaStruct *da, int *err)
+{
     if (paramNotValid(da, err))
     {
         return -1;
     }
 
-    newArray = NULL;
-    bytes = da->max * da->bytesPerElement;
+    if (da->index)
+    {
+        free(da->index->entries);
+        free(da->index);
+        da->index = NULL;
+    }
 
-    if (bytes == da->maxBytes)
+    *err = DA_OK;
+    return 0;
+}
+
+int daBloomAttach(DaStruct *da, int *err, size_t bitsPerElement, size_t maxBytes)
+{
+    struct str_da_bloom *bl;
+    size_t blocks;
+
+    if (paramNotValid(da, err))
     {
-        *err = DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT;
         return -1;
     }
-    else if (bytes <= (da->maxBytes / 2))
+    else if (bitsPerElement == 0 || maxBytes == 0)
     {
-        /* Enough room to double the array space */
-        nrElements = da->max * 2;
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
     }
-    else
+
+    blocks = daBloomBlocks((da->used < 32) ? 64 : 2 * da->used, bitsPerElement);
+
+    if (blocks == 0 || blocks > maxBytes / DA_BLOOM_BLOCK)
     {
-        /* Calculate maximum possible number of elements for this array */
-        nrElements = da->maxBytes / da->bytesPerElement;
+        *err = DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT;
+        return -1;
     }
 
-    if (nrElements <= da->max || (nrElements * da->bytesPerElement) > da->maxBytes)
+    bl = calloc(1, sizeof(struct str_da_bloom));
+
+    if (!bl)
     {
-        *err = DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT;
+        *err = DA_FATAL | DA_ENOMEM;
         return -1;
     }
 
-    newArray = calloc(1, nrElements * da->bytesPerElement);
+    /* About ln(2) bits per element are set, at least one, at most 16 */
+    bl->bitsPerElement = bitsPerElement;
+    bl->hashes = (bitsPerElement * 69 + 50) / 100;
+    bl->hashes = (bl->hashes < 1) ? 1 : ((bl->hashes > 16) ? 16 : bl->hashes);
+    bl->maxBytes = maxBytes;
 
-    if (!newArray)
+    daBloomDetach(da, err);
+    da->bloom = bl;
+
+    /* The filter gets built like a suspended one */
+    if (!daBloomRebuild(da))
     {
+        daBloomDetach(da, err);
         *err = DA_FATAL | DA_ENOMEM;
         return -1;
     }
 
-    memcpy(newArray, da->firstAddr, da->used * da->bytesPerElement);
+    bl->rebuilds = 0;
 
-    free(da->firstAddr);
+    *err = DA_OK;
+    return 0;
+}
 
-    da->firstAddr = newArray;
-    da->max = nrElements;
+int daBloomDetach(DaStruct *da, int *err)
+{
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+
+    if (da->bloom)
+    {
+        free(da->bloom->bits);
+        free(da->bloom);
+        da->bloom = NULL;
+    }
 
     *err = DA_OK;
     return 0;
 }
 
-DaStruct *daCreate(DaDesc *desc, int *err)
+int daBloomTrack(DaStruct *da, int *err, int enable)
 {
-    DaStruct *da;
-    da = NULL;
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
 
-    if (!err)
+    if (!da->bloom)
     {
-        return NULL;
+        *err = DA_NOT_FOUND;
+        return 0;
     }
-    else if (!desc)
+
+    da->bloom->track = enable != 0;
+
+    *err = DA_OK;
+    return 1;
+}
+
+int daBloomStats(DaStruct *da, int *err, DaBloomStats *stats)
+{
+    const struct str_da_bloom *bl;
+    size_t set;
+    size_t i;
+    size_t j;
+
+    if (paramNotValid(da, err))
+    {
+        return -1;
+    }
+    else if (!stats)
     {
         *err = DA_PARAM_ERR | DA_PARAM_NULL;
-        return NULL;
+        return -1;
     }
 
-    if (desc->elements == 0 || desc->bytesPerElement == 0 || desc->maxBytes == 0)
+    memset(stats, 0, sizeof(DaBloomStats));
+
+    if (!(bl = da->bloom))
     {
-        *err = DA_PARAM_ERR | DA_PARAM_NULL;
-        return NULL;
+        *err = DA_NOT_FOUND;
+        return 0;
     }
-    else if (desc->elements * desc->bytesPerElement > desc->maxBytes)
+
+    stats->elements = bl->elements;
+    stats->stale = bl->stale;
+    stats->rebuilds = bl->rebuilds;
+    stats->lookups = bl->lookups;
+    stats->rejected = bl->rejected;
+    stats->falsePositives = bl->falsePositives;
+
+    if (bl->bits)
     {
-        *err = DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT;
-        return NULL;
+        stats->bytes = bl->blocks * DA_BLOOM_BLOCK;
+
+        for (i = 0, set = 0; i < stats->bytes; i++)
+        {
+            for (j = bl->bits[i]; j; j &= j - 1)
+            {
+                set++;
+            }
+        }
+
+        /* A lookup passes if all its bits are set */
+        stats->expectedRate = 1.0;
+        for (i = 0; i < bl->hashes; i++)
+        {
+            stats->expectedRate *= (double)set / (double)(stats->bytes * 8);
+        }
     }
 
-    da = calloc(1, sizeof(DaStruct));
+    *err = DA_OK;
+    return 1;
+}
 
-    if (!da)
+int daRemove(DaStruct *da, int *err, size_t pos)
+{
+    void *dst;
+    void *src;
+    size_t bytes;
+
+    if (paramNotValid(da, err))
     {
-        goto err;
+        return -1;
     }
 
-    da->magic = DA_MAGIC;
-    da->firstAddr = calloc(1, desc->elements * desc->bytesPerElement);
+    if (pos >= da->used)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return -1;
+    }
 
-    if (!da->firstAddr)
+    daSidecarRemove(da, pos, 1, 1);
+
+    /* Move memory if it's not the last remaining or endmost element */
+    if (da->used > 1 && pos < da->used - 1)
     {
-        goto err;
+        dst = (char *)da->firstAddr + (pos * da->bytesPerElement);
+        src = (char *)dst + da->bytesPerElement;
+        bytes = (da->used - 1 - pos) * da->bytesPerElement;
+
+        memmove(dst, src, bytes);
     }
 
-    da->used = 0;
-    da->max = desc->elements;
-    da->bytesPerElement = desc->bytesPerElement;
-    da->maxBytes = desc->maxBytes;
+    da->used--;
 
     *err = DA_OK;
-    return da;
+    return 0;
+}
 
-err:
+int daRemoveDirty(DaStruct *da, int *err, size_t pos)
+{
+    void *dst;
+    void *src;
 
-    if (da)
+    if (paramNotValid(da, err))
     {
-        da->magic = 0;
-        free(da->firstAddr);
-        free(da);
+        return -1;
     }
 
-    *err = DA_FATAL | DA_ENOMEM;
-    return NULL;
+    if (pos >= da->used)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return -1;
+    }
+
+    /* Only the last element moves, so the other entries keep their positions */
+    daSidecarRemove(da, pos, 1, 0);
+
+    /* Move memory if it's not the last remaining or endmost element */
+    if (da->used > 1 && pos < da->used - 1)
+    {
+        daSidecarMove(da, da->used - 1, pos);
+
+        dst = (char *)da->firstAddr + (pos * da->bytesPerElement);
+        src = (char *)da->firstAddr + ((da->used - 1) * da->bytesPerElement);
+
+        memcpy(dst, src, da->bytesPerElement);
+    }
+
+    da->used--;
+
+    *err = DA_OK;
+    return 0;
 }
 
-int daDestroy(DaStruct *da, int *err)
+int daRemoveRange(DaStruct *da, int *err, size_t from, size_t to)
 {
+    void *dst;
+    void *src;
+    size_t bytes;
+    size_t elements;
+
     if (paramNotValid(da, err))
     {
         return -1;
     }
 
-    da->magic = 0;
-    memset(da->firstAddr, '0', da->max * da->bytesPerElement);
-    free(da->firstAddr);
-    free(da);
+    if (to >= da->used || from >= da->used || from > to)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return -1;
+    }
 
-    *err = DA_OK;
+    elements = to - from;
+    elements++;
+
+    daSidecarRemove(da, from, elements, 1);
+
+    dst = (char *)da->firstAddr + (from * da->bytesPerElement);
+    src = (char *)dst + (elements * da->bytesPerElement);
+    bytes = (da->used - 1 - to) * da->bytesPerElement;
+
+    memmove(dst, src, bytes);
+
+    da->used -= elements;
+
+    * err = DA_OK;
     return 0;
-}
 
+}
 
-size_t daSize(DaStruct *da, int *err)
+/**
+ * @brief The function implements daRemoveIf(), daRetainIf() and their block variants.
+ *
+ * The elements get tested in blocks of ::DA_PREDICATE_BLOCK elements. A run of kept elements gets moved to the
+ * write position once the next removed element ends it. The runs only move towards the start of the array, so the
+ * elements still to be tested are never overwritten.
+ *
+ * @param[in]  da        Remove the elements from this array.
+ * @param[out] err       Indicates what went wrong in the event of an error.
+ * @param[in]  predicate Tests a single element or NULL if @p block is given.
+ * @param[in]  block     Tests a block of elements or NULL if @p predicate is given.
+ * @param[in]  ctx       Passed to the predicate.
+ * @param[in]  keep      1 to keep the elements satisfying the predicate, 0 to remove them.
+ * @param[out] removed   Number of removed elements or a NULL pointer.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ */
+static int daCompact(DaStruct *da, int *err, DaPredicate predicate, DaBlockPredicate block, void *ctx, int keep, size_t *removed)
 {
+    unsigned char results[DA_PREDICATE_BLOCK];
+    char *base;
+    size_t stride;
+    size_t write;
+    size_t start;
+    size_t length;
+    size_t count;
+    size_t n;
+    size_t i;
+    size_t j;
+
     if (paramNotValid(da, err))
     {
-        return 0;
+        return -1;
+    }
+    else if (!predicate && !block)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
+    }
+
+    base = da->firstAddr;
+    stride = da->bytesPerElement;
+    write = 0;
+    start = 0;
+    length = 0;
+
+    for (i = 0; i < da->used; i += n)
+    {
+        n = (da->used - i < DA_PREDICATE_BLOCK) ? da->used - i : DA_PREDICATE_BLOCK;
+
+        if (block)
+        {
+            block(base + (i * stride), n, results, ctx);
+        }
+        else
+        {
+            for (j = 0; j < n; j++)
+            {
+                results[j] = (unsigned char)(predicate(base + ((i + j) * stride), ctx) != 0);
+            }
+        }
+
+        for (j = 0; j < n; j++)
+        {
+            if ((results[j] != 0) == keep)
+            {
+                start = (length == 0) ? i + j : start;
+                length++;
+                continue;
+            }
+
+            if (length > 0 && start != write)
+            {
+                memmove(base + (write * stride), base + (start * stride), length * stride);
+            }
+
+            write += length;
+            length = 0;
+        }
+    }
+
+    if (length > 0 && start != write)
+    {
+        memmove(base + (write * stride), base + (start * stride), length * stride);
+    }
+
+    write += length;
+    count = da->used - write;
+    da->used = write;
+
+    daSidecarCompact(da, count);
+
+    if (removed)
+    {
+        *removed = count;
     }
 
     *err = DA_OK;
-    return da->used;
+    return 0;
 }
 
+int daRemoveIf(DaStruct *da, int *err, DaPredicate predicate, void *ctx, size_t *removed)
+{
+    return daCompact(da, err, predicate, NULL, ctx, 0, removed);
+}
+
+int daRetainIf(DaStruct *da, int *err, DaPredicate predicate, void *ctx, size_t *removed)
+{
+    return daCompact(da, err, predicate, NULL, ctx, 1, removed);
+}
+
+int daRemoveIfBlock(DaStruct *da, int *err, DaBlockPredicate predicate, void *ctx, size_t *removed)
+{
+    return daCompact(da, err, NULL, predicate, ctx, 0, removed);
+}
+
+int daRetainIfBlock(DaStruct *da, int *err, DaBlockPredicate predicate, void *ctx, size_t *removed)
+{
+    return daCompact(da, err, NULL, predicate, ctx, 1, removed);
+}
+
+/**
+ * @brief The structure holds the predicate of a partition.
+ */
+typedef struct str_da_partition_test
+{
+    /**
+     * Tests a single element or NULL if DaPartitionTest#block is given.
+     */
+    DaPredicate predicate;
+
+    /**
+     * Tests a block of elements or NULL if DaPartitionTest#predicate is given.
+     */
+    DaBlockPredicate block;
 
-int daIsEmpty(DaStruct *da, int *err)
-{
-    if (paramNotValid(da, err))
-    {
-        return -1;
-    }
+    /**
+     * Passed to the predicate.
+     */
+    void *ctx;
 
-    *err = DA_OK;
-    return (da->used > 0) ? 0 : 1;
-}
+} DaPartitionTest;
 
-void *daGet(DaStruct *da, int *err, size_t pos)
+/**
+ * @brief The function tests @p n consecutive elements with the predicate of a partition.
+ *
+ * @param[in]  test    The predicate.
+ * @param[in]  base    First element.
+ * @param[in]  n       Number of elements, at most ::DA_PREDICATE_BLOCK.
+ * @param[in]  stride  Size of an element.
+ * @param[out] results Receives a non-zero value for each element that satisfies the predicate and 0 otherwise.
+ */
+static void daPartitionEvaluate(const DaPartitionTest *test, char *base, size_t n, size_t stride, unsigned char *results)
 {
-    if (paramNotValid(da, err))
+    size_t i;
+
+    if (test->block)
     {
-        return NULL;
+        test->block(base, n, results, test->ctx);
+        return;
     }
 
-    if (pos >= da->used)
+    for (i = 0; i < n; i++)
     {
-        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
-        return NULL;
+        results[i] = (unsigned char)(test->predicate(base + (i * stride), test->ctx) != 0);
     }
-
-    *err = DA_OK;
-    return ((char *)da->firstAddr + (pos * da->bytesPerElement));
 }
 
-void *daGetFirst(DaStruct *da, int *err)
+/**
+ * @brief The function partitions @p n elements whose predicate results are known by swapping misplaced pairs.
+ *
+ * @param[in] base    First element.
+ * @param[in] results Predicate result of each element, they get swapped along with the elements.
+ * @param[in] n       Number of elements.
+ * @param[in] stride  Size of an element.
+ *
+ * @returns Number of elements that satisfy the predicate.
+ */
+static size_t daPartitionKnown(char *base, unsigned char *results, size_t n, size_t stride)
 {
-    if (paramNotValid(da, err))
-    {
-        return NULL;
-    }
+    size_t i;
+    size_t j;
 
-    if (da->used == 0)
+    i = 0;
+    j = n;
+
+    for (;;)
     {
-        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
-        return NULL;
-    }
+        while (i < j && results[i])
+        {
+            i++;
+        }
 
-    *err = DA_OK;
-    return da->firstAddr;
+        while (i < j && !results[j - 1])
+        {
+            j--;
+        }
+
+        if (i >= j)
+        {
+            return i;
+        }
+
+        daSwapBytes(base + (i * stride), base + ((j - 1) * stride), stride);
+        results[i++] = 1;
+        results[--j] = 0;
+    }
 }
 
-void *daGetLast(DaStruct *da, int *err)
+/**
+ * @brief The function partitions @p n elements in place without keeping their order.
+ *
+ * A block of elements gets tested at the front and one at the back of the untested range. The elements of the front
+ * block that don't satisfy the predicate get swapped pairwise with the elements of the back block that do. A block
+ * whose misplaced elements are all swapped gets replaced by the next one. Once the blocks meet, the misplaced
+ * elements left in the last block get partitioned within the block.
+ *
+ * @param[in] base   First element.
+ * @param[in] n      Number of elements.
+ * @param[in] stride Size of an element.
+ * @param[in] test   The predicate.
+ *
+ * @returns Number of elements that satisfy the predicate.
+ */
+static size_t daPartitionUnstable(char *base, size_t n, size_t stride, const DaPartitionTest *test)
 {
-    if (paramNotValid(da, err))
+    unsigned char results[DA_PREDICATE_BLOCK];
+    size_t left[DA_PREDICATE_BLOCK];
+    size_t right[DA_PREDICATE_BLOCK];
+    size_t lo;
+    size_t hi;
+    size_t nl;
+    size_t il;
+    size_t nr;
+    size_t ir;
+    size_t startL;
+    size_t startR;
+    size_t length;
+    size_t lengthL;
+    size_t lengthR;
+    size_t j;
+
+    lo = 0;
+    hi = n;
+    nl = il = nr = ir = 0;
+    startL = startR = lengthL = lengthR = 0;
+
+    for (;;)
     {
-        return NULL;
+        if (il == nl && lo < hi)
+        {
+            length = (hi - lo < DA_PREDICATE_BLOCK) ? hi - lo : DA_PREDICATE_BLOCK;
+            daPartitionEvaluate(test, base + (lo * stride), length, stride, results);
+
+            for (j = 0, nl = 0; j < length; j++)
+            {
+                left[nl] = lo + j;
+                nl += !results[j];
+            }
+
+            il = 0;
+            startL = lo;
+            lengthL = length;
+            lo += length;
+        }
+
+        if (ir == nr && lo < hi)
+        {
+            length = (hi - lo < DA_PREDICATE_BLOCK) ? hi - lo : DA_PREDICATE_BLOCK;
+            hi -= length;
+            daPartitionEvaluate(test, base + (hi * stride), length, stride, results);
+
+            for (j = 0, nr = 0; j < length; j++)
+            {
+                right[nr] = hi + j;
+                nr += results[j] != 0;
+            }
+
+            ir = 0;
+            startR = hi;
+            lengthR = length;
+        }
+
+        while (il < nl && ir < nr)
+        {
+            daSwapBytes(base + (left[il++] * stride), base + (right[ir++] * stride), stride);
+        }
+
+        if (lo >= hi)
+        {
+            break;
+        }
     }
 
-    if (da->used == 0)
+    /* Everything in front of the last block satisfies the predicate, everything behind it doesn't */
+    if (il < nl)
     {
-        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
-        return NULL;
-    }
+        memset(results, 1, lengthL);
 
-    *err = DA_OK;
-    return ((char *)da->firstAddr + ((da->used - 1) * da->bytesPerElement));
-}
+        for (j = il; j < nl; j++)
+        {
+            results[left[j] - startL] = 0;
+        }
 
-int daClear(DaStruct *da, int *err, int mode)
-{
-    if (paramNotValid(da, err))
-    {
-        return -1;
+        return startL + daPartitionKnown(base + (startL * stride), results, lengthL, stride);
     }
 
-    switch (mode)
+    if (ir < nr)
     {
-    case DA_FAST:
-        break;
+        memset(results, 0, lengthR);
 
-    case DA_SECURE:
-        memset(da->firstAddr, '0', da->used * da->bytesPerElement);
-        break;
+        for (j = ir; j < nr; j++)
+        {
+            results[right[j] - startR] = 1;
+        }
 
-    default:
-        *err = (DA_PARAM_ERR | DA_UNKNOWN_MODE);
-        return -1;
-        break;
+        return startR + daPartitionKnown(base + (startR * stride), results, lengthR, stride);
     }
 
-    da->used = 0;
-
-    *err = DA_OK;
-    return 0;
+    return lo;
 }
 
-int daContains(DaStruct *da, int *err, const void *element)
+/**
+ * @brief The function partitions @p n elements stably and moves the ones that don't satisfy the predicate through
+ * the @p scratch buffer.
+ *
+ * The elements that satisfy the predicate only move towards the start, so the elements still to be tested are never
+ * overwritten.
+ *
+ * @param[in] base    First element.
+ * @param[in] n       Number of elements.
+ * @param[in] stride  Size of an element.
+ * @param[in] test    The predicate.
+ * @param[in] scratch Room for @p n elements.
+ *
+ * @returns Number of elements that satisfy the predicate.
+ */
+static size_t daPartitionScratch(char *base, size_t n, size_t stride, const DaPartitionTest *test, char *scratch)
 {
-    int i;
-    int found;
-    char *elementInArray;
+    unsigned char results[DA_PREDICATE_BLOCK];
+    size_t write;
+    size_t parked;
+    size_t length;
+    size_t start;
+    size_t i;
+    size_t j;
 
-    if (paramNotValid(da, err))
+    write = 0;
+    parked = 0;
+
+    for (i = 0; i < n; i += length)
     {
-        return -1;
+        length = (n - i < DA_PREDICATE_BLOCK) ? n - i : DA_PREDICATE_BLOCK;
+        daPartitionEvaluate(test, base + (i * stride), length, stride, results);
+
+        for (j = 0; j < length;)
+        {
+            start = j;
+
+            if (results[j])
+            {
+                while (j < length && results[j])
+                {
+                    j++;
+                }
+
+                if (write != i + start)
+                {
+                    memmove(base + (write * stride), base + ((i + start) * stride), (j - start) * stride);
+                }
+
+                write += j - start;
+            }
+            else
+            {
+                while (j < length && !results[j])
+                {
+                    j++;
+                }
+
+                memcpy(scratch + (parked * stride), base + ((i + start) * stride), (j - start) * stride);
+                parked += j - start;
+            }
+        }
     }
-    else if (!element)
+
+    if (parked > 0)
     {
-        *err = DA_PARAM_ERR | DA_PARAM_NULL;
-        return -1;
+        memcpy(base + (write * stride), scratch, parked * stride);
     }
 
-    *err = DA_NOT_FOUND;
-    found = 0;
+    return write;
+}
 
-    elementInArray = (char *)da->firstAddr;
+/**
+ * @brief The function partitions @p n elements stably without additional memory.
+ *
+ * Each run of elements that satisfy the predicate gets rotated in front of the elements before it that don't.
+ *
+ * @param[in] base   First element.
+ * @param[in] n      Number of elements, at most ::DA_PREDICATE_BLOCK.
+ * @param[in] stride Size of an element.
+ * @param[in] test   The predicate.
+ *
+ * @returns Number of elements that satisfy the predicate.
+ */
+static size_t daPartitionRotate(char *base, size_t n, size_t stride, const DaPartitionTest *test)
+{
+    unsigned char results[DA_PREDICATE_BLOCK];
+    size_t write;
+    size_t start;
+    size_t i;
 
-    for (i = 0; i < da->used; i++)
+    daPartitionEvaluate(test, base, n, stride, results);
+
+    write = 0;
+
+    for (i = 0; i < n;)
     {
-        if (memcmp(elementInArray, element, da->bytesPerElement) == 0)
+        if (!results[i])
+        {
+            i++;
+            continue;
+        }
+
+        for (start = i; i < n && results[i]; i++)
         {
-            *err = DA_OK;
-            found = 1;
-            break;
         }
 
-        elementInArray += da->bytesPerElement;
+        daRotateElements(base + (write * stride), start - write, i - start, stride);
+        write += i - start;
     }
 
-    return found;
+    return write;
 }
 
-void *daSet(DaStruct *da, int *err, const void *element, size_t pos)
+/**
+ * @brief The function partitions @p n elements stably.
+ *
+ * Ranges that fit into the scratch buffer get partitioned through it, otherwise both halves get partitioned
+ * recursively and the elements of the first half that don't satisfy the predicate get rotated behind the ones of
+ * the second half that do.
+ *
+ * @param[in] base     First element.
+ * @param[in] n        Number of elements.
+ * @param[in] stride   Size of an element.
+ * @param[in] test     The predicate.
+ * @param[in] scratch  Scratch buffer or a NULL pointer.
+ * @param[in] capacity Number of elements that fit into the scratch buffer.
+ *
+ * @returns Number of elements that satisfy the predicate.
+ */
+static size_t daPartitionStable(char *base, size_t n, size_t stride, const DaPartitionTest *test, char *scratch, size_t capacity)
 {
-    if (paramNotValid(da, err))
+    size_t half;
+    size_t left;
+    size_t right;
+
+    if (n <= capacity)
     {
-        return NULL;
+        return daPartitionScratch(base, n, stride, test, scratch);
     }
-    else if (!element)
+    else if (n <= DA_PREDICATE_BLOCK)
     {
-        *err = DA_PARAM_ERR | DA_PARAM_NULL;
-        return NULL;
+        return daPartitionRotate(base, n, stride, test);
     }
 
-    if (pos >= da->used)
-    {
-        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
-        return NULL;
-    }
+    half = n / 2;
+    left = daPartitionStable(base, half, stride, test, scratch, capacity);
+    right = daPartitionStable(base + (half * stride), n - half, stride, test, scratch, capacity);
 
-    return memcpy((char *)da->firstAddr + (pos * da->bytesPerElement), element, da->bytesPerElement);
+    daRotateElements(base + (left * stride), half - left, right, stride);
+
+    return left + right;
 }
 
-int daIndexOf(DaStruct *da, int *err, const void *element, size_t *index)
+/**
+ * @brief The function implements daPartition(), daStablePartition() and their block variants.
+ *
+ * @param[in]  da        Partition this array.
+ * @param[out] err       Indicates what went wrong in the event of an error.
+ * @param[in]  predicate Tests a single element or NULL if @p block is given.
+ * @param[in]  block     Tests a block of elements or NULL if @p predicate is given.
+ * @param[in]  ctx       Passed to the predicate.
+ * @param[in]  stable    1 to keep the order within both groups, 0 otherwise.
+ * @param[out] split     Position of the first element that doesn't satisfy the predicate or a NULL pointer.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ */
+static int daPartitionArray(DaStruct *da, int *err, DaPredicate predicate, DaBlockPredicate block, void *ctx, int stable, size_t *split)
 {
-    size_t i;
-    int found;
-    char *elementInArray;
+    DaPartitionTest test;
+    char *scratch;
+    size_t capacity;
+    size_t pos;
 
     if (paramNotValid(da, err))
     {
         return -1;
     }
-    else if (!element || !index)
+    else if (!predicate && !block)
     {
         *err = DA_PARAM_ERR | DA_PARAM_NULL;
         return -1;
     }
 
-    *err = DA_NOT_FOUND;
-    found = 0;
-
-    elementInArray = (char *)da->firstAddr;
+    test.predicate = predicate;
+    test.block = block;
+    test.ctx = ctx;
 
-    for (i = 0; i < da->used; i++)
+    if (stable)
     {
-        if (memcmp(elementInArray, element, da->bytesPerElement) == 0)
+        /* The scratch buffer counts against the bytes limit */
+        capacity = (da->maxBytes - (da->max * da->bytesPerElement)) / da->bytesPerElement;
+        capacity = (da->used < capacity) ? da->used : capacity;
+        scratch = NULL;
+
+        if (capacity > 0 && !(scratch = malloc(capacity * da->bytesPerElement)))
         {
-            *index = i;
-            *err = DA_OK;
-            found = 1;
-            break;
+            capacity = 0;
         }
 
-        elementInArray += da->bytesPerElement;
+        pos = daPartitionStable(da->firstAddr, da->used, da->bytesPerElement, &test, scratch, capacity);
+        free(scratch);
+    }
+    else
+    {
+        pos = daPartitionUnstable(da->firstAddr, da->used, da->bytesPerElement, &test);
+    }
+
+    daSidecarReorder(da);
+
+    if (split)
+    {
+        *split = pos;
     }
 
-    return found;
+    *err = DA_OK;
+    return 0;
 }
 
-int daLastIndexOf(DaStruct *da, int *err, const void *element, size_t *index)
+int daPartition(DaStruct *da, int *err, DaPredicate predicate, void *ctx, size_t *split)
 {
-    size_t i;
-    int found;
-    char *elementInArray;
+    return daPartitionArray(da, err, predicate, NULL, ctx, 0, split);
+}
 
-    if (paramNotValid(da, err))
-    {
-        return -1;
-    }
-    else if (!element || !index)
-    {
-        *err = DA_PARAM_ERR | DA_PARAM_NULL;
-        return -1;
-    }
+int daPartitionBlock(DaStruct *da, int *err, DaBlockPredicate predicate, void *ctx, size_t *split)
+{
+    return daPartitionArray(da, err, NULL, predicate, ctx, 0, split);
+}
 
-    *err = DA_NOT_FOUND;
-    found = 0;
+int daStablePartition(DaStruct *da, int *err, DaPredicate predicate, void *ctx, size_t *split)
+{
+    return daPartitionArray(da, err, predicate, NULL, ctx, 1, split);
+}
 
-    /* Pointer to last element */
-    elementInArray = (char *)da->firstAddr + ((da->used - 1) * da->bytesPerElement);
+int daStablePartitionBlock(DaStruct *da, int *err, DaBlockPredicate predicate, void *ctx, size_t *split)
+{
+    return daPartitionArray(da, err, NULL, predicate, ctx, 1, split);
+}
 
-    if (da->used > 0)
+/**
+ * @brief Comparison function of qsort() for the indexes of daRemoveIndices().
+ */
+static int daCompareIndex(const void *a, const void *b)
+{
+    size_t x;
+    size_t y;
+
+    x = *(const size_t *)a;
+    y = *(const size_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Comparison function of qsort() for the ranges of daRemoveRanges().
+ */
+static int daCompareRange(const void *a, const void *b)
+{
+    return daCompareIndex(&((const DaRange *)a)->from, &((const DaRange *)b)->from);
+}
+
+/**
+ * @brief The function removes the ranges of elements sorted by their first element in a single stable pass.
+ *
+ * The ranges are either given as single @p indices or as @p ranges, they may overlap.
+ * Each run of kept elements gets moved with a single memmove().
+ *
+ * @param[in] da      Remove the elements from this array.
+ * @param[in] indices Sorted positions of single elements or NULL if @p ranges is given.
+ * @param[in] ranges  Ranges sorted by DaRange#from or NULL if @p indices is given.
+ * @param[in] k       Number of positions or ranges.
+ */
+static void daCompactRanges(DaStruct *da, const size_t *indices, const DaRange *ranges, size_t k)
+{
+    char *base;
+    size_t stride;
+    size_t write;
+    size_t read;
+    size_t from;
+    size_t to;
+    size_t j;
+    size_t removed;
+
+    base = da->firstAddr;
+    stride = da->bytesPerElement;
+
+    /* Elements in [write, read) are removed, the ones from read on still have to be checked */
+    write = 0;
+    read = 0;
+
+    for (j = 0; j < k; j++)
     {
-        i = da->used;
+        from = indices ? indices[j] : ranges[j].from;
+        to = indices ? indices[j] : ranges[j].to;
 
-        while (i--)
+        if (to < read)
+        {
+            continue;
+        }
+        else if (from > read)
         {
-            if (memcmp(elementInArray, element, da->bytesPerElement) == 0)
+            if (read != write)
             {
-                *index = i;
-                *err = DA_OK;
-                found = 1;
-                break;
+                memmove(base + (write * stride), base + (read * stride), (from - read) * stride);
             }
 
-            elementInArray -= da->bytesPerElement;
+            write += from - read;
         }
+
+        read = to + 1;
     }
 
-    return found;
+    if (read != write)
+    {
+        memmove(base + (write * stride), base + (read * stride), (da->used - read) * stride);
+    }
+
+    write += da->used - read;
+    removed = da->used - write;
+    da->used = write;
+
+    daSidecarCompact(da, removed);
 }
 
-DaStruct *daClone(const DaStruct *da, int *err)
+int daRemoveIndices(DaStruct *da, int *err, const size_t *indices, size_t k)
 {
-    DaDesc desc;
-    DaStruct *clone;
+    size_t *sorted;
+    size_t j;
+    int ordered;
 
     if (paramNotValid(da, err))
     {
-        return NULL;
+        return -1;
+    }
+    else if (!indices)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return -1;
     }
 
-    desc.elements = da->max;
-    desc.bytesPerElement = da->bytesPerElement;
-    desc.maxBytes = da->maxBytes;
+    for (j = 0, ordered = 1; j < k; j++)
+    {
+        if (indices[j] >= da->used)
+        {
+            *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+            return -1;
+        }
+
+        ordered &= (j == 0 || indices[j - 1] <= indices[j]);
+    }
 
-    clone = daCreate(&desc, err);
+    if (ordered)
+    {
+        daCompactRanges(da, indices, NULL, k);
+        *err = DA_OK;
+        return 0;
+    }
 
-    if (clone)
+    if (!(sorted = malloc(k * sizeof(size_t))))
     {
-        clone->used = da->used;
-        memcpy(clone->firstAddr, da->firstAddr, clone->used * clone->bytesPerElement);
+        *err = DA_FATAL | DA_ENOMEM;
+        return -1;
     }
 
-    return clone;
+    memcpy(sorted, indices, k * sizeof(size_t));
+    qsort(sorted, k, sizeof(size_t), daCompareIndex);
+    daCompactRanges(da, sorted, NULL, k);
+    free(sorted);
+
+    *err = DA_OK;
+    return 0;
 }
 
-int daRemove(DaStruct *da, int *err, size_t pos)
+int daRemoveRanges(DaStruct *da, int *err, const DaRange *ranges, size_t k)
 {
-    void *dst;
-    void *src;
-    size_t bytes;
+    DaRange *sorted;
+    size_t j;
+    int ordered;
 
     if (paramNotValid(da, err))
     {
         return -1;
     }
-
-    if (pos >= da->used)
+    else if (!ranges)
     {
-        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
         return -1;
     }
 
-    /* Move memory if it's not the last remaining or endmost element */
-    if (da->used > 1 && pos < da->used - 1)
+    for (j = 0, ordered = 1; j < k; j++)
     {
-        dst = (char *)da->firstAddr + (pos * da->bytesPerElement);
-        src = (char *)dst + da->bytesPerElement;
-        bytes = (da->used - 1 - pos) * da->bytesPerElement;
+        if (ranges[j].from > ranges[j].to || ranges[j].to >= da->used)
+        {
+            *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+            return -1;
+        }
 
-        memmove(dst, src, bytes);
+        ordered &= (j == 0 || ranges[j - 1].from <= ranges[j].from);
     }
 
-    da->used--;
+    if (ordered)
+    {
+        daCompactRanges(da, NULL, ranges, k);
+        *err = DA_OK;
+        return 0;
+    }
+
+    if (!(sorted = malloc(k * sizeof(DaRange))))
+    {
+        *err = DA_FATAL | DA_ENOMEM;
+        return -1;
+    }
+
+    memcpy(sorted, ranges, k * sizeof(DaRange));
+    qsort(sorted, k, sizeof(DaRange), daCompareRange);
+    daCompactRanges(da, NULL, sorted, k);
+    free(sorted);
 
     *err = DA_OK;
     return 0;
 }
 
-int daRemoveDirty(DaStruct *da, int *err, size_t pos)
+/**
+ * @brief The function returns whether the elements @p a and @p b are equal.
+ *
+ * @param[in] a      First element.
+ * @param[in] b      Second element.
+ * @param[in] stride Size of the elements.
+ * @param[in] cmp    Compares the elements or a NULL pointer to compare their bytes.
+ *
+ * @returns The function returns 1 if the elements are equal and 0 otherwise.
+ */
+static int daEqual(const void *a, const void *b, size_t stride, DaCompare cmp)
 {
-    void *dst;
-    void *src;
+    return cmp ? cmp(a, b) == 0 : memcmp(a, b, stride) == 0;
+}
+
+int daUnique(DaStruct *da, int *err, DaCompare cmp, int mode, size_t *removed)
+{
+    char *base;
+    size_t stride;
+    size_t write;
+    size_t count;
+    size_t i;
+    int duplicate;
 
     if (paramNotValid(da, err))
     {
         return -1;
     }
-
-    if (pos >= da->used)
+    else if (mode != DA_KEEP_FIRST && mode != DA_KEEP_LAST)
     {
-        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        *err = DA_PARAM_ERR | DA_UNKNOWN_MODE;
         return -1;
     }
 
-    /* Move memory if it's not the last remaining or endmost element */
-    if (da->used > 1 && pos < da->used - 1)
+    base = da->firstAddr;
+    stride = da->bytesPerElement;
+
+    /* Elements before write are kept, the ones from i on haven't been moved yet */
+    for (i = 0, write = 0; i < da->used; i++)
     {
-        dst = (char *)da->firstAddr + (pos * da->bytesPerElement);
-        src = (char *)da->firstAddr + ((da->used - 1) * da->bytesPerElement);
+        if (mode == DA_KEEP_FIRST)
+        {
+            duplicate = write > 0 && daEqual(base + ((write - 1) * stride), base + (i * stride), stride, cmp);
+        }
+        else
+        {
+            duplicate = i + 1 < da->used && daEqual(base + (i * stride), base + ((i + 1) * stride), stride, cmp);
+        }
 
-        memcpy(dst, src, da->bytesPerElement);
+        if (!duplicate)
+        {
+            if (write != i)
+            {
+                memcpy(base + (write * stride), base + (i * stride), stride);
+            }
+
+            write++;
+        }
     }
 
-    da->used--;
+    count = da->used - write;
+    da->used = write;
+
+    daSidecarCompact(da, count);
+
+    if (removed)
+    {
+        *removed = count;
+    }
 
     *err = DA_OK;
     return 0;
 }
 
-int daRemoveRange(DaStruct *da, int *err, size_t from, size_t to)
+int daUniqueUnsorted(DaStruct *da, int *err, size_t *removed)
 {
-    void *dst;
-    void *src;
-    size_t bytes;
-    size_t elements;
+    char *base;
+    size_t *slots;
+    size_t nrSlots;
+    size_t mask;
+    size_t stride;
+    size_t write;
+    size_t count;
+    size_t i;
+    size_t j;
 
     if (paramNotValid(da, err))
     {
         return -1;
     }
 
-    if (to >= da->used || from >= da->used || from > to)
+    nrSlots = daIndexSlots(da->used);
+    mask = nrSlots - 1;
+
+    if (!(slots = calloc(nrSlots, sizeof(size_t))))
     {
-        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        *err = DA_FATAL | DA_ENOMEM;
         return -1;
     }
 
-    elements = to - from;
-    elements++;
+    base = da->firstAddr;
+    stride = da->bytesPerElement;
 
-    dst = (char *)da->firstAddr + (from * da->bytesPerElement);
-    src = (char *)dst + (elements * da->bytesPerElement);
-    bytes = (da->used - 1 - to) * da->bytesPerElement;
+    /* Every slot holds the position of a kept element plus one, kept elements never move again */
+    for (i = 0, write = 0; i < da->used; i++)
+    {
+        for (j = daHash(base + (i * stride), stride) & mask; slots[j]; j = (j + 1) & mask)
+        {
+            if (memcmp(base + ((slots[j] - 1) * stride), base + (i * stride), stride) == 0)
+            {
+                break;
+            }
+        }
 
-    memmove(dst, src, bytes);
+        if (slots[j])
+        {
+            continue;
+        }
 
-    da->used -= elements;
+        if (write != i)
+        {
+            memcpy(base + (write * stride), base + (i * stride), stride);
+        }
 
-    * err = DA_OK;
-    return 0;
+        slots[j] = ++write;
+    }
+
+    free(slots);
+    count = da->used - write;
+    da->used = write;
+
+    daSidecarCompact(da, count);
 
+    if (removed)
+    {
+        *removed = count;
+    }
+
+    *err = DA_OK;
+    return 0;
 }
 
 void *daAppend(DaStruct *da, int *err, const void *element)
@@ -565,6 +7292,43 @@ void *daAppend(DaStruct *da, int *err, const void *element)
     ret = freeAddr = (char *)da->firstAddr + (da->used * da->bytesPerElement);
     memcpy(freeAddr, element, da->bytesPerElement);
     da->used++;
+    daSidecarInsert(da, da->used - 1, 1, 1);
+
+    *err = DA_OK;
+    return ret;
+}
+
+void *daAppendN(DaStruct *da, int *err, const void *src, size_t n)
+{
+    size_t offset;
+    size_t bytes;
+    char *ret;
+    int inside;
+
+    if (paramNotValid(da, err))
+    {
+        return NULL;
+    }
+    else if (!src)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return NULL;
+    }
+
+    /* The source may move with the array */
+    bytes = da->used * da->bytesPerElement;
+    inside = (const char *)src >= (char *)da->firstAddr && (const char *)src < (char *)da->firstAddr + bytes;
+    offset = inside ? (size_t)((const char *)src - (char *)da->firstAddr) : 0;
+
+    if (daReserve(da, err, n) != 0)
+    {
+        return NULL;
+    }
+
+    ret = (char *)da->firstAddr + bytes;
+    memcpy(ret, inside ? (char *)da->firstAddr + offset : src, n * da->bytesPerElement);
+    da->used += n;
+    daSidecarInsert(da, da->used - n, n, 1);
 
     *err = DA_OK;
     return ret;
@@ -593,6 +7357,7 @@ void *daPrepend(DaStruct *da, int *err, const void *element)
     memmove((char*)da->firstAddr + da->bytesPerElement, da->firstAddr, da->used * da->bytesPerElement);
     memcpy(da->firstAddr, element, da->bytesPerElement);
     da->used++;
+    daSidecarInsert(da, 0, 1, 1);
 
     *err = DA_OK;
     return da->firstAddr;
@@ -635,11 +7400,200 @@ void *daInsertAt(DaStruct *da, int *err, const void *element, size_t pos)
     memcpy(src, element, da->bytesPerElement);
 
     da->used++;
+    daSidecarInsert(da, pos, 1, 1);
 
     *err = DA_OK;
     return src;
 }
 
+/**
+ * @brief The function opens a gap of @p n elements at @p pos.
+ *
+ * The array grows at most once, the elements from @p pos get shifted with a single memmove() and count as used
+ * afterwards. The content of the gap is undefined, the index and the filter aren't updated.
+ * The array remains unchanged in the event of an error.
+ *
+ * @param[in]  da  Open the gap in this array.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  pos Position of the gap, at most DaStruct#used.
+ * @param[in]  n   Number of elements.
+ *
+ * @returns The function returns a pointer to the gap or NULL in the event of an error.
+ */
+static char *daOpenGap(DaStruct *da, int *err, size_t pos, size_t n)
+{
+    char *gap;
+
+    if (daReserve(da, err, n) != 0)
+    {
+        return NULL;
+    }
+
+    gap = (char *)da->firstAddr + (pos * da->bytesPerElement);
+    memmove(gap + (n * da->bytesPerElement), gap, (da->used - pos) * da->bytesPerElement);
+    da->used += n;
+
+    return gap;
+}
+
+/**
+ * @brief The function implements daAppendSlot() and daInsertSlot() once @p pos is known to be valid.
+ *
+ * @param[in]  da   Insert the slots into this array.
+ * @param[out] err  Indicates what went wrong in the event of an error.
+ * @param[in]  pos  Position of the first slot (0 based).
+ * @param[in]  n    Number of slots.
+ * @param[in]  mode ::DA_DIRTY or ::DA_ZERO.
+ *
+ * @returns The function returns a pointer to the first slot or NULL in the event of an error.
+ */
+static void *daSlots(DaStruct *da, int *err, size_t pos, size_t n, int mode)
+{
+    char *gap;
+
+    if (!(gap = daOpenGap(da, err, pos, n)))
+    {
+        return NULL;
+    }
+
+    if (mode == DA_ZERO)
+    {
+        memset(gap, 0, n * da->bytesPerElement);
+    }
+
+    /* The caller fills the slots later on */
+    if (n > 0)
+    {
+        daSidecarSuspend(da);
+    }
+
+    *err = DA_OK;
+    return gap;
+}
+
+void *daAppendSlot(DaStruct *da, int *err, size_t n, int mode)
+{
+    if (paramNotValid(da, err))
+    {
+        return NULL;
+    }
+    else if (mode != DA_DIRTY && mode != DA_ZERO)
+    {
+        *err = DA_PARAM_ERR | DA_UNKNOWN_MODE;
+        return NULL;
+    }
+
+    return daSlots(da, err, da->used, n, mode);
+}
+
+void *daInsertSlot(DaStruct *da, int *err, size_t pos, size_t n, int mode)
+{
+    if (paramNotValid(da, err))
+    {
+        return NULL;
+    }
+    else if (mode != DA_DIRTY && mode != DA_ZERO)
+    {
+        *err = DA_PARAM_ERR | DA_UNKNOWN_MODE;
+        return NULL;
+    }
+
+    if (pos > 0 && pos >= da->used)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return NULL;
+    }
+
+    return daSlots(da, err, pos, n, mode);
+}
+
+/**
+ * @brief The function implements daInsertRange() and daPrependN() once @p pos is known to be valid.
+ *
+ * @param[in]  da  Insert the elements into this array.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  src The @p n elements that shall be inserted.
+ * @param[in]  n   Number of elements.
+ * @param[in]  pos Insert the first element at this position into the array (0 based).
+ *
+ * @returns The function returns a pointer to the first inserted element or NULL in the event of an error.
+ */
+static void *daInsertN(DaStruct *da, int *err, const void *src, size_t n, size_t pos)
+{
+    char *gap;
+    size_t offset;
+    size_t bytes;
+    size_t used;
+    size_t head;
+    int inside;
+
+    /* The source may move with the array and with the shifted elements */
+    used = da->used * da->bytesPerElement;
+    inside = (const char *)src >= (char *)da->firstAddr && (const char *)src < (char *)da->firstAddr + used;
+    offset = inside ? (size_t)((const char *)src - (char *)da->firstAddr) : 0;
+
+    if (!(gap = daOpenGap(da, err, pos, n)))
+    {
+        return NULL;
+    }
+
+    bytes = n * da->bytesPerElement;
+
+    if (!inside)
+    {
+        memcpy(gap, src, bytes);
+    }
+    else
+    {
+        /* The part in front of the gap stayed, the rest moved behind it */
+        head = (offset < pos * da->bytesPerElement) ? pos * da->bytesPerElement - offset : 0;
+        head = (head > bytes) ? bytes : head;
+        memcpy(gap, (char *)da->firstAddr + offset, head);
+        memcpy(gap + head, (char *)da->firstAddr + offset + head + bytes, bytes - head);
+    }
+
+    daSidecarInsert(da, pos, n, 1);
+
+    *err = DA_OK;
+    return gap;
+}
+
+void *daInsertRange(DaStruct *da, int *err, const void *src, size_t n, size_t pos)
+{
+    if (paramNotValid(da, err))
+    {
+        return NULL;
+    }
+    else if (!src)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return NULL;
+    }
+
+    if (pos > 0 && pos >= da->used)
+    {
+        *err = DA_PARAM_ERR | DA_OUT_OF_BOUNDS;
+        return NULL;
+    }
+
+    return daInsertN(da, err, src, n, pos);
+}
+
+void *daPrependN(DaStruct *da, int *err, const void *src, size_t n)
+{
+    if (paramNotValid(da, err))
+    {
+        return NULL;
+    }
+    else if (!src)
+    {
+        *err = DA_PARAM_ERR | DA_PARAM_NULL;
+        return NULL;
+    }
+
+    return daInsertN(da, err, src, n, 0);
+}
+
 int daIncrease(DaStruct *da, int *err, size_t n, int mode)
 {
     void *newArray;
@@ -724,6 +7678,10 @@ const char *daErrToString(int err)
         {
             return "DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT";
         }
+        else if (err & DA_INCOMPATIBLE)
+        {
+            return "DA_PARAM_ERR | DA_INCOMPATIBLE";
+        }
     }
     else if (err & DA_FATAL)
     {
@@ -65,6 +65,10 @@
  * Parameter error: Element size exceeds bytes limit.
  */
 #define DA_EXCEEDS_SIZE_LIMIT 0x00000008
+/**
+ * Parameter error: The element size of an array doesn't fit the operation.
+ */
+#define DA_INCOMPATIBLE       0x00000010
 
 /**
  * Group of fatal errors.
@@ -88,6 +92,11 @@
  */
 #define DA_MAGIC         0x71238924
 
+/**
+ * Marks a position that doesn't exist, e.g. the index of an element that wasn't found.
+ */
+#define DA_NPOS          ((size_t)-1)
+
 
 /**
  * Operation mode for daIncrease()
@@ -108,6 +117,188 @@
  */
 #define DA_SECURE        0x00000002
 
+
+/**
+ * Operation mode for daAppendSlot() and daInsertSlot(): Leave the content of the slots undefined.
+ */
+#define DA_DIRTY         0x00000001
+/**
+ * Operation mode for daAppendSlot() and daInsertSlot(): Fill the slots with zero bytes.
+ */
+#define DA_ZERO          0x00000002
+
+
+/**
+ * Operation mode for daUnique(): Keep the first element of each group of equal elements.
+ */
+#define DA_KEEP_FIRST    0x00000001
+/**
+ * Operation mode for daUnique(): Keep the last element of each group of equal elements.
+ */
+#define DA_KEEP_LAST     0x00000002
+
+
+/**
+ * Key kind: Unsigned integer in host byte order.
+ */
+#define DA_KEY_UNSIGNED  0x00000100
+/**
+ * Key kind: Two's complement signed integer in host byte order.
+ */
+#define DA_KEY_SIGNED    0x00000200
+/**
+ * Key kind: IEEE 754 floating point number in host byte order.
+ */
+#define DA_KEY_FLOAT     0x00000300
+
+/**
+ * Key type: 1 byte unsigned integer.
+ */
+#define DA_KEY_U8        (DA_KEY_UNSIGNED | 1)
+/**
+ * Key type: 2 byte unsigned integer.
+ */
+#define DA_KEY_U16       (DA_KEY_UNSIGNED | 2)
+/**
+ * Key type: 4 byte unsigned integer.
+ */
+#define DA_KEY_U32       (DA_KEY_UNSIGNED | 4)
+/**
+ * Key type: 8 byte unsigned integer.
+ */
+#define DA_KEY_U64       (DA_KEY_UNSIGNED | 8)
+/**
+ * Key type: 1 byte signed integer.
+ */
+#define DA_KEY_S8        (DA_KEY_SIGNED | 1)
+/**
+ * Key type: 2 byte signed integer.
+ */
+#define DA_KEY_S16       (DA_KEY_SIGNED | 2)
+/**
+ * Key type: 4 byte signed integer.
+ */
+#define DA_KEY_S32       (DA_KEY_SIGNED | 4)
+/**
+ * Key type: 8 byte signed integer.
+ */
+#define DA_KEY_S64       (DA_KEY_SIGNED | 8)
+/**
+ * Key type: 4 byte IEEE 754 floating point number (float).
+ */
+#define DA_KEY_F32       (DA_KEY_FLOAT | 4)
+/**
+ * Key type: 8 byte IEEE 754 floating point number (double).
+ */
+#define DA_KEY_F64       (DA_KEY_FLOAT | 8)
+
+
+#ifndef DA_PARALLEL_THRESHOLD
+/**
+ * Minimum number of bytes an array must occupy before the parallel functions spread the work across threads.
+ *
+ * Smaller arrays are handled by the calling thread alone because starting the threads would cost more than the scan.
+ * Define it at compile time to override the default.
+ */
+#define DA_PARALLEL_THRESHOLD (1024 * 1024)
+#endif
+
+#ifndef DA_FEW_KEYS
+/**
+ * Maximum number of elements daIndexOfMany() compares directly instead of building a hash table.
+ *
+ * Define it at compile time to override the default.
+ */
+#define DA_FEW_KEYS           8
+#endif
+
+#ifndef DA_PARALLEL_BLOCK
+/**
+ * Number of bytes the parallel functions hand out to a thread at once.
+ *
+ * Define it at compile time to override the default.
+ */
+#define DA_PARALLEL_BLOCK     (256 * 1024)
+#endif
+
+#ifndef DA_PREDICATE_BLOCK
+/**
+ * Maximum number of elements passed to a ::DaBlockPredicate at once.
+ *
+ * Define it at compile time to override the default.
+ */
+#define DA_PREDICATE_BLOCK    256
+#endif
+
+#ifndef DA_SORT_INDIRECT
+/**
+ * Element size in bytes above which daSortByKey() sorts the keys with the element positions and moves every element
+ * only once afterwards, instead of moving the elements in every pass.
+ *
+ * Define it at compile time to override the default.
+ */
+#define DA_SORT_INDIRECT      32
+#endif
+
+/**
+ * @brief Type of the functions comparing two elements.
+ *
+ * The function returns a negative value, zero or a positive value if @p a is less than, equal to or greater than @p b,
+ * like the comparison function of qsort().
+ */
+typedef int (*DaCompare)(const void *a, const void *b);
+
+/**
+ * @brief Type of the functions testing a single element.
+ *
+ * The function returns a non-zero value if the @p element satisfies the condition and 0 otherwise.
+ * @p ctx is passed through from the caller. The function must not change the array.
+ */
+typedef int (*DaPredicate)(const void *element, void *ctx);
+
+/**
+ * @brief Type of the functions testing a block of elements at once.
+ *
+ * The function stores a non-zero value in @p results[i] if the element @p i of the @p n consecutive @p elements
+ * satisfies the condition and 0 otherwise. A plain loop over the block lets the compiler vectorize the test.
+ * @p ctx is passed through from the caller. The function must not change the array.
+ */
+typedef void (*DaBlockPredicate)(const void *elements, size_t n, unsigned char *results, void *ctx);
+
+/**
+ * @brief Type of the functions visiting a block of elements, see daForEach().
+ *
+ * The function gets the @p n consecutive @p elements starting at position @p pos.
+ * @p ctx is passed through from the caller. The function must not change the array.
+ *
+ * @returns The function returns 0 to continue with the next block and any other value to stop.
+ */
+typedef int (*DaBlockVisitor)(const void *elements, size_t n, size_t pos, void *ctx);
+
+/**
+ * @brief Type of the functions changing a block of elements in place, see daMapInPlace().
+ *
+ * The function may change the @p n consecutive @p elements starting at position @p pos, but must not add or remove
+ * elements. @p ctx is passed through from the caller.
+ */
+typedef void (*DaBlockMapper)(void *elements, size_t n, size_t pos, void *ctx);
+
+/**
+ * @brief Type of the functions folding a block of elements into an accumulator, see daReduce().
+ *
+ * The function folds the @p n consecutive @p elements starting at position @p pos into @p acc.
+ * @p ctx is passed through from the caller. The function must not change the array.
+ */
+typedef void (*DaBlockReducer)(const void *elements, size_t n, size_t pos, void *acc, void *ctx);
+
+/**
+ * @brief Type of the functions combining two accumulators, see daReduceParallel().
+ *
+ * The function folds @p part, the accumulator of the elements following the ones of @p acc, into @p acc.
+ * The combination must be associative. @p ctx is passed through from the caller.
+ */
+typedef void (*DaCombine)(void *acc, const void *part, void *ctx);
+
 /**
  * @brief The structure defines the initial setup for an array.
  */
@@ -170,8 +361,118 @@ typedef struct str_da_struct
      */
     int magic;
 
+    /**
+     * Hash index attached by daIndexAttach() or a NULL pointer.
+     */
+    struct str_da_index *index;
+
+    /**
+     * Bloom filter attached by daBloomAttach() or a NULL pointer.
+     */
+    struct str_da_bloom *bloom;
+
 } DaStruct;
 
+/**
+ * @brief The structure holds the statistics of a Bloom filter returned by daBloomStats().
+ *
+ * The observed false positive rate is DaBloomStats#falsePositives / (DaBloomStats#rejected + DaBloomStats#falsePositives).
+ */
+typedef struct str_da_bloom_stats
+{
+    /**
+     * Number of bytes of the filter, 0 if it is suspended.
+     */
+    size_t bytes;
+
+    /**
+     * Number of elements added since the last rebuild.
+     */
+    size_t elements;
+
+    /**
+     * Number of elements removed or overwritten since the last rebuild, their bits remain set.
+     */
+    size_t stale;
+
+    /**
+     * Number of times the filter was rebuilt.
+     */
+    size_t rebuilds;
+
+    /**
+     * Number of lookups that consulted the filter while daBloomTrack() enabled the lookup counters.
+     */
+    size_t lookups;
+
+    /**
+     * Number of lookups the filter answered with "not found" without searching the array.
+     */
+    size_t rejected;
+
+    /**
+     * Number of lookups that passed the filter but didn't find the element.
+     */
+    size_t falsePositives;
+
+    /**
+     * False positive rate expected from the share of set bits.
+     *
+     * The observed rate is higher because the elements don't spread evenly across the blocks.
+     */
+    double expectedRate;
+
+} DaBloomStats;
+
+/**
+ * @brief The structure describes a range of elements for daRemoveRanges().
+ */
+typedef struct str_da_range
+{
+    /**
+     * First element of the range (0 based).
+     */
+    size_t from;
+
+    /**
+     * Last element of the range, like the @p to of daRemoveRange().
+     */
+    size_t to;
+
+} DaRange;
+
+/**
+ * @brief The structure describes a view of consecutive elements of an array, see daView().
+ *
+ * A view doesn't own any memory. It refers to its base array by position, not by address, so the rules for its
+ * lifetime are:
+ * - The view remains valid when the base array grows or gets reallocated.
+ * - Inserting or removing elements in front of or within the view shifts the elements, the view then covers
+ *   the elements that moved to its positions.
+ * - If the base array shrinks below the end of the view, the view functions fail with ::DA_OUT_OF_BOUNDS until
+ *   the base array has grown again.
+ * - Pointers returned by daViewGet() become invalid like pointers returned by daGet().
+ * - The view must not be used after the base array has been destroyed.
+ */
+typedef struct str_da_view
+{
+    /**
+     * Array the view refers to.
+     */
+    DaStruct *base;
+
+    /**
+     * Position of the first element of the view in the base array.
+     */
+    size_t offset;
+
+    /**
+     * Number of elements in the view.
+     */
+    size_t length;
+
+} DaView;
+
 /**
  * @brief The function creates a new dynamic array.
  *
@@ -210,6 +511,51 @@ DaStruct *daCreate(DaDesc *desc, int *err);
  */
 int daDestroy(DaStruct *da, int *err);
 
+/**
+ * @brief The function creates a dynamic array that takes over an existing buffer of elements.
+ *
+ * The elements don't get copied. The array owns the @p buffer after successful execution and frees it when it gets
+ * reallocated or destroyed, so the @p buffer must have been allocated with malloc(), calloc() or realloc() like the
+ * memory of arrays created by daCreate(). DaDesc#elements gets ignored, the initial capacity is @p capacity.
+ * The caller keeps the @p buffer in the event of an error.
+ *
+ * @param[in]  desc     Settings for the array, DaDesc#bytesPerElement and DaDesc#maxBytes get used.
+ * @param[out] err      Indicates what went wrong in the event of an error.
+ * @param[in]  buffer   Buffer to take over.
+ * @param[in]  used     Number of elements the @p buffer holds.
+ * @param[in]  capacity Number of elements that fit into the @p buffer.
+ *
+ * @returns Returns a pointer to the dynamic array on success that can be successfully passed to DaDestroy().
+ * @returns Otherwise, a NULL pointer is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device.@n
+ * ::DA_PARAM_ERR | ::DA_EXCEEDS_SIZE_LIMIT if the @p buffer exceeds the bytes limit DaDesc#maxBytes. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if @p used exceeds @p capacity. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p desc or @p buffer is a NULL-pointer or @p capacity is 0. @n
+ */
+DaStruct *daAdopt(DaDesc *desc, int *err, void *buffer, size_t used, size_t capacity);
+
+/**
+ * @brief The function deletes a dynamic array but hands its buffer of elements over to the caller.
+ *
+ * The elements don't get copied. The caller owns the returned buffer and has to release it with free().
+ * @p da gets invalid after successful execution, an attached hash index or Bloom filter gets freed.
+ *
+ * @param[in]  da       The array that should be detached.
+ * @param[out] err      Indicates what went wrong in the event of an error.
+ * @param[out] used     Receives the number of elements in the buffer.
+ * @param[out] capacity Receives the number of elements that fit into the buffer or a NULL pointer.
+ *
+ * @returns Returns the buffer on success, otherwise a NULL pointer is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p used is a NULL-pointer. @n
+ */
+void *daDetach(DaStruct *da, int *err, size_t *used, size_t *capacity);
+
 /**
  * @brief The function returns the number of elements in the array.
  *
@@ -287,6 +633,31 @@ void *daPrepend(DaStruct *da, int *err, const void *element);
  */
 void *daAppend(DaStruct *da, int *err, const void *element);
 
+/**
+ * @brief The function appends the @p n elements of @p src to the array.
+ *
+ * The array grows at most once and the elements get copied with a single memcpy(), so loading many elements
+ * doesn't pay the checks and reallocations of daAppend() per element.
+ * Either all elements get appended or none, the array remains unchanged in the event of an error.
+ * The elements of @p src may be part of the array itself.
+ *
+ * @param[in]  da  Append the elements to this array.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  src The @p n elements that shall be appended, stored one after the other.
+ * @param[in]  n   Number of elements.
+ *
+ * @returns The function returns a pointer to the first appended element on success, for 0 elements the
+ *          position behind the last element.
+ * @returns Otherwise, the function returns a NULL pointer and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device.@n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p src is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_EXCEEDS_SIZE_LIMIT if the @p n elements would exceed the bytes limit DaStruct#maxBytes.
+ */
+void *daAppendN(DaStruct *da, int *err, const void *src, size_t n);
+
 /**
  * @brief The function inserts the @p element at @p pos.
  *
@@ -315,6 +686,116 @@ void *daAppend(DaStruct *da, int *err, const void *element);
  */
 void *daInsertAt(DaStruct *da, int *err, const void *element, size_t pos);
 
+/**
+ * @brief The function inserts the @p n elements of @p src at @p pos.
+ *
+ * The array grows at most once, the elements from @p pos get shifted with a single memmove() and the new elements
+ * get copied into the gap with a single memcpy().
+ * @p pos follows the rules of daInsertAt(): it must be less than daSize(), 0 is also allowed for an empty array.
+ * Either all elements get inserted or none, the array remains unchanged in the event of an error.
+ * The elements of @p src may be part of the array itself.
+ *
+ * @param[in]  da  Insert the elements into this array.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  src The @p n elements that shall be inserted, stored one after the other.
+ * @param[in]  n   Number of elements.
+ * @param[in]  pos Insert the first element at this position into the array (0 based).
+ *
+ * @returns The function returns a pointer to the first inserted element on success, for 0 elements the element at
+ *          @p pos.
+ * @returns Otherwise, the function returns a NULL pointer and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p src is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if @p pos is out of the array bounds (@p pos >= daSize()). @n
+ * ::DA_PARAM_ERR | ::DA_EXCEEDS_SIZE_LIMIT if the @p n elements would exceed the bytes limit DaStruct#maxBytes.
+ */
+void *daInsertRange(DaStruct *da, int *err, const void *src, size_t n, size_t pos);
+
+/**
+ * @brief The function inserts the @p n elements of @p src in front of the first element.
+ *
+ * Works like daInsertRange() at position 0, the elements keep their order.
+ *
+ * @param[in]  da  Prepend the elements to this array.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  src The @p n elements that shall be prepended, stored one after the other.
+ * @param[in]  n   Number of elements.
+ *
+ * @returns The function returns a pointer to the first element on success.
+ * @returns Otherwise, the function returns a NULL pointer and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p src is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_EXCEEDS_SIZE_LIMIT if the @p n elements would exceed the bytes limit DaStruct#maxBytes.
+ */
+void *daPrependN(DaStruct *da, int *err, const void *src, size_t n);
+
+/**
+ * @brief The function appends @p n slots to the array and returns a pointer to the first one.
+ *
+ * The caller constructs the elements directly in the slots instead of copying them in from a finished element,
+ * e.g. a decoder can write straight into the array. The array grows at most once.
+ * The pointer is valid until the next function changes the size of the array.
+ *
+ * The slots count as elements right away, so an attached index and filter get suspended and the lookups scan the
+ * array until the next change of the array rebuilds them. Fill the slots before searching the array.
+ *
+ * @param[in]  da   Append the slots to this array.
+ * @param[out] err  Indicates what went wrong in the event of an error.
+ * @param[in]  n    Number of slots.
+ * @param[in]  mode Specifies the operation mode of the function.
+ *
+ * @b Modes @n
+ *   @p ::DA_DIRTY: The content of the slots is undefined.@n
+ *   @p ::DA_ZERO:  The slots are filled with zero bytes.
+ *
+ * @returns The function returns a pointer to the first slot on success, for 0 slots the position behind the last
+ *          element.
+ * @returns Otherwise, the function returns a NULL pointer and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_UNKNOWN_MODE if @p mode is unknown. @n
+ * ::DA_PARAM_ERR | ::DA_EXCEEDS_SIZE_LIMIT if the @p n slots would exceed the bytes limit DaStruct#maxBytes.
+ */
+void *daAppendSlot(DaStruct *da, int *err, size_t n, int mode);
+
+/**
+ * @brief The function inserts @p n slots at @p pos and returns a pointer to the first one.
+ *
+ * Works like daAppendSlot(), the elements from @p pos get shifted behind the slots with a single memmove().
+ * @p pos follows the rules of daInsertAt(): it must be less than daSize(), 0 is also allowed for an empty array.
+ *
+ * @param[in]  da   Insert the slots into this array.
+ * @param[out] err  Indicates what went wrong in the event of an error.
+ * @param[in]  pos  Position of the first slot (0 based).
+ * @param[in]  n    Number of slots.
+ * @param[in]  mode Specifies the operation mode of the function.
+ *
+ * @b Modes @n
+ *   @p ::DA_DIRTY: The content of the slots is undefined.@n
+ *   @p ::DA_ZERO:  The slots are filled with zero bytes.
+ *
+ * @returns The function returns a pointer to the first slot on success, for 0 slots the element at @p pos.
+ * @returns Otherwise, the function returns a NULL pointer and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_UNKNOWN_MODE if @p mode is unknown. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if @p pos is out of the array bounds (@p pos >= daSize()). @n
+ * ::DA_PARAM_ERR | ::DA_EXCEEDS_SIZE_LIMIT if the @p n slots would exceed the bytes limit DaStruct#maxBytes.
+ */
+void *daInsertSlot(DaStruct *da, int *err, size_t pos, size_t n, int mode);
+
 /**
  * @brief The function deletes the element at @p pos.
  *
@@ -378,11 +859,267 @@ int daRemoveDirty(DaStruct *da, int *err, size_t pos);
 int daRemoveRange(DaStruct *da, int *err, size_t from, size_t to);
 
 /**
- * @brief The function returns the element at @p pos.
+ * @brief The function removes all elements that satisfy the @p predicate.
  *
- * @param[in]  da      Get the element from this array.
- * @param[out] err     Indicates what went wrong in the event of an error.
- * @param[in]  pos     Get the @p element at this position from the array (0 based).
+ * The array gets compacted in a single stable pass: every element gets tested once and each run of kept elements
+ * gets moved with a single memmove(), so the remaining elements keep their order.
+ * An attached index gets rebuilt afterwards, an attached filter gets rebuilt once the removed elements make up half
+ * of it.
+ *
+ * @param[in]  da        Remove the elements from this array.
+ * @param[out] err       Indicates what went wrong in the event of an error.
+ * @param[in]  predicate Returns non-zero for the elements that shall be removed.
+ * @param[in]  ctx       Passed to the @p predicate.
+ * @param[out] removed   Number of removed elements or a NULL pointer.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p predicate is a NULL-pointer.
+ */
+int daRemoveIf(DaStruct *da, int *err, DaPredicate predicate, void *ctx, size_t *removed);
+
+/**
+ * @brief The function removes all elements that don't satisfy the @p predicate.
+ *
+ * Works like daRemoveIf() with the inverted @p predicate.
+ *
+ * @param[in]  da        Remove the elements from this array.
+ * @param[out] err       Indicates what went wrong in the event of an error.
+ * @param[in]  predicate Returns non-zero for the elements that shall be kept.
+ * @param[in]  ctx       Passed to the @p predicate.
+ * @param[out] removed   Number of removed elements or a NULL pointer.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p predicate is a NULL-pointer.
+ */
+int daRetainIf(DaStruct *da, int *err, DaPredicate predicate, void *ctx, size_t *removed);
+
+/**
+ * @brief The function removes all elements that satisfy the block @p predicate.
+ *
+ * Works like daRemoveIf(), but the @p predicate tests up to ::DA_PREDICATE_BLOCK consecutive elements per call.
+ * That saves a call per element and lets the predicate be a loop the compiler can vectorize.
+ *
+ * @param[in]  da        Remove the elements from this array.
+ * @param[out] err       Indicates what went wrong in the event of an error.
+ * @param[in]  predicate Marks the elements that shall be removed.
+ * @param[in]  ctx       Passed to the @p predicate.
+ * @param[out] removed   Number of removed elements or a NULL pointer.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p predicate is a NULL-pointer.
+ */
+int daRemoveIfBlock(DaStruct *da, int *err, DaBlockPredicate predicate, void *ctx, size_t *removed);
+
+/**
+ * @brief The function removes all elements that don't satisfy the block @p predicate.
+ *
+ * Works like daRemoveIfBlock() with the inverted @p predicate.
+ *
+ * @param[in]  da        Remove the elements from this array.
+ * @param[out] err       Indicates what went wrong in the event of an error.
+ * @param[in]  predicate Marks the elements that shall be kept.
+ * @param[in]  ctx       Passed to the @p predicate.
+ * @param[out] removed   Number of removed elements or a NULL pointer.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p predicate is a NULL-pointer.
+ */
+int daRetainIfBlock(DaStruct *da, int *err, DaBlockPredicate predicate, void *ctx, size_t *removed);
+
+/**
+ * @brief The function moves all elements that satisfy the @p predicate in front of the ones that don't.
+ *
+ * The partition works in place and isn't stable. The @p predicate gets called once per element, the elements get
+ * tested in blocks of ::DA_PREDICATE_BLOCK elements from both ends of the array and the misplaced elements of two
+ * blocks get swapped pairwise. An attached index gets rebuilt afterwards.
+ *
+ * @param[in]  da        Partition this array.
+ * @param[out] err       Indicates what went wrong in the event of an error.
+ * @param[in]  predicate Returns non-zero for the elements that shall be moved to the front.
+ * @param[in]  ctx       Passed to the @p predicate.
+ * @param[out] split     Position of the first element that doesn't satisfy the @p predicate or a NULL pointer.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p predicate is a NULL-pointer.
+ */
+int daPartition(DaStruct *da, int *err, DaPredicate predicate, void *ctx, size_t *split);
+
+/**
+ * @brief The function moves all elements that satisfy the block @p predicate in front of the ones that don't.
+ *
+ * Works like daPartition(), but the @p predicate tests up to ::DA_PREDICATE_BLOCK consecutive elements per call.
+ *
+ * @param[in]  da        Partition this array.
+ * @param[out] err       Indicates what went wrong in the event of an error.
+ * @param[in]  predicate Marks the elements that shall be moved to the front.
+ * @param[in]  ctx       Passed to the @p predicate.
+ * @param[out] split     Position of the first element that doesn't satisfy the @p predicate or a NULL pointer.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p predicate is a NULL-pointer.
+ */
+int daPartitionBlock(DaStruct *da, int *err, DaBlockPredicate predicate, void *ctx, size_t *split);
+
+/**
+ * @brief The function moves all elements that satisfy the @p predicate in front of the ones that don't and keeps
+ * the order within both groups.
+ *
+ * The @p predicate gets called once per element in blocks of ::DA_PREDICATE_BLOCK elements. The elements that don't
+ * satisfy it get parked in a scratch buffer while the others move to the front. The scratch buffer gets counted
+ * against DaStruct#maxBytes together with the allocated elements like the one of daSortParallel(). If it can't hold
+ * all elements, the array gets partitioned in parts that fit and the parts get joined by rotations. Without any
+ * scratch buffer the parts have ::DA_PREDICATE_BLOCK elements and get partitioned by rotations as well, which takes
+ * O(n log n) time but no additional memory. An attached index gets rebuilt afterwards.
+ *
+ * @param[in]  da        Partition this array.
+ * @param[out] err       Indicates what went wrong in the event of an error.
+ * @param[in]  predicate Returns non-zero for the elements that shall be moved to the front.
+ * @param[in]  ctx       Passed to the @p predicate.
+ * @param[out] split     Position of the first element that doesn't satisfy the @p predicate or a NULL pointer.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p predicate is a NULL-pointer.
+ */
+int daStablePartition(DaStruct *da, int *err, DaPredicate predicate, void *ctx, size_t *split);
+
+/**
+ * @brief The function moves all elements that satisfy the block @p predicate in front of the ones that don't and
+ * keeps the order within both groups.
+ *
+ * Works like daStablePartition(), but the @p predicate tests up to ::DA_PREDICATE_BLOCK consecutive elements per call.
+ *
+ * @param[in]  da        Partition this array.
+ * @param[out] err       Indicates what went wrong in the event of an error.
+ * @param[in]  predicate Marks the elements that shall be moved to the front.
+ * @param[in]  ctx       Passed to the @p predicate.
+ * @param[out] split     Position of the first element that doesn't satisfy the @p predicate or a NULL pointer.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p predicate is a NULL-pointer.
+ */
+int daStablePartitionBlock(DaStruct *da, int *err, DaBlockPredicate predicate, void *ctx, size_t *split);
+
+/**
+ * @brief The function removes the elements at the @p k positions @p indices.
+ *
+ * All elements get removed in a single stable pass with one memmove() per run of kept elements, the remaining
+ * elements keep their order. The @p indices may be unsorted and contain duplicates, unsorted ones get sorted in a copy.
+ * The array remains unchanged in the event of an error.
+ * An attached index gets rebuilt afterwards.
+ *
+ * @param[in]  da      Remove the elements from this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  indices Positions of the elements that shall be removed (0 based).
+ * @param[in]  k       Number of @p indices.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device to sort the @p indices. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p indices is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if any index is out of the array bounds (index >= daSize()).
+ */
+int daRemoveIndices(DaStruct *da, int *err, const size_t *indices, size_t k);
+
+/**
+ * @brief The function removes the elements of the @p k @p ranges.
+ *
+ * Works like daRemoveIndices() for ranges of elements. Each range includes both ends like daRemoveRange().
+ * The @p ranges may be unsorted, overlap or touch each other.
+ *
+ * @param[in]  da     Remove the elements from this array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  ranges Ranges of the elements that shall be removed.
+ * @param[in]  k      Number of @p ranges.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device to sort the @p ranges. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p ranges is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if any range is out of the array bounds or its @p from is greater than its @p to.
+ */
+int daRemoveRanges(DaStruct *da, int *err, const DaRange *ranges, size_t k);
+
+/**
+ * @brief The function removes the duplicates of adjacent equal elements from the sorted array.
+ *
+ * A single pass compacts the array in place, the remaining elements keep their order.
+ * Equal elements only get detected if they are adjacent, so the array should be sorted by @p cmp, e.g. by daSort().
+ * An attached index gets rebuilt afterwards.
+ *
+ * @param[in]  da      Remove the duplicates from this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  cmp     Compares two elements, they are equal if it returns 0.
+ *                     A NULL pointer compares all bytes of the elements.
+ * @param[in]  mode    Specifies the operation mode of the function.
+ * @param[out] removed Receives the number of removed elements or a NULL pointer.
+ *
+ * @b Modes @n
+ *   @p ::DA_KEEP_FIRST: Keep the first element of each group of equal elements.@n
+ *   @p ::DA_KEEP_LAST:  Keep the last element of each group of equal elements.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_UNKNOWN_MODE if @p mode is unknown.
+ */
+int daUnique(DaStruct *da, int *err, DaCompare cmp, int mode, size_t *removed);
+
+/**
+ * @brief The function removes all but the first occurence of equal elements from the array.
+ *
+ * The elements are equal if all their bytes are equal. A single pass compacts the array in place and remembers the
+ * kept elements in a temporary hash set, the remaining elements keep their order.
+ * An attached index gets rebuilt afterwards.
+ *
+ * @param[in]  da      Remove the duplicates from this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[out] removed Receives the number of removed elements or a NULL pointer.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device for the hash set. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer.
+ */
+int daUniqueUnsorted(DaStruct *da, int *err, size_t *removed);
+
+/**
+ * @brief The function returns the element at @p pos.
+ *
+ * @param[in]  da      Get the element from this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  pos     Get the @p element at this position from the array (0 based).
  *
  * @returns The function returns a pointer to the element on success.
  * @returns Otherwise, the function returns a NULL pointer and @p err is set appropriately.
@@ -448,6 +1185,140 @@ void *daGetLast(DaStruct *da, int *err);
  */
 void *daSet(DaStruct *da, int *err, const void *element, size_t pos);
 
+/**
+ * @brief The function replaces the @p n elements from @p pos on with the elements at @p src.
+ *
+ * The elements get copied at once, @p src may point into the array itself.
+ * An attached index drops the entries of the replaced elements and adds the new ones after the copy. An attached
+ * filter counts the replaced elements as stale and adds the new ones, a filter that needs a rebuild gets rebuilt
+ * from the new elements.
+ * The array remains unchanged in the event of an error.
+ *
+ * @param[in]  da  Update the elements of this array.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  pos Position of the first replaced element (0 based).
+ * @param[in]  src The @p n new elements.
+ * @param[in]  n   Number of elements.
+ *
+ * @returns The function returns a pointer to the first updated element on success.
+ * @returns Otherwise, the function returns a NULL pointer and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p src is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the elements exceed the array bounds (@p pos + @p n > daSize()).
+ */
+void *daSetRange(DaStruct *da, int *err, size_t pos, const void *src, size_t n);
+
+/**
+ * @brief The function replaces the elements @p from to @p to with copies of @p element.
+ *
+ * The @p element gets copied once, afterwards the filled part of the range gets copied behind itself, doubling with
+ * every copy. Elements of a single byte get filled by memset().
+ * An attached index and filter get updated for the filled elements like daSetRange() does.
+ * The array remains unchanged in the event of an error.
+ *
+ * @param[in]  da      Update the elements of this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  from    First element of the range (0 based).
+ * @param[in]  to      Last element of the range (0 based).
+ * @param[in]  element Fill the range with this element.
+ *
+ * @returns The function returns a pointer to the first updated element on success.
+ * @returns Otherwise, the function returns a NULL pointer and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p element is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if @p to is out of the array bounds or @p from is greater than @p to.
+ */
+void *daFill(DaStruct *da, int *err, size_t from, size_t to, const void *element);
+
+/**
+ * @brief The function changes the number of elements of the array to @p n.
+ *
+ * Missing elements get appended as copies of @p element like daFill() does, the array grows at most once.
+ * Surplus elements get removed from the end of the array, the allocated memory remains unchanged.
+ * An attached index and filter get updated like daAppendN() and daRemoveRange() do.
+ * The array remains unchanged in the event of an error.
+ *
+ * @param[in]  da      Resize this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  n       New number of elements.
+ * @param[in]  element Fill the new elements with this element or a NULL pointer to fill them with zero bytes.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_EXCEEDS_SIZE_LIMIT if @p n elements would exceed the bytes limit DaStruct#maxBytes.
+ */
+int daResize(DaStruct *da, int *err, size_t n, const void *element);
+
+/**
+ * @brief The function exchanges the elements at @p i and @p j.
+ *
+ * An attached index gets updated.
+ *
+ * @param[in]  da  Swap the elements of this array.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  i   Position of the first element (0 based).
+ * @param[in]  j   Position of the second element (0 based).
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if @p i or @p j is out of the array bounds (>= daSize()).
+ */
+int daSwap(DaStruct *da, int *err, size_t i, size_t j);
+
+/**
+ * @brief The function reverses the order of the elements @p from to @p to in place.
+ *
+ * Elements of the size of an int or a long get exchanged as whole words.
+ * An attached index gets rebuilt afterwards.
+ *
+ * @param[in]  da   Reverse the elements of this array.
+ * @param[out] err  Indicates what went wrong in the event of an error.
+ * @param[in]  from First element of the range (0 based).
+ * @param[in]  to   Last element of the range (0 based).
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if @p to is out of the array bounds or @p from is greater than @p to.
+ */
+int daReverse(DaStruct *da, int *err, size_t from, size_t to);
+
+/**
+ * @brief The function rotates the elements @p from to @p to by @p k positions towards the front in place.
+ *
+ * The element at @p from + @p k becomes the first one of the range and the first @p k elements move behind the others.
+ * Rotating by more positions than the range holds wraps around. The rotation exchanges blocks of elements without
+ * additional memory and takes O(n) swaps in total.
+ * An attached index gets rebuilt afterwards.
+ *
+ * @param[in]  da   Rotate the elements of this array.
+ * @param[out] err  Indicates what went wrong in the event of an error.
+ * @param[in]  from First element of the range (0 based).
+ * @param[in]  to   Last element of the range (0 based).
+ * @param[in]  k    Number of positions.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if @p to is out of the array bounds or @p from is greater than @p to.
+ */
+int daRotate(DaStruct *da, int *err, size_t from, size_t to, size_t k);
+
 /**
  * @brief The function increases the array in a way that @p n free slots for new elements are available.
  *
@@ -550,21 +1421,1518 @@ int daIndexOf(DaStruct *da, int *err, const void *element, size_t *index);
 int daLastIndexOf(DaStruct *da, int *err, const void *element, size_t *index);
 
 /**
- * @brief Returns a copy of the array.
+ * @brief Checks whether the array contains an element whose @p length bytes at @p offset equal the @p key.
  *
- * The initial array @p da remains unchanged.
+ * Only the bits set in @p mask get compared if a @p mask is given, e.g. to ignore flag bits of an id field.
+ * Keys of 1, 2, 4 and 8 bytes get compared with fixed width loads like whole elements in daContains().
  *
- * @param[in]  da  Clone this array.
- * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  da     Search this array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  key    The @p length bytes the elements get compared with.
+ * @param[in]  offset Offset of the compared bytes within each element.
+ * @param[in]  length Number of compared bytes.
+ * @param[in]  mask   The @p length bytes of the mask or a NULL pointer to compare all bits.
  *
- * @returns Returns a pointer to the cloned array on success, otherwise a NULL pointer is returned and @p err is set appropriately.
+ * @returns Returns 1 if the array contains a matching element and 0 if not.
+ * @returns The function returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the array doesn't contain a matching element (e.g. the array is empty). @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p key is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if @p length is 0 or the compared bytes exceed the element (@p offset + @p length > DaStruct#bytesPerElement).
+ */
+int daContainsKey(DaStruct *da, int *err, const void *key, size_t offset, size_t length, const void *mask);
+
+/**
+ * @brief Returns the index of the first element whose @p length bytes at @p offset equal the @p key.
+ *
+ * See daContainsKey() for the comparison.
+ *
+ * @param[in]  da     Search this array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  key    The @p length bytes the elements get compared with.
+ * @param[in]  offset Offset of the compared bytes within each element.
+ * @param[in]  length Number of compared bytes.
+ * @param[in]  mask   The @p length bytes of the mask or a NULL pointer to compare all bits.
+ * @param[out] index  Index of the first matching element (0 based).
+ *
+ * @returns Returns  1 if the array contains a matching element and the index is returned via @p index.
+ * @returns Returns  0 if the array doesn't contain a matching element.
+ * @returns Returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the array doesn't contain a matching element (e.g. the array is empty). @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p key or @p index is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if @p length is 0 or the compared bytes exceed the element (@p offset + @p length > DaStruct#bytesPerElement).
+ */
+int daIndexOfKey(DaStruct *da, int *err, const void *key, size_t offset, size_t length, const void *mask, size_t *index);
+
+/**
+ * @brief Returns the index of the last element whose @p length bytes at @p offset equal the @p key.
+ *
+ * See daContainsKey() for the comparison.
+ *
+ * @param[in]  da     Search this array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  key    The @p length bytes the elements get compared with.
+ * @param[in]  offset Offset of the compared bytes within each element.
+ * @param[in]  length Number of compared bytes.
+ * @param[in]  mask   The @p length bytes of the mask or a NULL pointer to compare all bits.
+ * @param[out] index  Index of the last matching element (0 based).
+ *
+ * @returns Returns  1 if the array contains a matching element and the index is returned via @p index.
+ * @returns Returns  0 if the array doesn't contain a matching element.
+ * @returns Returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the array doesn't contain a matching element (e.g. the array is empty). @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p key or @p index is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if @p length is 0 or the compared bytes exceed the element (@p offset + @p length > DaStruct#bytesPerElement).
+ */
+int daLastIndexOfKey(DaStruct *da, int *err, const void *key, size_t offset, size_t length, const void *mask, size_t *index);
+
+/**
+ * @brief Returns the indexes of the first occurences of @p n elements in the array.
+ *
+ * The function scans the array only once no matter how many elements are searched.
+ * Up to ::DA_FEW_KEYS elements get compared directly against each element of the array.
+ * For more elements a temporary hash table of the searched elements gets built.
+ * An index attached by daIndexAttach() gets used instead of the scan.
+ *
+ * @param[in]  da      Search this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  keys    The @p n elements to search for, stored one after another like in the array.
+ * @param[in]  n       Number of elements in @p keys.
+ * @param[out] indexes Receives the @p n indexes (0 based), ::DA_NPOS for each element the array doesn't contain.
+ *
+ * @returns Returns  1 if the array contains all elements.
+ * @returns Returns  0 if the array doesn't contain at least one of the elements.
+ * @returns Returns -1 in the event of an error and @p err is set appropriately.
  *
  * @b Errors @n
  * ::DA_OK on success. @n
  * ::DA_FATAL | ::DA_ENOMEM if no space is left on device. @n
- * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer. @n
+ * ::DA_NOT_FOUND if the array doesn't contain at least one of the elements. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p keys or @p indexes is a NULL-pointer.
  */
-DaStruct *daClone(const DaStruct *da, int *err);
+int daIndexOfMany(DaStruct *da, int *err, const void *keys, size_t n, size_t *indexes);
+
+/**
+ * @brief Returns the number of occurences of the @p element in the array.
+ *
+ * The array gets compared in groups of as many elements as an unsigned long has bits. Each group yields a bit mask
+ * of its matches, so the scan doesn't branch per element. An attached Bloom filter or hash index answers the lookup
+ * without scanning the array.
+ *
+ * @param[in]  da      Search this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  element Count the elements equal to this one.
+ * @param[out] count   Number of occurences.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p element or @p count is a NULL-pointer.
+ */
+int daCount(DaStruct *da, int *err, const void *element, size_t *count);
+
+/**
+ * @brief Returns the indexes of all occurences of the @p element in the array.
+ *
+ * The array @p out receives the ascending indexes as elements of the type size_t and loses its previous content,
+ * daSize() of @p out returns the number of occurences.
+ * Like daCount() the scan compares groups of elements into bit masks that get compacted into indexes without a branch
+ * per element.
+ *
+ * @param[in]  da      Search this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  element Search the array for this element.
+ * @param[out] out     Array of size_t elements that receives the indexes.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device, @p out is empty afterwards. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p element or @p out is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_INCOMPATIBLE if the elements of @p out aren't of the size of size_t or @p out is @p da. @n
+ * ::DA_PARAM_ERR | ::DA_EXCEEDS_SIZE_LIMIT if the indexes exceed the byte limit of @p out, @p out is empty afterwards.
+ */
+int daFindAll(DaStruct *da, int *err, const void *element, DaStruct *out);
+
+/**
+ * @brief Returns the index of the first occurence of the @p n consecutive elements of @p sequence in the array.
+ *
+ * Matches only start at element boundaries. The scan looks for the first element of the sequence like
+ * daIndexOf() and verifies the last element before the rest of each candidate. If verifying candidates costs more
+ * than scanning, the search continues with a Knuth-Morris-Pratt automaton over whole elements, so the search stays
+ * linear in the size of the array.
+ *
+ * @param[in]  da       Search this array.
+ * @param[out] err      Indicates what went wrong in the event of an error.
+ * @param[in]  sequence The @p n elements to search for, stored one after the other.
+ * @param[in]  n        Number of elements of the @p sequence.
+ * @param[out] index    Index of the first element of the occurence (0 based).
+ *
+ * @returns Returns  1 if the array contains the @p sequence and the index is returned via @p index.
+ * @returns Returns  0 if the array doesn't contain the @p sequence.
+ * @returns Returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the array doesn't contain the @p sequence (e.g. the array holds less than @p n elements). @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p sequence or @p index is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if @p n is 0.
+ */
+int daIndexOfSequence(DaStruct *da, int *err, const void *sequence, size_t n, size_t *index);
+
+/**
+ * @brief Returns the index of the last occurence of the @p n consecutive elements of @p sequence in the array.
+ *
+ * The search works like daIndexOfSequence() from the end of the array.
+ *
+ * @param[in]  da       Search this array.
+ * @param[out] err      Indicates what went wrong in the event of an error.
+ * @param[in]  sequence The @p n elements to search for, stored one after the other.
+ * @param[in]  n        Number of elements of the @p sequence.
+ * @param[out] index    Index of the first element of the occurence (0 based).
+ *
+ * @returns Returns  1 if the array contains the @p sequence and the index is returned via @p index.
+ * @returns Returns  0 if the array doesn't contain the @p sequence.
+ * @returns Returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the array doesn't contain the @p sequence (e.g. the array holds less than @p n elements). @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p sequence or @p index is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if @p n is 0.
+ */
+int daLastIndexOfSequence(DaStruct *da, int *err, const void *sequence, size_t n, size_t *index);
+
+/**
+ * @brief Checks whether the array contains the @p element using up to @p threads threads.
+ *
+ * The array is split into blocks of ::DA_PARALLEL_BLOCK bytes which are handed out to the threads.
+ * All threads stop as soon as one of them found the @p element.
+ *
+ * The function behaves like daContains() if @p threads is less than 2, the array occupies less than
+ * ::DA_PARALLEL_THRESHOLD bytes or the library was built without @c DA_THREADS.
+ *
+ * @param[in]  da      Search this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  element Search the array for this element.
+ * @param[in]  threads Maximum number of threads, including the calling one.
+ *
+ * @returns Returns 1 if the array contains the @p element and 0 if not.
+ * @returns The function returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the array doesn't contain an element equal to the specified @p element (e.g. the array is empty). @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p element is a NULL-pointer. @n
+ */
+int daContainsParallel(DaStruct *da, int *err, const void *element, size_t threads);
+
+/**
+ * @brief Returns the index of the first occurence of the @p element in the array using up to @p threads threads.
+ *
+ * The array is split into blocks of ::DA_PARALLEL_BLOCK bytes which are handed out to the threads in ascending order.
+ * A thread stops as soon as a match in a lower block is known, so the result is always the same as the one of daIndexOf().
+ *
+ * The function behaves like daIndexOf() if @p threads is less than 2, the array occupies less than
+ * ::DA_PARALLEL_THRESHOLD bytes or the library was built without @c DA_THREADS.
+ *
+ * @param[in]  da      Search this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  element Search the array for this element.
+ * @param[out] index   Index of the @p element if the array contains it (0 based).
+ * @param[in]  threads Maximum number of threads, including the calling one.
+ *
+ * @returns Returns  1 if the array contains the @p element and the index is returned via @p index.
+ * @returns Returns  0 if the array doesn't contain the @p element.
+ * @returns Returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the array doesn't contain an element equal to the specified @p element (e.g. the array is empty). @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p element or @p index is a NULL-pointer.
+ */
+int daIndexOfParallel(DaStruct *da, int *err, const void *element, size_t *index, size_t threads);
+
+/**
+ * @brief Returns the index of the last occurence of the @p element in the array using up to @p threads threads.
+ *
+ * Works like daIndexOfParallel() but hands out the blocks in descending order.
+ * The result is always the same as the one of daLastIndexOf().
+ *
+ * @param[in]  da      Search this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  element Search the array for this element.
+ * @param[out] index   Index of the @p element if the array contains it (0 based).
+ * @param[in]  threads Maximum number of threads, including the calling one.
+ *
+ * @returns Returns  1 if the array contains the @p element and the index is returned via @p index.
+ * @returns Returns  0 if the array doesn't contain the @p element.
+ * @returns Returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the array doesn't contain an element equal to the specified @p element (e.g. the array is empty). @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p element or @p index is a NULL-pointer.
+ */
+int daLastIndexOfParallel(DaStruct *da, int *err, const void *element, size_t *index, size_t threads);
+
+/**
+ * @brief The function attaches a hash index to the array.
+ *
+ * The index maps the bytes of each element to its position and lets daContains(), daIndexOf(), daLastIndexOf()
+ * and their parallel variants answer in constant time instead of scanning the array.
+ * daAppend(), daPrepend(), daInsertAt(), daSet(), daRemove(), daRemoveDirty(), daRemoveRange() and daClear()
+ * keep it up to date, including the position shifts they cause.
+ * Inserting or removing elements anywhere but at the end of the array has to renumber the index, which takes
+ * time proportional to the size of the index.
+ *
+ * The index never uses more than @p maxBytes bytes.
+ * If an update doesn't fit into the limit or no memory is left, the array operation still succeeds but the index gets
+ * suspended and the searches fall back to scanning the array. The next change of the array that fits into the limit
+ * rebuilds it.
+ *
+ * Lookups only read the index, so any number of threads may search an indexed array as long as none changes it.
+ * Elements written through the pointers returned by daGet() or similar functions bypass the index.
+ * Call daIndexAttach() again afterwards to rebuild it. Functions that move or remove many elements at once, like
+ * daRemoveIf(), daUnique() or daSort(), rebuild the index afterwards instead of renumbering it.
+ * An attached index gets rebuilt with the new limit, daClone() doesn't copy it.
+ * Lookups of elements that occur very often in the array take time proportional to the number of occurences.
+ *
+ * @param[in]  da       Attach the index to this array.
+ * @param[out] err      Indicates what went wrong in the event of an error.
+ * @param[in]  maxBytes Byte limit of the index.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer or @p maxBytes is 0. @n
+ * ::DA_PARAM_ERR | ::DA_EXCEEDS_SIZE_LIMIT if the index for the current elements would exceed @p maxBytes.
+ */
+int daIndexAttach(DaStruct *da, int *err, size_t maxBytes);
+
+/**
+ * @brief The function removes the hash index from the array and frees its memory.
+ *
+ * Nothing happens if the array has no index.
+ *
+ * @param[in]  da  Remove the index from this array.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer. @n
+ */
+int daIndexDetach(DaStruct *da, int *err);
+
+/**
+ * @brief The function attaches a blocked Bloom filter to the array.
+ *
+ * The filter lets daContains(), daIndexOf(), daLastIndexOf() and their parallel variants answer most lookups of
+ * elements that aren't in the array without searching it. All bits of an element lie in one block of 64 bytes,
+ * so a rejected lookup costs about one cache miss.
+ *
+ * daAppend(), daPrepend(), daInsertAt() and daSet() add the new elements to the filter.
+ * Removed and overwritten elements stay in the filter as stale entries, which only raises the false positive rate.
+ * The next change of the array rebuilds the filter once the stale entries make up half of the filter or the array
+ * outgrew the number of elements it was sized for. A rebuild sizes the filter for twice the current elements.
+ *
+ * The filter never uses more than @p maxBytes bytes.
+ * If a rebuild doesn't fit into the limit or no memory is left, the filter gets suspended and the lookups search
+ * the array until a later change fits again.
+ * Lookups only read the filter unless daBloomTrack() enabled the lookup counters, so any number of threads may
+ * search the array as long as none changes it.
+ * Elements written through the pointers returned by daGet() or similar functions bypass the filter, which may then
+ * reject lookups of these elements. Call daBloomAttach() again afterwards to rebuild it. daAppendSlot() and
+ * daInsertSlot() suspend the filter until the next change of the array rebuilds it.
+ * daClone() doesn't copy the filter.
+ *
+ * @param[in]  da             Attach the filter to this array.
+ * @param[out] err            Indicates what went wrong in the event of an error.
+ * @param[in]  bitsPerElement Number of filter bits per element, 10 gives a false positive rate of about 1%.
+ * @param[in]  maxBytes       Byte limit of the filter.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer, @p bitsPerElement or @p maxBytes is 0. @n
+ * ::DA_PARAM_ERR | ::DA_EXCEEDS_SIZE_LIMIT if the filter for the current elements would exceed @p maxBytes.
+ */
+int daBloomAttach(DaStruct *da, int *err, size_t bitsPerElement, size_t maxBytes);
+
+/**
+ * @brief The function removes the Bloom filter from the array and frees its memory.
+ *
+ * Nothing happens if the array has no filter.
+ *
+ * @param[in]  da  Remove the filter from this array.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer. @n
+ */
+int daBloomDetach(DaStruct *da, int *err);
+
+/**
+ * @brief The function enables or disables the lookup counters of the Bloom filter of the array.
+ *
+ * The counters are disabled when the filter gets attached. While they are enabled every lookup writes to the
+ * filter, so concurrent lookups of the array aren't thread-safe anymore. daBloomStats() returns the counters.
+ *
+ * @param[in]  da     Count the lookups of the filter of this array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  enable 1 to count the lookups, 0 to stop counting them.
+ *
+ * @returns Returns  1 if the array has a filter.
+ * @returns Returns  0 if the array has no filter.
+ * @returns Returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the array has no filter. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer. @n
+ */
+int daBloomTrack(DaStruct *da, int *err, int enable);
+
+/**
+ * @brief The function returns the statistics of the Bloom filter of the array.
+ *
+ * The lookup counters start at 0 when the filter gets attached and survive rebuilds. They only count while
+ * daBloomTrack() enabled them.
+ *
+ * @param[in]  da    Return the statistics of the filter of this array.
+ * @param[out] err   Indicates what went wrong in the event of an error.
+ * @param[out] stats Receives the statistics, all zero if the array has no filter.
+ *
+ * @returns Returns  1 if the array has a filter.
+ * @returns Returns  0 if the array has no filter.
+ * @returns Returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the array has no filter. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p stats is a NULL-pointer. @n
+ */
+int daBloomStats(DaStruct *da, int *err, DaBloomStats *stats);
+
+/**
+ * @brief Returns the index of the first element that isn't less than the @p key.
+ *
+ * The array must be sorted in ascending order according to @p cmp.
+ * @p cmp gets called with the @p key as first and an element of the array as second argument.
+ *
+ * @param[in]  da    Search this array.
+ * @param[out] err   Indicates what went wrong in the event of an error.
+ * @param[in]  key   Search the array for this key.
+ * @param[in]  cmp   Compares the @p key with an element.
+ * @param[out] index Index of the first element not less than the @p key or daSize() if there is none.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p key, @p cmp or @p index is a NULL-pointer.
+ */
+int daLowerBound(DaStruct *da, int *err, const void *key, DaCompare cmp, size_t *index);
+
+/**
+ * @brief Returns the index of the first element that is greater than the @p key.
+ *
+ * See daLowerBound() for the requirements.
+ *
+ * @param[in]  da    Search this array.
+ * @param[out] err   Indicates what went wrong in the event of an error.
+ * @param[in]  key   Search the array for this key.
+ * @param[in]  cmp   Compares the @p key with an element.
+ * @param[out] index Index of the first element greater than the @p key or daSize() if there is none.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p key, @p cmp or @p index is a NULL-pointer.
+ */
+int daUpperBound(DaStruct *da, int *err, const void *key, DaCompare cmp, size_t *index);
+
+/**
+ * @brief Returns the index of the first element equal to the @p key.
+ *
+ * See daLowerBound() for the requirements.
+ *
+ * @param[in]  da    Search this array.
+ * @param[out] err   Indicates what went wrong in the event of an error.
+ * @param[in]  key   Search the array for this key.
+ * @param[in]  cmp   Compares the @p key with an element.
+ * @param[out] index Index of the first element equal to the @p key.
+ *                   If there is none, the index at which the @p key would have to be inserted.
+ *
+ * @returns Returns  1 if the array contains the @p key.
+ * @returns Returns  0 if the array doesn't contain the @p key.
+ * @returns Returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the array doesn't contain the @p key (e.g. the array is empty). @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p key, @p cmp or @p index is a NULL-pointer.
+ */
+int daBinarySearch(DaStruct *da, int *err, const void *key, DaCompare cmp, size_t *index);
+
+/**
+ * @brief Returns the range of elements equal to the @p key.
+ *
+ * See daLowerBound() for the requirements.
+ *
+ * @param[in]  da    Search this array.
+ * @param[out] err   Indicates what went wrong in the event of an error.
+ * @param[in]  key   Search the array for this key.
+ * @param[in]  cmp   Compares the @p key with an element.
+ * @param[out] first Index of the first element equal to the @p key, like daLowerBound().
+ * @param[out] last  Index behind the last element equal to the @p key, like daUpperBound().
+ *
+ * @returns Returns  1 if the array contains the @p key.
+ * @returns Returns  0 if the array doesn't contain the @p key (@p first equals @p last).
+ * @returns Returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the array doesn't contain the @p key (e.g. the array is empty). @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p key, @p cmp, @p first or @p last is a NULL-pointer.
+ */
+int daEqualRange(DaStruct *da, int *err, const void *key, DaCompare cmp, size_t *first, size_t *last);
+
+/**
+ * @brief Returns the index of the first element whose key field isn't less than the @p key.
+ *
+ * Works like daLowerBound() but compares a numeric key field of the type @p type at @p offset of each element
+ * instead of calling a comparison function.
+ * The array must be sorted in ascending order by this field.
+ * The keys get compared as unsigned integers of the same width without branches if the host has such a type.
+ * Arrays larger than the CPU caches get prefetched ahead of the comparisons if the compiler supports it.
+ *
+ * Floating point keys are ordered by their sign and magnitude, -0.0 comes before 0.0 and NaNs sort before
+ * negative (negative NaN) respectively after positive (positive NaN) numbers.
+ *
+ * @param[in]  da     Search this array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  key    Search the array for this key, a value of the type @p type.
+ * @param[in]  type   Type of the key, one of ::DA_KEY_U8 to ::DA_KEY_F64.
+ * @param[in]  offset Offset of the key field within each element.
+ * @param[out] index  Index of the first element not less than the @p key or daSize() if there is none.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p key or @p index is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_UNKNOWN_MODE if @p type is unknown. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the key field exceeds the element.
+ */
+int daLowerBoundKey(DaStruct *da, int *err, const void *key, int type, size_t offset, size_t *index);
+
+/**
+ * @brief Returns the index of the first element whose key field is greater than the @p key.
+ *
+ * See daLowerBoundKey() for the comparison and the requirements.
+ *
+ * @param[in]  da     Search this array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  key    Search the array for this key, a value of the type @p type.
+ * @param[in]  type   Type of the key, one of ::DA_KEY_U8 to ::DA_KEY_F64.
+ * @param[in]  offset Offset of the key field within each element.
+ * @param[out] index  Index of the first element greater than the @p key or daSize() if there is none.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p key or @p index is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_UNKNOWN_MODE if @p type is unknown. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the key field exceeds the element.
+ */
+int daUpperBoundKey(DaStruct *da, int *err, const void *key, int type, size_t offset, size_t *index);
+
+/**
+ * @brief Returns the index of the first element whose key field equals the @p key.
+ *
+ * See daLowerBoundKey() for the comparison and the requirements.
+ *
+ * @param[in]  da     Search this array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  key    Search the array for this key, a value of the type @p type.
+ * @param[in]  type   Type of the key, one of ::DA_KEY_U8 to ::DA_KEY_F64.
+ * @param[in]  offset Offset of the key field within each element.
+ * @param[out] index  Index of the first element equal to the @p key.
+ *                    If there is none, the index at which the @p key would have to be inserted.
+ *
+ * @returns Returns  1 if the array contains the @p key.
+ * @returns Returns  0 if the array doesn't contain the @p key.
+ * @returns Returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the array doesn't contain the @p key (e.g. the array is empty). @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p key or @p index is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_UNKNOWN_MODE if @p type is unknown. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the key field exceeds the element.
+ */
+int daBinarySearchKey(DaStruct *da, int *err, const void *key, int type, size_t offset, size_t *index);
+
+/**
+ * @brief Returns the range of elements whose key field equals the @p key.
+ *
+ * See daLowerBoundKey() for the comparison and the requirements.
+ *
+ * @param[in]  da     Search this array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  key    Search the array for this key, a value of the type @p type.
+ * @param[in]  type   Type of the key, one of ::DA_KEY_U8 to ::DA_KEY_F64.
+ * @param[in]  offset Offset of the key field within each element.
+ * @param[out] first  Index of the first element equal to the @p key, like daLowerBoundKey().
+ * @param[out] last   Index behind the last element equal to the @p key, like daUpperBoundKey().
+ *
+ * @returns Returns  1 if the array contains the @p key.
+ * @returns Returns  0 if the array doesn't contain the @p key (@p first equals @p last).
+ * @returns Returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the array doesn't contain the @p key (e.g. the array is empty). @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p key, @p first or @p last is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_UNKNOWN_MODE if @p type is unknown. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the key field exceeds the element.
+ */
+int daEqualRangeKey(DaStruct *da, int *err, const void *key, int type, size_t offset, size_t *first, size_t *last);
+
+/**
+ * @brief The function sorts the array in ascending order with the comparison function @p cmp.
+ *
+ * The array gets sorted in place by an introsort: a quicksort with median of three pivots and insertion sort
+ * for small partitions that switches to heapsort if the partitions become unbalanced, so it never takes more
+ * than O(n log n) comparisons and needs no additional memory. The sort isn't stable, see daSortStable().
+ * An attached index gets rebuilt afterwards.
+ *
+ * @param[in]  da  Sort this array.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  cmp Compares two elements.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p cmp is a NULL-pointer.
+ */
+int daSort(DaStruct *da, int *err, DaCompare cmp);
+
+/**
+ * @brief The function sorts the array in ascending order with the comparison function @p cmp and keeps the order of equal elements.
+ *
+ * The array gets sorted by a merge sort of insertion sorted runs that needs a temporary buffer of the size of the used elements.
+ * An attached index gets rebuilt afterwards.
+ *
+ * @param[in]  da  Sort this array.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  cmp Compares two elements.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device for the temporary buffer. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p cmp is a NULL-pointer.
+ */
+int daSortStable(DaStruct *da, int *err, DaCompare cmp);
+
+/**
+ * @brief The function sorts the array in ascending order with the comparison function @p cmp using up to @p threads threads.
+ *
+ * Arrays larger than ::DA_PARALLEL_THRESHOLD bytes get split into a power of two runs, at least one per thread,
+ * that get sorted by introsort in parallel. Afterwards pairs of adjacent runs get merged in parallel until a single run is left.
+ * Smaller arrays get sorted like daSort() does. The sort isn't stable.
+ *
+ * The merges need a scratch buffer of the size of the used elements. It gets counted against DaStruct#maxBytes together
+ * with the allocated elements: if the array couldn't grow by the size of the scratch buffer or no memory is left,
+ * the runs get merged in place by rotations instead, which takes more time but no additional memory.
+ * An attached index gets rebuilt afterwards.
+ *
+ * @param[in]  da      Sort this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  cmp     Compares two elements, it gets called from several threads at once.
+ * @param[in]  threads Maximum number of threads, including the calling one.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p cmp is a NULL-pointer.
+ */
+int daSortParallel(DaStruct *da, int *err, DaCompare cmp, size_t threads);
+
+/**
+ * @brief The function sorts the array in ascending order by a numeric key field without a comparison function.
+ *
+ * The elements get sorted by a least significant digit radix sort over the bytes of the key field of the type @p type
+ * at @p offset, in the order described for daLowerBoundKey(). Passes over bytes that are equal in all keys get skipped.
+ * The sort is stable and takes O(n) time per key byte.
+ *
+ * Elements up to ::DA_SORT_INDIRECT bytes get moved in every pass through a temporary buffer of the size of the used elements.
+ * Larger elements get sorted indirectly: the keys get sorted together with the element positions and the
+ * resulting permutation moves every element once in place.
+ * An attached index gets rebuilt afterwards.
+ *
+ * @param[in]  da     Sort this array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  type   Type of the key field, one of ::DA_KEY_U8 to ::DA_KEY_F64.
+ * @param[in]  offset Offset of the key field within each element.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device for the temporary buffer. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_UNKNOWN_MODE if @p type is unknown. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the key field exceeds the element.
+ */
+int daSortByKey(DaStruct *da, int *err, int type, size_t offset);
+
+/**
+ * @brief The function merges the sorted arrays @p a and @p b into the sorted array @p dst.
+ *
+ * The result holds all elements of both arrays, equal elements of @p a come before the ones of @p b.
+ * Runs of elements that are less than the next element of the other array get found by galloping: probes at
+ * exponentially growing distances followed by a binary search. So merging arrays of very different sizes takes
+ * O(m log(n / m)) comparisons, m being the size of the smaller array, and the runs get copied at once.
+ * Attached indexes and filters of @p dst get rebuilt afterwards.
+ *
+ * @param[out] dst Receives the result, its previous elements get removed.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  a   First array, sorted in ascending order by @p cmp.
+ * @param[in]  b   Second array, sorted in ascending order by @p cmp.
+ * @param[in]  cmp Compares two elements.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned, @p dst is empty and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p dst, @p a, @p b or @p cmp is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_EXCEEDS_SIZE_LIMIT if the result would exceed the bytes limit of @p dst. @n
+ * ::DA_PARAM_ERR | ::DA_INCOMPATIBLE if the element sizes differ or @p dst is @p a or @p b.
+ */
+int daMerge(DaStruct *dst, int *err, const DaStruct *a, const DaStruct *b, DaCompare cmp);
+
+/**
+ * @brief The function stores the union of the sorted arrays @p a and @p b in @p dst.
+ *
+ * Works like daMerge() but takes pairs of equal elements only once from @p a.
+ * If neither array holds duplicates, the result holds every element contained in any of them once.
+ *
+ * @param[out] dst Receives the result, its previous elements get removed.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  a   First array, sorted in ascending order by @p cmp.
+ * @param[in]  b   Second array, sorted in ascending order by @p cmp.
+ * @param[in]  cmp Compares two elements.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned, @p dst is empty and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * See daMerge().
+ */
+int daUnion(DaStruct *dst, int *err, const DaStruct *a, const DaStruct *b, DaCompare cmp);
+
+/**
+ * @brief The function stores the intersection of the sorted arrays @p a and @p b in @p dst.
+ *
+ * Works like daMerge() but only takes the elements of @p a that have an equal element in @p b, every element of @p b
+ * matches once. Intersecting a small with a large array takes O(m log(n / m)) comparisons.
+ *
+ * @param[out] dst Receives the result, its previous elements get removed.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  a   First array, sorted in ascending order by @p cmp.
+ * @param[in]  b   Second array, sorted in ascending order by @p cmp.
+ * @param[in]  cmp Compares two elements.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned, @p dst is empty and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * See daMerge().
+ */
+int daIntersect(DaStruct *dst, int *err, const DaStruct *a, const DaStruct *b, DaCompare cmp);
+
+/**
+ * @brief The function stores the elements of the sorted array @p a that aren't in the sorted array @p b in @p dst.
+ *
+ * Works like daMerge() but only takes the elements of @p a that have no equal element in @p b, every element of @p b
+ * matches once.
+ *
+ * @param[out] dst Receives the result, its previous elements get removed.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  a   First array, sorted in ascending order by @p cmp.
+ * @param[in]  b   Second array, sorted in ascending order by @p cmp.
+ * @param[in]  cmp Compares two elements.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned, @p dst is empty and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * See daMerge().
+ */
+int daDifference(DaStruct *dst, int *err, const DaStruct *a, const DaStruct *b, DaCompare cmp);
+
+/**
+ * @brief Returns the smallest value of a numeric field in the elements @p from to @p to.
+ *
+ * The field of the type @p type at @p offset of each element gets compared in the order described for
+ * daLowerBoundKey(), as unsigned integers of the same width without branches.
+ *
+ * @param[in]  da     Search this array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  type   Type of the field, one of ::DA_KEY_U8 to ::DA_KEY_F64.
+ * @param[in]  offset Offset of the field within each element.
+ * @param[in]  from   First element of the range (0 based).
+ * @param[in]  to     Last element of the range (0 based).
+ * @param[out] value  Receives the smallest value (the width of @p type bytes) or a NULL pointer.
+ * @param[out] index  Receives the index of the first element with the smallest value or a NULL pointer.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer or both @p value and @p index are NULL-pointers. @n
+ * ::DA_PARAM_ERR | ::DA_UNKNOWN_MODE if @p type is unknown. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the field exceeds the element or the range exceeds the array (@p from > @p to or @p to >= daSize()).
+ */
+int daMin(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, void *value, size_t *index);
+
+/**
+ * @brief Returns the smallest value of a numeric field in the elements @p from to @p to with up to @p threads threads.
+ *
+ * Works like daMin() but splits ranges larger than ::DA_PARALLEL_THRESHOLD bytes into blocks of ::DA_PARALLEL_BLOCK
+ * bytes that get reduced in parallel. The result is always the same as the one of daMin().
+ *
+ * @param[in]  da      Search this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  type    Type of the field, one of ::DA_KEY_U8 to ::DA_KEY_F64.
+ * @param[in]  offset  Offset of the field within each element.
+ * @param[in]  from    First element of the range (0 based).
+ * @param[in]  to      Last element of the range (0 based).
+ * @param[out] value   Receives the smallest value (the width of @p type bytes) or a NULL pointer.
+ * @param[out] index   Receives the index of the first element with the smallest value or a NULL pointer.
+ * @param[in]  threads Maximum number of threads, including the calling one.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * See daMin().
+ */
+int daMinParallel(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, void *value, size_t *index, size_t threads);
+
+/**
+ * @brief Returns the largest value of a numeric field in the elements @p from to @p to.
+ *
+ * See daMin() for the comparison.
+ *
+ * @param[in]  da     Search this array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  type   Type of the field, one of ::DA_KEY_U8 to ::DA_KEY_F64.
+ * @param[in]  offset Offset of the field within each element.
+ * @param[in]  from   First element of the range (0 based).
+ * @param[in]  to     Last element of the range (0 based).
+ * @param[out] value  Receives the largest value (the width of @p type bytes) or a NULL pointer.
+ * @param[out] index  Receives the index of the first element with the largest value or a NULL pointer.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * See daMin().
+ */
+int daMax(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, void *value, size_t *index);
+
+/**
+ * @brief Returns the largest value of a numeric field in the elements @p from to @p to with up to @p threads threads.
+ *
+ * Works like daMax() and splits the range like daMinParallel().
+ *
+ * @param[in]  da      Search this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  type    Type of the field, one of ::DA_KEY_U8 to ::DA_KEY_F64.
+ * @param[in]  offset  Offset of the field within each element.
+ * @param[in]  from    First element of the range (0 based).
+ * @param[in]  to      Last element of the range (0 based).
+ * @param[out] value   Receives the largest value (the width of @p type bytes) or a NULL pointer.
+ * @param[out] index   Receives the index of the first element with the largest value or a NULL pointer.
+ * @param[in]  threads Maximum number of threads, including the calling one.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * See daMin().
+ */
+int daMaxParallel(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, void *value, size_t *index, size_t threads);
+
+/**
+ * @brief Returns the sum of a numeric field in the elements @p from to @p to.
+ *
+ * Integer fields get added exactly in an accumulator twice as wide as an unsigned long, so the sum can't overflow.
+ * It only gets rounded when it is converted to a double at the end, which happens for sums beyond 2^53 in magnitude,
+ * e.g. of large 64 bit fields. daSumLong() returns integer sums exactly.
+ * Floating point fields get added as doubles with a compensated summation.
+ *
+ * @param[in]  da     Sum up the elements of this array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  type   Type of the field, one of ::DA_KEY_U8 to ::DA_KEY_F64.
+ * @param[in]  offset Offset of the field within each element.
+ * @param[in]  from   First element of the range (0 based).
+ * @param[in]  to     Last element of the range (0 based).
+ * @param[out] sum    Receives the sum.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p sum is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_UNKNOWN_MODE if @p type is unknown. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the field exceeds the element or the range exceeds the array (@p from > @p to or @p to >= daSize()).
+ */
+int daSum(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, double *sum);
+
+/**
+ * @brief Returns the sum of a numeric field in the elements @p from to @p to with up to @p threads threads.
+ *
+ * Works like daSum() and splits the range like daMinParallel().
+ * Integer sums are the same as the ones of daSum(), floating point sums may differ in the last bits.
+ *
+ * @param[in]  da      Sum up the elements of this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  type    Type of the field, one of ::DA_KEY_U8 to ::DA_KEY_F64.
+ * @param[in]  offset  Offset of the field within each element.
+ * @param[in]  from    First element of the range (0 based).
+ * @param[in]  to      Last element of the range (0 based).
+ * @param[out] sum     Receives the sum.
+ * @param[in]  threads Maximum number of threads, including the calling one.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * See daSum().
+ */
+int daSumParallel(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, double *sum, size_t threads);
+
+/**
+ * @brief Returns the exact sum of an integer field in the elements @p from to @p to.
+ *
+ * Works like daSum() but returns the sum as a long instead of rounding it to a double.
+ *
+ * @param[in]  da     Sum up the elements of this array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  type   Type of the field, one of ::DA_KEY_U8 to ::DA_KEY_S64.
+ * @param[in]  offset Offset of the field within each element.
+ * @param[in]  from   First element of the range (0 based).
+ * @param[in]  to     Last element of the range (0 based).
+ * @param[out] sum    Receives the sum.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p sum is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_UNKNOWN_MODE if @p type is unknown or a floating point type. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the field exceeds the element or the range exceeds the array (@p from > @p to or @p to >= daSize()). @n
+ * ::DA_PARAM_ERR | ::DA_EXCEEDS_SIZE_LIMIT if the sum doesn't fit into a long.
+ */
+int daSumLong(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, long *sum);
+
+/**
+ * @brief Returns the exact sum of an integer field in the elements @p from to @p to with up to @p threads threads.
+ *
+ * Works like daSumLong() and splits the range like daMinParallel(), the sum is the same as the one of daSumLong().
+ *
+ * @param[in]  da      Sum up the elements of this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  type    Type of the field, one of ::DA_KEY_U8 to ::DA_KEY_S64.
+ * @param[in]  offset  Offset of the field within each element.
+ * @param[in]  from    First element of the range (0 based).
+ * @param[in]  to      Last element of the range (0 based).
+ * @param[out] sum     Receives the sum.
+ * @param[in]  threads Maximum number of threads, including the calling one.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * See daSumLong().
+ */
+int daSumLongParallel(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, long *sum, size_t threads);
+
+/**
+ * @brief Returns the arithmetic mean of a numeric field in the elements @p from to @p to.
+ *
+ * The sum gets calculated like by daSum().
+ *
+ * @param[in]  da     Average the elements of this array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  type   Type of the field, one of ::DA_KEY_U8 to ::DA_KEY_F64.
+ * @param[in]  offset Offset of the field within each element.
+ * @param[in]  from   First element of the range (0 based).
+ * @param[in]  to     Last element of the range (0 based).
+ * @param[out] mean   Receives the mean.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p mean is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_UNKNOWN_MODE if @p type is unknown. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the field exceeds the element or the range exceeds the array (@p from > @p to or @p to >= daSize()).
+ */
+int daMean(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, double *mean);
+
+/**
+ * @brief Returns the arithmetic mean of a numeric field in the elements @p from to @p to with up to @p threads threads.
+ *
+ * Works like daMean() and calculates the sum like daSumParallel().
+ *
+ * @param[in]  da      Average the elements of this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  type    Type of the field, one of ::DA_KEY_U8 to ::DA_KEY_F64.
+ * @param[in]  offset  Offset of the field within each element.
+ * @param[in]  from    First element of the range (0 based).
+ * @param[in]  to      Last element of the range (0 based).
+ * @param[out] mean    Receives the mean.
+ * @param[in]  threads Maximum number of threads, including the calling one.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * See daMean().
+ */
+int daMeanParallel(DaStruct *da, int *err, int type, size_t offset, size_t from, size_t to, double *mean, size_t threads);
+
+/**
+ * @brief Calls @p visit for consecutive blocks of elements from the start to the end of the array.
+ *
+ * The parameters get checked once instead of once per element like by a loop over daGet(). The blocks have about
+ * ::DA_PARALLEL_BLOCK bytes. The traversal stops early if @p visit returns a non-zero value.
+ *
+ * @param[in]  da    Visit the elements of this array.
+ * @param[out] err   Indicates what went wrong in the event of an error.
+ * @param[in]  visit Gets called for each block.
+ * @param[in]  ctx   Passed to @p visit.
+ *
+ * @returns Returns 0 if all elements were visited and 1 if @p visit stopped the traversal.
+ * @returns Returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p visit is a NULL-pointer.
+ */
+int daForEach(DaStruct *da, int *err, DaBlockVisitor visit, void *ctx);
+
+/**
+ * @brief Calls @p map for consecutive blocks of elements to change them in place.
+ *
+ * The blocks are the same as for daForEach(). An attached hash index or Bloom filter gets rebuilt afterwards
+ * because the elements may have changed.
+ *
+ * @param[in]  da  Change the elements of this array.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  map Gets called for each block.
+ * @param[in]  ctx Passed to @p map.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p map is a NULL-pointer.
+ */
+int daMapInPlace(DaStruct *da, int *err, DaBlockMapper map, void *ctx);
+
+/**
+ * @brief Calls @p map for consecutive blocks of elements with up to @p threads threads.
+ *
+ * Works like daMapInPlace(), but the blocks get handed out to the threads, so @p map gets called concurrently for
+ * different blocks in no particular order. Arrays smaller than ::DA_PARALLEL_THRESHOLD bytes are handled by the
+ * calling thread alone. Without @c DA_THREADS the function works like daMapInPlace().
+ *
+ * @param[in]  da      Change the elements of this array.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  map     Gets called for each block.
+ * @param[in]  ctx     Passed to @p map.
+ * @param[in]  threads Maximum number of threads, including the calling one.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * See daMapInPlace().
+ */
+int daMapInPlaceParallel(DaStruct *da, int *err, DaBlockMapper map, void *ctx, size_t threads);
+
+/**
+ * @brief Folds the elements into the accumulator @p acc by calling @p reduce for consecutive blocks.
+ *
+ * The blocks are the same as for daForEach() and get folded in order.
+ *
+ * @param[in]     da     Reduce the elements of this array.
+ * @param[out]    err    Indicates what went wrong in the event of an error.
+ * @param[in]     reduce Gets called for each block.
+ * @param[in,out] acc    The accumulator, initialized by the caller.
+ * @param[in]     ctx    Passed to @p reduce.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p reduce or @p acc is a NULL-pointer.
+ */
+int daReduce(DaStruct *da, int *err, DaBlockReducer reduce, void *acc, void *ctx);
+
+/**
+ * @brief Folds the elements into the accumulator @p acc with up to @p threads threads.
+ *
+ * Every block gets folded by @p reduce into its own copy of the initial @p acc, so @p acc must hold the identity of
+ * @p combine (e.g. 0 for a sum). The partial accumulators get combined into @p acc in the order of the blocks, so
+ * @p combine only needs to be associative. If the array is smaller than ::DA_PARALLEL_THRESHOLD bytes or the
+ * partial accumulators can't be allocated, the calling thread folds the elements alone like daReduce().
+ *
+ * @param[in]     da       Reduce the elements of this array.
+ * @param[out]    err      Indicates what went wrong in the event of an error.
+ * @param[in]     reduce   Gets called for each block.
+ * @param[in]     combine  Combines two accumulators.
+ * @param[in,out] acc      The accumulator, initialized with the identity of @p combine.
+ * @param[in]     accBytes Size of the accumulator in bytes.
+ * @param[in]     ctx      Passed to @p reduce and @p combine.
+ * @param[in]     threads  Maximum number of threads, including the calling one.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da, @p reduce, @p combine or @p acc is a NULL-pointer or @p accBytes is 0.
+ */
+int daReduceParallel(DaStruct *da, int *err, DaBlockReducer reduce, DaCombine combine, void *acc, size_t accBytes, void *ctx, size_t threads);
+
+/**
+ * @brief Initializes a view of @p n elements of the array starting at @p pos.
+ *
+ * The view neither allocates memory nor copies elements, it refers to the elements in place.
+ * See ::DaView for its lifetime rules.
+ *
+ * @param[in]  da   Base array of the view.
+ * @param[out] err  Indicates what went wrong in the event of an error.
+ * @param[in]  pos  First element of the view (0 based).
+ * @param[in]  n    Number of elements of the view, may be 0.
+ * @param[out] view Receives the view.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da or @p view is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the view exceeds the array (@p pos + @p n > daSize()).
+ */
+int daView(DaStruct *da, int *err, size_t pos, size_t n, DaView *view);
+
+/**
+ * @brief Initializes a view of @p n elements of another view starting at @p pos.
+ *
+ * The new view refers to the base array of @p view. @p out may point to @p view.
+ *
+ * @param[in]  view View to take the elements from.
+ * @param[out] err  Indicates what went wrong in the event of an error.
+ * @param[in]  pos  First element of the new view, relative to @p view (0 based).
+ * @param[in]  n    Number of elements of the new view, may be 0.
+ * @param[out] out  Receives the new view.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p view, its base array or @p out is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the new view exceeds @p view or @p view exceeds its base array.
+ */
+int daViewSlice(const DaView *view, int *err, size_t pos, size_t n, DaView *out);
+
+/**
+ * @brief Returns the number of elements of the view.
+ *
+ * @param[in]  view Get the size of this view.
+ * @param[out] err  Indicates what went wrong in the event of an error.
+ *
+ * @returns Returns the number of elements on success, otherwise 0 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p view or its base array is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the view exceeds its base array.
+ */
+size_t daViewSize(const DaView *view, int *err);
+
+/**
+ * @brief Returns the element at position @p pos of the view.
+ *
+ * @param[in]  view Get the element of this view.
+ * @param[out] err  Indicates what went wrong in the event of an error.
+ * @param[in]  pos  Position of the element, relative to the view (0 based).
+ *
+ * @returns Returns a pointer to the element on success, otherwise a NULL pointer is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p view or its base array is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if @p pos is not within the view or the view exceeds its base array.
+ */
+void *daViewGet(const DaView *view, int *err, size_t pos);
+
+/**
+ * @brief Checks whether the view contains the @p element.
+ *
+ * Works like daContains(). A hash index or Bloom filter of the base array doesn't get used.
+ *
+ * @param[in]  view    Search this view.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  element Search the view for this element.
+ *
+ * @returns Returns 1 if the view contains the @p element and 0 if not.
+ * @returns The function returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the view doesn't contain an element equal to the specified @p element. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p view, its base array or @p element is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the view exceeds its base array.
+ */
+int daViewContains(const DaView *view, int *err, const void *element);
+
+/**
+ * @brief Returns the index of the first occurence of the @p element in the view.
+ *
+ * Works like daIndexOf(). A hash index or Bloom filter of the base array doesn't get used.
+ *
+ * @param[in]  view    Search this view.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  element Search the view for this element.
+ * @param[out] index   Index of the @p element relative to the view (0 based).
+ *
+ * @returns Returns  1 if the view contains the @p element and the index is returned via @p index.
+ * @returns Returns  0 if the view doesn't contain the @p element.
+ * @returns Returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the view doesn't contain an element equal to the specified @p element. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p view, its base array, @p element or @p index is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the view exceeds its base array.
+ */
+int daViewIndexOf(const DaView *view, int *err, const void *element, size_t *index);
+
+/**
+ * @brief Returns the index of the last occurence of the @p element in the view.
+ *
+ * Works like daLastIndexOf(). A hash index or Bloom filter of the base array doesn't get used.
+ *
+ * @param[in]  view    Search this view.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  element Search the view for this element.
+ * @param[out] index   Index of the @p element relative to the view (0 based).
+ *
+ * @returns Returns  1 if the view contains the @p element and the index is returned via @p index.
+ * @returns Returns  0 if the view doesn't contain the @p element.
+ * @returns Returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * See daViewIndexOf().
+ */
+int daViewLastIndexOf(const DaView *view, int *err, const void *element, size_t *index);
+
+/**
+ * @brief Returns the number of occurences of the @p element in the view.
+ *
+ * Works like daCount(). A hash index or Bloom filter of the base array doesn't get used.
+ *
+ * @param[in]  view    Search this view.
+ * @param[out] err     Indicates what went wrong in the event of an error.
+ * @param[in]  element Count the elements equal to this one.
+ * @param[out] count   Number of occurences.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p view, its base array, @p element or @p count is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the view exceeds its base array.
+ */
+int daViewCount(const DaView *view, int *err, const void *element, size_t *count);
+
+/**
+ * @brief Returns the index of the first element of the view that is not less than the @p key.
+ *
+ * Works like daLowerBound(), only the view needs to be sorted.
+ *
+ * @param[in]  view  Search this view.
+ * @param[out] err   Indicates what went wrong in the event of an error.
+ * @param[in]  key   Search the view for this key.
+ * @param[in]  cmp   Compares the @p key with an element.
+ * @param[out] index Index relative to the view or daViewSize() if there is none.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p view, its base array, @p key, @p cmp or @p index is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the view exceeds its base array.
+ */
+int daViewLowerBound(const DaView *view, int *err, const void *key, DaCompare cmp, size_t *index);
+
+/**
+ * @brief Returns the index of the first element of the view equal to the @p key.
+ *
+ * Works like daBinarySearch(), only the view needs to be sorted.
+ *
+ * @param[in]  view  Search this view.
+ * @param[out] err   Indicates what went wrong in the event of an error.
+ * @param[in]  key   Search the view for this key.
+ * @param[in]  cmp   Compares the @p key with an element.
+ * @param[out] index Index relative to the view.
+ *                   If there is none, the index at which the @p key would have to be inserted.
+ *
+ * @returns Returns  1 if the view contains the @p key.
+ * @returns Returns  0 if the view doesn't contain the @p key.
+ * @returns Returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the view doesn't contain the @p key. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p view, its base array, @p key, @p cmp or @p index is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the view exceeds its base array.
+ */
+int daViewBinarySearch(const DaView *view, int *err, const void *key, DaCompare cmp, size_t *index);
+
+/**
+ * @brief Returns the smallest value of a numeric field in the elements of the view.
+ *
+ * Works like daMin() on the whole view.
+ *
+ * @param[in]  view   Search this view.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  type   Type of the field, one of ::DA_KEY_U8 to ::DA_KEY_F64.
+ * @param[in]  offset Offset of the field within each element.
+ * @param[out] value  Receives the value or a NULL pointer.
+ * @param[out] index  Receives the index relative to the view or a NULL pointer.
+ *
+ * @returns Returns 0 on success or if the view is empty, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the view is empty, @p value and @p index remain unchanged. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p view or its base array is a NULL-pointer or both @p value and @p index are. @n
+ * ::DA_PARAM_ERR | ::DA_UNKNOWN_MODE if @p type is unknown. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the field exceeds the element or the view exceeds its base array.
+ */
+int daViewMin(const DaView *view, int *err, int type, size_t offset, void *value, size_t *index);
+
+/**
+ * @brief Returns the largest value of a numeric field in the elements of the view.
+ *
+ * Works like daMax() on the whole view.
+ *
+ * @param[in]  view   Search this view.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  type   Type of the field, one of ::DA_KEY_U8 to ::DA_KEY_F64.
+ * @param[in]  offset Offset of the field within each element.
+ * @param[out] value  Receives the value or a NULL pointer.
+ * @param[out] index  Receives the index relative to the view or a NULL pointer.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * See daViewMin().
+ */
+int daViewMax(const DaView *view, int *err, int type, size_t offset, void *value, size_t *index);
+
+/**
+ * @brief Returns the sum of a numeric field in the elements of the view.
+ *
+ * Works like daSum() on the whole view.
+ *
+ * @param[in]  view   Sum up the elements of this view.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  type   Type of the field, one of ::DA_KEY_U8 to ::DA_KEY_F64.
+ * @param[in]  offset Offset of the field within each element.
+ * @param[out] sum    Receives the sum, 0 for an empty view.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p view, its base array or @p sum is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_UNKNOWN_MODE if @p type is unknown. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the field exceeds the element or the view exceeds its base array.
+ */
+int daViewSum(const DaView *view, int *err, int type, size_t offset, double *sum);
+
+/**
+ * @brief Returns the arithmetic mean of a numeric field in the elements of the view.
+ *
+ * Works like daMean() on the whole view.
+ *
+ * @param[in]  view   Average the elements of this view.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  type   Type of the field, one of ::DA_KEY_U8 to ::DA_KEY_F64.
+ * @param[in]  offset Offset of the field within each element.
+ * @param[out] mean   Receives the mean.
+ *
+ * @returns Returns 0 on success or if the view is empty, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_NOT_FOUND if the view is empty, @p mean remains unchanged. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p view, its base array or @p mean is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_UNKNOWN_MODE if @p type is unknown. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the field exceeds the element or the view exceeds its base array.
+ */
+int daViewMean(const DaView *view, int *err, int type, size_t offset, double *mean);
+
+/**
+ * @brief Calls @p visit for consecutive blocks of elements of the view.
+ *
+ * Works like daForEach(), the positions passed to @p visit are relative to the view.
+ *
+ * @param[in]  view  Visit the elements of this view.
+ * @param[out] err   Indicates what went wrong in the event of an error.
+ * @param[in]  visit Gets called for each block.
+ * @param[in]  ctx   Passed to @p visit.
+ *
+ * @returns Returns 0 if all elements were visited and 1 if @p visit stopped the traversal.
+ * @returns Returns -1 in the event of an error and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p view, its base array or @p visit is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the view exceeds its base array.
+ */
+int daViewForEach(const DaView *view, int *err, DaBlockVisitor visit, void *ctx);
+
+/**
+ * @brief Folds the elements of the view into the accumulator @p acc.
+ *
+ * Works like daReduce(), the positions passed to @p reduce are relative to the view.
+ *
+ * @param[in]     view   Reduce the elements of this view.
+ * @param[out]    err    Indicates what went wrong in the event of an error.
+ * @param[in]     reduce Gets called for each block.
+ * @param[in,out] acc    The accumulator, initialized by the caller.
+ * @param[in]     ctx    Passed to @p reduce.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p view, its base array, @p reduce or @p acc is a NULL-pointer. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the view exceeds its base array.
+ */
+int daViewReduce(const DaView *view, int *err, DaBlockReducer reduce, void *acc, void *ctx);
+
+/**
+ * @brief Returns a copy of the array.
+ *
+ * The initial array @p da remains unchanged.
+ *
+ * @param[in]  da  Clone this array.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ *
+ * @returns Returns a pointer to the cloned array on success, otherwise a NULL pointer is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer. @n
+ */
+DaStruct *daClone(const DaStruct *da, int *err);
+
+/**
+ * @brief Moves all elements of @p src to the end of @p dst.
+ *
+ * @p dst grows at most once and the elements get copied with a single memcpy(). If @p dst is empty and the bytes
+ * limits of both arrays allow it, the arrays swap their buffers instead, so no element gets copied at all.
+ * @p src is empty after successful execution. Both arrays remain unchanged in the event of an error.
+ *
+ * @param[in]  dst Append the elements to this array.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  src Take the elements from this array.
+ *
+ * @returns Returns 0 on success, otherwise -1 is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device. @n
+ * ::DA_PARAM_ERR | ::DA_EXCEEDS_SIZE_LIMIT if @p dst can't hold the elements of @p src. @n
+ * ::DA_PARAM_ERR | ::DA_INCOMPATIBLE if @p dst is @p src or the element sizes differ. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p dst or @p src is a NULL-pointer.
+ */
+int daConcat(DaStruct *dst, int *err, DaStruct *src);
+
+/**
+ * @brief Moves the elements from position @p pos to the end of the array into a new array.
+ *
+ * The new array has the element size and bytes limit of @p da and the elements get copied with a single memcpy().
+ * @p da keeps the elements in front of @p pos. @p da remains unchanged in the event of an error.
+ *
+ * @param[in]  da  Split this array.
+ * @param[out] err Indicates what went wrong in the event of an error.
+ * @param[in]  pos First element of the new array (0 based), daSize() results in an empty array.
+ *
+ * @returns Returns a pointer to the new array on success, otherwise a NULL pointer is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if @p pos > daSize(). @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p da is a NULL-pointer.
+ */
+DaStruct *daSplitAt(DaStruct *da, int *err, size_t pos);
+
+/**
+ * @brief Copies the elements @p from to @p to of @p src to position @p dstPos of @p dst.
+ *
+ * The elements of @p dst from @p dstPos on get overwritten, and @p dst grows if the copy exceeds its end.
+ * The elements get copied with a single memmove(), so @p src may be @p dst even if the ranges overlap.
+ * An attached index and filter of @p dst get updated for the copies like daSetRange() does.
+ * @p dst remains unchanged in the event of an error.
+ *
+ * @param[in]  dst    Copy the elements to this array.
+ * @param[out] err    Indicates what went wrong in the event of an error.
+ * @param[in]  dstPos Position of the first copy in @p dst (0 based), at most daSize() of @p dst.
+ * @param[in]  src    Copy the elements of this array.
+ * @param[in]  from   First element to copy (0 based).
+ * @param[in]  to     Last element to copy (0 based).
+ *
+ * @returns Returns a pointer to the first copy on success, otherwise a NULL pointer is returned and @p err is set appropriately.
+ *
+ * @b Errors @n
+ * ::DA_OK on success. @n
+ * ::DA_FATAL | ::DA_ENOMEM if no space is left on device. @n
+ * ::DA_PARAM_ERR | ::DA_EXCEEDS_SIZE_LIMIT if @p dst can't hold the copies. @n
+ * ::DA_PARAM_ERR | ::DA_OUT_OF_BOUNDS if the range exceeds @p src (@p from > @p to or @p to >= daSize()) or @p dstPos exceeds @p dst. @n
+ * ::DA_PARAM_ERR | ::DA_INCOMPATIBLE if the element sizes differ. @n
+ * ::DA_PARAM_ERR | ::DA_PARAM_NULL if @p dst or @p src is a NULL-pointer.
+ */
+void *daCopyRange(DaStruct *dst, int *err, size_t dstPos, const DaStruct *src, size_t from, size_t to);
 
 /**
  * @brief Returns the number encoded error code as a string.
@@ -0,0 +1,101 @@
+#include "sput.h"
+#include "dynar.h"
+
+static void testNull(void)
+{
+    int err;
+    int buffer[4];
+    DaDesc desc;
+
+    desc.elements = 1;
+    desc.bytesPerElement = sizeof(int);
+    desc.maxBytes = sizeof(buffer);
+
+    sput_fail_if(daAdopt(&desc, NULL, buffer, 0, 4) != NULL, "daAdopt(&desc, NULL, buffer, 0, 4) != NULL");
+    sput_fail_if(daAdopt(&desc, &err, NULL,   0, 4) != NULL, "daAdopt(&desc, &err, NULL,   0, 4) != NULL");
+    sput_fail_if(daAdopt(NULL,  &err, buffer, 0, 4) != NULL, "daAdopt(NULL,  &err, buffer, 0, 4) != NULL");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+
+    sput_fail_if(daAdopt(&desc, &err, buffer, 0, 0) != NULL, "daAdopt(&desc, &err, buffer, 0, 0) with 0 capacity != NULL");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+
+    desc.bytesPerElement = 0;
+    sput_fail_if(daAdopt(&desc, &err, buffer, 0, 4) != NULL, "daAdopt(&desc, &err, buffer, 0, 4) with 0 bytesPerElement != NULL");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testBounds(void)
+{
+    int err;
+    int buffer[4];
+    DaDesc desc;
+
+    desc.elements = 1;
+    desc.bytesPerElement = sizeof(int);
+    desc.maxBytes = sizeof(buffer);
+
+    sput_fail_if(daAdopt(&desc, &err, buffer, 5, 4) != NULL, "daAdopt should fail if used exceeds the capacity");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daAdopt(&desc, &err, buffer, 0, 5) != NULL, "daAdopt should fail if the buffer exceeds the bytes limit");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT), "err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT)");
+}
+
+static void testAdopt(void)
+{
+    int err;
+    int i;
+    int failed;
+    int *buffer;
+    DaDesc desc;
+    DaStruct *da;
+
+    buffer = malloc(10 * sizeof(int));
+    sput_fail_if(buffer == NULL, "No space left on device. Unable to test!");
+
+    for (i = 0; i < 6; i++)
+    {
+        buffer[i] = i;
+    }
+
+    desc.elements = 1;
+    desc.bytesPerElement = sizeof(int);
+    desc.maxBytes = 1000 * sizeof(int);
+
+    da = daAdopt(&desc, &err, buffer, 6, 10);
+    sput_fail_if(da == NULL || err != DA_OK, "daAdopt should succeed");
+    sput_fail_if(da->firstAddr != buffer, "daAdopt shouldn't copy the elements");
+    sput_fail_if(daSize(da, &err) != 6 || da->max != 10, "daAdopt should take over used and capacity");
+
+    /* The array has to reallocate the adopted buffer */
+    for (i = 6; i < 1000; i++)
+    {
+        daAppend(da, &err, &i);
+    }
+
+    for (i = 0, failed = 0; i < 1000; i++)
+    {
+        failed |= *(int *)daGet(da, &err, i) != i;
+    }
+
+    sput_fail_if(failed, "The adopted array should grow like any other array");
+    sput_fail_if(daDestroy(da, &err) != 0, "daDestroy should free the adopted buffer");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daAdopt should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daAdopt should check the sizes");
+    sput_run_test(testBounds);
+
+    sput_enter_suite("daAdopt should take over a buffer");
+    sput_run_test(testAdopt);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
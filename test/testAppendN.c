@@ -0,0 +1,138 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static void testNull(void)
+{
+    int err;
+    int ignore = 0;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daAppendN(NULL, NULL, &ignore, 1) != NULL, "daAppendN(NULL, NULL, &ignore, 1) != NULL");
+    sput_fail_if(daAppendN(&da,  NULL, &ignore, 1) != NULL, "daAppendN(da,   NULL, &ignore, 1) != NULL");
+
+    sput_fail_if(daAppendN(&da,  &err, NULL, 1)    != NULL, "daAppendN(da,   &err, NULL, 1)    != NULL");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+
+    sput_fail_if(daAppendN(NULL, &err, &ignore, 1) != NULL, "daAppendN(NULL, &err, &ignore, 1) != NULL");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testAppend(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createArray(1, 3, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daAppendN(da, &err, "01", 2) != (char *)da->firstAddr, "daAppendN should return the address of the first appended element");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+    sput_fail_if(da->used != 2 || memcmp(da->firstAddr, "01", 2) != 0, "daAppendN should append all elements");
+
+    sput_fail_if(daAppendN(da, &err, "2345678", 7) != (char *)da->firstAddr + 2, "daAppendN should return the address of the first appended element");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+    sput_fail_if(da->used != 9 || memcmp(da->firstAddr, "012345678", 9) != 0, "daAppendN should append all elements behind the existing ones");
+    sput_fail_if(da->max != 12, "daAppendN should double the capacity until the elements fit");
+
+    sput_fail_if(daAppendN(da, &err, "x", 0) != (char *)da->firstAddr + 9, "daAppendN should return the end of the array for 0 elements");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+    sput_fail_if(da->used != 9, "daAppendN shouldn't change the array for 0 elements");
+
+    daDestroy(da, &err);
+}
+
+static void testSelf(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createArray(1, 4, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    daAppendN(da, &err, "abcd", 4);
+
+    /* The source gets moved by the reallocation */
+    sput_fail_if(daAppendN(da, &err, (char *)da->firstAddr + 1, 3) == NULL, "daAppendN should append elements of the array itself");
+    sput_fail_if(da->used != 7 || memcmp(da->firstAddr, "abcdbcd", 7) != 0, "daAppendN should copy the elements before they move");
+
+    daDestroy(da, &err);
+}
+
+static void testBytesLimit(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createArray(1, 2, 10);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daAppendN(da, &err, "0123", 4) == NULL, "daAppendN should succeed if the bytes limit isn't reached");
+
+    sput_fail_if(daAppendN(da, &err, "4567890", 7) != NULL, "daAppendN should fail if the elements exceed the bytes limit");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT), "err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT)");
+    sput_fail_if(da->used != 4 || memcmp(da->firstAddr, "0123", 4) != 0, "daAppendN shouldn't append any element if it fails");
+
+    sput_fail_if(daAppendN(da, &err, "456789", 6) == NULL, "daAppendN should fill the array up to the bytes limit");
+    sput_fail_if(da->used != 10 || da->max != 10, "daAppendN should grow the array to the bytes limit");
+
+    daDestroy(da, &err);
+}
+
+static void testSidecars(void)
+{
+    int err;
+    size_t index;
+    DaStruct *da;
+
+    da = createArray(1, 4, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(da, &err, 4096) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daBloomAttach(da, &err, 10, 4096) != 0, "daBloomAttach should succeed");
+
+    daAppendN(da, &err, "abcdefgh", 8);
+
+    sput_fail_if(daIndexOf(da, &err, "g", &index) != 1 || index != 6, "daIndexOf should find an appended element");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int ignore = 0;
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daAppendN(&da, &err, &ignore, 1) != NULL, "daAppendN should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daAppendN should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daAppendN should append all elements with a single reallocation");
+    sput_run_test(testAppend);
+
+    sput_enter_suite("daAppendN should append elements of the array itself");
+    sput_run_test(testSelf);
+
+    sput_enter_suite("daAppendN should append all elements or none");
+    sput_run_test(testBytesLimit);
+
+    sput_enter_suite("daAppendN should update an attached index and filter");
+    sput_run_test(testSidecars);
+
+    sput_enter_suite("daAppendN should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,144 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+#define RECORD 32
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daAppendSlot(NULL, NULL, 1, DA_ZERO) != NULL, "daAppendSlot(NULL, NULL, 1, DA_ZERO) != NULL");
+    sput_fail_if(daAppendSlot(&da,  NULL, 1, DA_ZERO) != NULL, "daAppendSlot(da,   NULL, 1, DA_ZERO) != NULL");
+
+    sput_fail_if(daAppendSlot(NULL, &err, 1, DA_ZERO) != NULL, "daAppendSlot(NULL, &err, 1, DA_ZERO) != NULL");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testSlots(void)
+{
+    int err;
+    size_t i;
+    char *slot;
+    char zero[RECORD];
+    DaStruct *da;
+
+    da = createArray(RECORD, 2, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    slot = daAppendSlot(da, &err, 3, DA_DIRTY);
+    sput_fail_if(slot != da->firstAddr, "daAppendSlot should return the address of the first slot");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+    sput_fail_if(da->used != 3 || da->max != 4, "daAppendSlot should count the slots as elements");
+
+    for (i = 0; i < 3; i++)
+    {
+        memset(slot + (i * RECORD), 'a' + (int)i, RECORD);
+    }
+
+    /* Leave stale bytes behind the last element, zeroed slots must not show them */
+    memset((char *)da->firstAddr + (3 * RECORD), 'x', RECORD);
+
+    slot = daAppendSlot(da, &err, 5, DA_ZERO);
+    sput_fail_if(slot != (char *)da->firstAddr + (3 * RECORD), "daAppendSlot should return the address behind the existing elements");
+    sput_fail_if(da->used != 8, "daAppendSlot should count the slots as elements");
+
+    memset(zero, 0, RECORD);
+    for (i = 3; i < 8; i++)
+    {
+        sput_fail_if(memcmp((char *)da->firstAddr + (i * RECORD), zero, RECORD) != 0, "daAppendSlot should zero the slots");
+    }
+
+    sput_fail_if(*(char *)daGet(da, &err, 2) != 'c', "daAppendSlot should keep the existing elements");
+
+    sput_fail_if(daAppendSlot(da, &err, 0, DA_ZERO) != (char *)da->firstAddr + (8 * RECORD), "daAppendSlot should return the end of the array for 0 slots");
+    sput_fail_if(da->used != 8, "daAppendSlot shouldn't change the array for 0 slots");
+
+    daDestroy(da, &err);
+}
+
+static void testInvalid(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createArray(RECORD, 2, 4);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daAppendSlot(da, &err, 1, 0) != NULL, "daAppendSlot should fail for an unknown mode");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_UNKNOWN_MODE), "err != (DA_PARAM_ERR | DA_UNKNOWN_MODE)");
+
+    daAppendSlot(da, &err, 3, DA_ZERO);
+
+    sput_fail_if(daAppendSlot(da, &err, 2, DA_ZERO) != NULL, "daAppendSlot should fail if the slots exceed the bytes limit");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT), "err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT)");
+    sput_fail_if(da->used != 3, "daAppendSlot shouldn't change the array if it fails");
+
+    daDestroy(da, &err);
+}
+
+static void testSidecars(void)
+{
+    int err;
+    size_t index;
+    char record[RECORD];
+    char *slot;
+    DaStruct *da;
+
+    da = createArray(RECORD, 4, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024 * 1024) != 0, "daBloomAttach should succeed");
+
+    memset(record, 'a', RECORD);
+    daAppend(da, &err, record);
+
+    slot = daAppendSlot(da, &err, 2, DA_DIRTY);
+    memset(slot, 'b', RECORD);
+    memset(slot + RECORD, 'c', RECORD);
+
+    memset(record, 'c', RECORD);
+    sput_fail_if(daIndexOf(da, &err, record, &index) != 1 || index != 2, "daIndexOf should find an element written into a slot");
+
+    memset(record, 'a', RECORD);
+    sput_fail_if(daIndexOf(da, &err, record, &index) != 1 || index != 0, "daIndexOf should find the existing elements");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daAppendSlot(&da, &err, 1, DA_ZERO) != NULL, "daAppendSlot should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daAppendSlot should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daAppendSlot should append uninitialized or zeroed slots");
+    sput_run_test(testSlots);
+
+    sput_enter_suite("daAppendSlot should fail for an unknown mode or too many slots");
+    sput_run_test(testInvalid);
+
+    sput_enter_suite("daAppendSlot should let the index and the filter see the content written into the slots");
+    sput_run_test(testSidecars);
+
+    sput_enter_suite("daAppendSlot should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
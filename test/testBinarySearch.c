@@ -0,0 +1,128 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static int compareInt(const void *a, const void *b)
+{
+    int x;
+    int y;
+
+    memcpy(&x, a, sizeof(x));
+    memcpy(&y, b, sizeof(y));
+
+    return (x > y) - (x < y);
+}
+
+/* 0, 0, 2, 2, ..., 98, 98: every even number twice */
+static DaStruct *createSorted(void)
+{
+    int err;
+    int i;
+    int value;
+    DaStruct *da;
+
+    da = createArray(sizeof(int), 100, 100);
+
+    for (i = 0; da && i < 100; i++)
+    {
+        value = (i / 2) * 2;
+        daAppend(da, &err, &value);
+    }
+
+    return da;
+}
+
+static void testMagic(void)
+{
+    size_t ignore = 0;
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daBinarySearch(&da, &err, &ignore, compareInt, &ignore) != -1, "daBinarySearch should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testNull(void)
+{
+    int err;
+    int key;
+    DaStruct da;
+    size_t idx;
+
+    key = 0;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daBinarySearch(&da, &err, &key, compareInt, NULL) != -1, "daBinarySearch(&da, &err, &key, compareInt, NULL) != -1");
+    sput_fail_if(daBinarySearch(&da, &err, &key, NULL, &idx)       != -1, "daBinarySearch(&da, &err, &key, NULL, &idx)       != -1");
+    sput_fail_if(daBinarySearch(&da, &err, NULL, compareInt, &idx) != -1, "daBinarySearch(&da, &err, NULL, compareInt, &idx) != -1");
+    sput_fail_if(daBinarySearch(&da, NULL, &key, compareInt, &idx) != -1, "daBinarySearch(&da, NULL, &key, compareInt, &idx) != -1");
+    sput_fail_if(daBinarySearch(NULL, &err, &key, compareInt, &idx) != -1, "daBinarySearch(NULL, &err, &key, compareInt, &idx) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testFound(void)
+{
+    int err;
+    int key;
+    size_t index;
+    DaStruct *da;
+
+    da = createSorted();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (key = 0; key <= 98; key += 2)
+    {
+        sput_fail_if(daBinarySearch(da, &err, &key, compareInt, &index) != 1, "daBinarySearch should find an existing key");
+        sput_fail_if(err != DA_OK, "err != DA_OK");
+        sput_fail_if(index != (size_t)key, "daBinarySearch should return the first matching element");
+    }
+
+    daDestroy(da, &err);
+}
+
+static void testNotFound(void)
+{
+    int err;
+    int key;
+    size_t index;
+    DaStruct *da;
+
+    da = createSorted();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (key = -1; key <= 99; key += 2)
+    {
+        sput_fail_if(daBinarySearch(da, &err, &key, compareInt, &index) != 0, "daBinarySearch shouldn't find a missing key");
+        sput_fail_if(err != DA_NOT_FOUND, "err != DA_NOT_FOUND");
+        sput_fail_if(index != (size_t)(key + 1), "daBinarySearch should return the insertion point");
+    }
+
+    key = 1000;
+    sput_fail_if(daBinarySearch(da, &err, &key, compareInt, &index) != 0, "daBinarySearch shouldn't find a missing key");
+    sput_fail_if(index != 100, "The insertion point of the largest key should be the end of the array");
+
+    daDestroy(da, &err);
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daBinarySearch should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daBinarySearch should find the first element with an existing key");
+    sput_run_test(testFound);
+
+    sput_enter_suite("daBinarySearch should return the insertion point of a missing key");
+    sput_run_test(testNotFound);
+
+    sput_enter_suite("daBinarySearch should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,276 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+/* Compares every lookup of the filtered array with the one of the plain array */
+static int sameLookups(DaStruct *filtered, DaStruct *plain)
+{
+    int err;
+    size_t a;
+    size_t b;
+    unsigned int value;
+
+    if (filtered->used != plain->used || memcmp(filtered->firstAddr, plain->firstAddr, plain->used * sizeof(value)) != 0)
+    {
+        return 0;
+    }
+
+    for (value = 0; value < 200; value++)
+    {
+        a = b = 0;
+        if (daIndexOf(filtered, &err, &value, &a) != daIndexOf(plain, &err, &value, &b) || a != b)
+        {
+            return 0;
+        }
+
+        a = b = 0;
+        if (daLastIndexOf(filtered, &err, &value, &a) != daLastIndexOf(plain, &err, &value, &b) || a != b)
+        {
+            return 0;
+        }
+
+        if (daContains(filtered, &err, &value) != daContains(plain, &err, &value))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daBloomAttach(NULL, NULL, 10, 100) != -1, "daBloomAttach(NULL, NULL, 10, 100) != -1");
+    sput_fail_if(daBloomAttach(&da,  NULL, 10, 100) != -1, "daBloomAttach(&da,  NULL, 10, 100) != -1");
+    sput_fail_if(daBloomAttach(NULL, &err, 10, 100) != -1, "daBloomAttach(NULL, &err, 10, 100) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testZero(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createArray(sizeof(unsigned int), 4, 100000);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daBloomAttach(da, &err, 10, 0) != -1, "daBloomAttach should fail if the limit is 0");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+
+    sput_fail_if(daBloomAttach(da, &err, 0, 1024) != -1, "daBloomAttach should fail if the bits per element are 0");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+    sput_fail_if(da->bloom != NULL, "daBloomAttach shouldn't attach a filter on error");
+
+    daDestroy(da, &err);
+}
+
+static void testExceedsSizeLimit(void)
+{
+    int err;
+    size_t i;
+    unsigned int value;
+    DaStruct *da;
+
+    da = createArray(sizeof(unsigned int), 4, 100000);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (value = 0; value < 1000; value++)
+    {
+        daAppend(da, &err, &value);
+    }
+
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024) != -1, "daBloomAttach should fail if the filter exceeds the limit");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT), "err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT)");
+    sput_fail_if(da->bloom != NULL, "daBloomAttach shouldn't attach a filter on error");
+
+    /* A filter that outgrows its limit gets suspended, the searches stay correct */
+    daClear(da, &err, DA_FAST);
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024) != 0, "daBloomAttach should succeed if the filter fits the limit");
+
+    for (value = 0; value < 1000; value++)
+    {
+        sput_fail_if(daAppend(da, &err, &value) == NULL, "daAppend should succeed even if the filter exceeds its limit");
+    }
+
+    for (i = 0; i < 1000; i++)
+    {
+        value = (unsigned int)i;
+        sput_fail_if(daIndexOf(da, &err, &value, &i) != 1 || i != value, "daIndexOf should fall back to scanning the array");
+    }
+
+    daDestroy(da, &err);
+}
+
+static void testConsistency(void)
+{
+    int err;
+    size_t i;
+    size_t pos;
+    unsigned int value;
+    DaStruct *filtered;
+    DaStruct *plain;
+
+    filtered = createArray(sizeof(unsigned int), 4, 100000);
+    plain = createArray(sizeof(unsigned int), 4, 100000);
+    sput_fail_if(filtered == NULL || plain == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daBloomAttach(filtered, &err, 10, 1024 * 1024) != 0, "daBloomAttach should attach a filter to an empty array");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+
+    srand(42);
+
+    for (i = 0; i < 3000; i++)
+    {
+        value = (unsigned int)(rand() % 150);
+        pos = plain->used ? (size_t)rand() % plain->used : 0;
+
+        switch (rand() % 8)
+        {
+        case 0:
+        case 1:
+            daAppend(filtered, &err, &value);
+            daAppend(plain, &err, &value);
+            break;
+
+        case 2:
+            daInsertAt(filtered, &err, &value, pos);
+            daInsertAt(plain, &err, &value, pos);
+            break;
+
+        case 3:
+            daPrepend(filtered, &err, &value);
+            daPrepend(plain, &err, &value);
+            break;
+
+        case 4:
+            daSet(filtered, &err, &value, pos);
+            daSet(plain, &err, &value, pos);
+            break;
+
+        case 5:
+            daRemove(filtered, &err, pos);
+            daRemove(plain, &err, pos);
+            break;
+
+        case 6:
+            daRemoveDirty(filtered, &err, pos);
+            daRemoveDirty(plain, &err, pos);
+            break;
+
+        case 7:
+            daRemoveRange(filtered, &err, pos, pos + (plain->used - pos) / 4);
+            daRemoveRange(plain, &err, pos, pos + (plain->used - pos) / 4);
+            break;
+        }
+
+        if (i % 100 == 0)
+        {
+            sput_fail_if(!sameLookups(filtered, plain), "The filtered array should return the same results as the plain one");
+        }
+    }
+
+    sput_fail_if(!sameLookups(filtered, plain), "The filtered array should return the same results as the plain one");
+
+    daClear(filtered, &err, DA_FAST);
+    daClear(plain, &err, DA_FAST);
+    sput_fail_if(!sameLookups(filtered, plain), "The filter should be empty after daClear");
+
+    daDestroy(filtered, &err);
+    daDestroy(plain, &err);
+}
+
+static void testWithIndex(void)
+{
+    int err;
+    size_t index;
+    unsigned int value;
+    DaStruct *da;
+
+    da = createArray(sizeof(unsigned int), 4, 100000);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (value = 0; value < 100; value++)
+    {
+        daAppend(da, &err, &value);
+    }
+
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024 * 1024) != 0, "daBloomAttach should succeed next to an index");
+
+    value = 42;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 42, "daIndexOf should find an element through filter and index");
+    value = 4242;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 0, "daIndexOf shouldn't find a missing element");
+
+    daDestroy(da, &err);
+}
+
+static void testRebuild(void)
+{
+    int err;
+    size_t index;
+    unsigned int value;
+    DaStruct *da;
+
+    da = createArray(sizeof(unsigned int), 4, 100000);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (value = 0; value < 10; value++)
+    {
+        daAppend(da, &err, &value);
+    }
+
+    /* Bypass the filter and rebuild it */
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024) != 0, "daBloomAttach should succeed");
+    value = 42;
+    memcpy(daGet(da, &err, 5), &value, sizeof(value));
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024) != 0, "daBloomAttach should rebuild an attached filter");
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 5, "daIndexOf should find an element after the rebuild");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daBloomAttach(&da, &err, 10, 100) != -1, "daBloomAttach should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daBloomAttach should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daBloomAttach should fail if the limit or the bits per element are 0");
+    sput_run_test(testZero);
+
+    sput_enter_suite("daBloomAttach should respect the byte limit of the filter");
+    sput_run_test(testExceedsSizeLimit);
+
+    sput_enter_suite("The filter should never reject an element of the array");
+    sput_run_test(testConsistency);
+
+    sput_enter_suite("The filter should work together with the hash index");
+    sput_run_test(testWithIndex);
+
+    sput_enter_suite("daBloomAttach should rebuild an attached filter");
+    sput_run_test(testRebuild);
+
+    sput_enter_suite("daBloomAttach should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
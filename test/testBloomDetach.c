@@ -0,0 +1,75 @@
+#include "sput.h"
+#include "dynar.h"
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daBloomDetach(NULL, NULL) != -1, "daBloomDetach(NULL, NULL) != -1");
+    sput_fail_if(daBloomDetach(&da,  NULL) != -1, "daBloomDetach(&da,  NULL) != -1");
+    sput_fail_if(daBloomDetach(NULL, &err) != -1, "daBloomDetach(NULL, &err) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testDetach(void)
+{
+    int err;
+    size_t index;
+    const char *src;
+    DaDesc desc;
+    DaStruct *da;
+
+    desc.elements = 3;
+    desc.bytesPerElement = 1;
+    desc.maxBytes = 10;
+    da = daCreate(&desc, &err);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daBloomDetach(da, &err) != 0, "daBloomDetach should succeed if no filter is attached");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+
+    src = "123";
+    daAppend(da, &err, src);
+    daAppend(da, &err, src + 1);
+    daAppend(da, &err, src + 2);
+
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024) != 0, "daBloomAttach should succeed");
+    sput_fail_if(daBloomDetach(da, &err) != 0, "daBloomDetach should remove the filter");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+    sput_fail_if(da->bloom != NULL, "daBloomDetach should reset the filter pointer");
+
+    sput_fail_if(daIndexOf(da, &err, src + 2, &index) != 1 || index != 2, "daIndexOf should scan the array without filter");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daBloomDetach(&da, &err) != -1, "daBloomDetach should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daBloomDetach should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daBloomDetach should remove the filter");
+    sput_run_test(testDetach);
+
+    sput_enter_suite("daBloomDetach should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
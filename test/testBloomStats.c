@@ -0,0 +1,105 @@
+#include "sput.h"
+#include "dynar.h"
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    DaBloomStats stats;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daBloomStats(NULL, NULL, NULL)   != -1, "daBloomStats(NULL, NULL, NULL)   != -1");
+    sput_fail_if(daBloomStats(&da,  &err, NULL)   != -1, "daBloomStats(&da,  &err, NULL)   != -1");
+    sput_fail_if(daBloomStats(&da,  NULL, &stats) != -1, "daBloomStats(&da,  NULL, &stats) != -1");
+    sput_fail_if(daBloomStats(NULL, &err, &stats) != -1, "daBloomStats(NULL, &err, &stats) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testStats(void)
+{
+    int err;
+    unsigned int value;
+    DaDesc desc;
+    DaStruct *da;
+    DaBloomStats stats;
+
+    desc.elements = 10000;
+    desc.bytesPerElement = sizeof(unsigned int);
+    desc.maxBytes = 10000 * sizeof(unsigned int);
+    da = daCreate(&desc, &err);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daBloomStats(da, &err, &stats) != 0, "daBloomStats should return 0 without a filter");
+    sput_fail_if(err != DA_NOT_FOUND, "err != DA_NOT_FOUND");
+    sput_fail_if(stats.bytes != 0 || stats.lookups != 0, "The statistics should be zero without a filter");
+
+    for (value = 0; value < 10000; value += 2)
+    {
+        daAppend(da, &err, &value);
+    }
+
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024 * 1024) != 0, "daBloomAttach should succeed");
+    sput_fail_if(daBloomTrack(da, &err, 1) != 1, "daBloomTrack should enable the lookup counters");
+
+    /* Every odd value is missing */
+    for (value = 0; value < 10000; value++)
+    {
+        daContains(da, &err, &value);
+    }
+
+    sput_fail_if(daBloomStats(da, &err, &stats) != 1, "daBloomStats should return 1 with a filter");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+    sput_fail_if(stats.bytes == 0, "The filter should occupy memory");
+    sput_fail_if(stats.elements != 5000 || stats.stale != 0, "The filter should contain all elements");
+    sput_fail_if(stats.lookups != 10000, "Every lookup should consult the filter");
+    sput_fail_if(stats.rejected + stats.falsePositives != 5000, "Every missing element should be rejected or a false positive");
+    sput_fail_if(stats.falsePositives > 250, "The false positive rate should be low");
+    sput_fail_if(stats.expectedRate <= 0.0 || stats.expectedRate > 0.05, "The expected false positive rate should be low");
+
+    /* Half of the elements get stale, lookups leave the filter alone and the next change rebuilds it */
+    daRemoveRange(da, &err, 0, 2499);
+    daBloomStats(da, &err, &stats);
+    sput_fail_if(stats.stale != 2500, "Removed elements should be stale");
+
+    value = 1;
+    daContains(da, &err, &value);
+    daBloomStats(da, &err, &stats);
+    sput_fail_if(stats.rebuilds != 0 || stats.stale != 2500, "A lookup shouldn't rebuild the filter");
+
+    daSet(da, &err, &value, 0);
+    daBloomStats(da, &err, &stats);
+    sput_fail_if(stats.rebuilds != 1 || stats.stale != 1 || stats.elements != 2501, "The next change should rebuild the filter");
+    sput_fail_if(daContains(da, &err, &value) != 1, "The rebuilt filter should contain the new element");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+    DaBloomStats stats;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daBloomStats(&da, &err, &stats) != -1, "daBloomStats should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daBloomStats should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daBloomStats should count the lookups, rejections and false positives");
+    sput_run_test(testStats);
+
+    sput_enter_suite("daBloomStats should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
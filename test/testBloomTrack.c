@@ -0,0 +1,91 @@
+#include "sput.h"
+#include "dynar.h"
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daBloomTrack(NULL, NULL, 1) != -1, "daBloomTrack(NULL, NULL, 1) != -1");
+    sput_fail_if(daBloomTrack(&da,  NULL, 1) != -1, "daBloomTrack(&da,  NULL, 1) != -1");
+    sput_fail_if(daBloomTrack(NULL, &err, 1) != -1, "daBloomTrack(NULL, &err, 1) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testTrack(void)
+{
+    int err;
+    unsigned int value;
+    DaDesc desc;
+    DaStruct *da;
+    DaBloomStats stats;
+
+    desc.elements = 100;
+    desc.bytesPerElement = sizeof(unsigned int);
+    desc.maxBytes = 100 * sizeof(unsigned int);
+    da = daCreate(&desc, &err);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daBloomTrack(da, &err, 1) != 0, "daBloomTrack should return 0 without a filter");
+    sput_fail_if(err != DA_NOT_FOUND, "err != DA_NOT_FOUND");
+
+    for (value = 0; value < 100; value++)
+    {
+        daAppend(da, &err, &value);
+    }
+
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024 * 1024) != 0, "daBloomAttach should succeed");
+
+    /* The counters are disabled after attaching the filter */
+    value = 1000;
+    daContains(da, &err, &value);
+    daBloomStats(da, &err, &stats);
+    sput_fail_if(stats.lookups != 0, "Lookups shouldn't be counted by default");
+
+    sput_fail_if(daBloomTrack(da, &err, 1) != 1, "daBloomTrack should return 1 with a filter");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+
+    daContains(da, &err, &value);
+    value = 5;
+    daContains(da, &err, &value);
+    daBloomStats(da, &err, &stats);
+    sput_fail_if(stats.lookups != 2, "Lookups should be counted once enabled");
+    sput_fail_if(stats.rejected + stats.falsePositives != 1, "The missing element should be rejected or a false positive");
+
+    sput_fail_if(daBloomTrack(da, &err, 0) != 1, "daBloomTrack should disable the counters");
+    daContains(da, &err, &value);
+    daBloomStats(da, &err, &stats);
+    sput_fail_if(stats.lookups != 2, "Lookups shouldn't be counted once disabled");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daBloomTrack(&da, &err, 1) != -1, "daBloomTrack should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daBloomTrack should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daBloomTrack should enable and disable the lookup counters");
+    sput_run_test(testTrack);
+
+    sput_enter_suite("daBloomTrack should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,154 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static int checkValues(DaStruct *da, size_t n)
+{
+    int err;
+    size_t i;
+
+    if (daSize(da, &err) != n)
+    {
+        return 1;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        if (*(int *)daGet(da, &err, i) != (int)i)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daConcat(&da,  &err, NULL) != -1, "daConcat(&da,  &err, NULL) != -1");
+    sput_fail_if(daConcat(&da,  NULL, &da)  != -1, "daConcat(&da,  NULL, &da)  != -1");
+    sput_fail_if(daConcat(NULL, &err, &da)  != -1, "daConcat(NULL, &err, &da)  != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testConcat(void)
+{
+    int err;
+    int value;
+    size_t index;
+    DaStruct *dst;
+    DaStruct *src;
+
+    dst = createInts(0, 100, 101, 1000);
+    src = createInts(100, 200, 201, 1000);
+    sput_fail_if(dst == NULL || src == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(dst, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+
+    sput_fail_if(daConcat(dst, &err, src) != 0 || err != DA_OK, "daConcat should succeed");
+    sput_fail_if(checkValues(dst, 300), "daConcat should append the elements");
+    sput_fail_if(daSize(src, &err) != 0, "daConcat should empty the source");
+
+    value = 250;
+    sput_fail_if(daIndexOf(dst, &err, &value, &index) != 1 || index != 250, "daIndexOf should find an appended element");
+
+    sput_fail_if(daAppend(src, &err, &value) == NULL, "The source should remain usable");
+
+    daDestroy(dst, &err);
+    daDestroy(src, &err);
+}
+
+static void testSteal(void)
+{
+    int err;
+    void *buffer;
+    DaStruct *dst;
+    DaStruct *src;
+
+    dst = createInts(0, 0, 1, 1000);
+    src = createInts(0, 500, 501, 1000);
+    sput_fail_if(dst == NULL || src == NULL, "Unable to create dynamic array.");
+
+    buffer = src->firstAddr;
+    sput_fail_if(daConcat(dst, &err, src) != 0 || err != DA_OK, "daConcat should succeed");
+    sput_fail_if(dst->firstAddr != buffer, "daConcat should take over the buffer of the source");
+    sput_fail_if(checkValues(dst, 500), "daConcat should keep the elements");
+    sput_fail_if(daSize(src, &err) != 0, "daConcat should empty the source");
+
+    daDestroy(dst, &err);
+    daDestroy(src, &err);
+
+    /* The buffer of the source exceeds the limit of the destination */
+    dst = createInts(0, 0, 1, 600);
+    src = createInts(0, 700, 701, 1000);
+    sput_fail_if(dst == NULL || src == NULL, "Unable to create dynamic array.");
+    daRemoveRange(src, &err, 500, 699);
+
+    buffer = src->firstAddr;
+    sput_fail_if(daConcat(dst, &err, src) != 0 || err != DA_OK, "daConcat should succeed");
+    sput_fail_if(dst->firstAddr == buffer, "daConcat should copy the elements");
+    sput_fail_if(checkValues(dst, 500), "daConcat should keep the elements");
+    sput_fail_if(dst->max * dst->bytesPerElement > dst->maxBytes, "daConcat should respect the bytes limit");
+
+    daDestroy(dst, &err);
+    daDestroy(src, &err);
+}
+
+static void testLimit(void)
+{
+    int err;
+    DaStruct *dst;
+    DaStruct *src;
+
+    dst = createInts(0, 10, 11, 20);
+    src = createInts(10, 11, 12, 20);
+    sput_fail_if(dst == NULL || src == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daConcat(dst, &err, src) != -1, "daConcat should fail if the limit would be exceeded");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT), "err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT)");
+    sput_fail_if(daSize(dst, &err) != 10 || daSize(src, &err) != 11, "daConcat shouldn't change the arrays in the event of an error");
+
+    sput_fail_if(daConcat(dst, &err, dst) != -1, "daConcat should fail if the arrays are the same");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_INCOMPATIBLE), "err != (DA_PARAM_ERR | DA_INCOMPATIBLE)");
+
+    daDestroy(dst, &err);
+    daDestroy(src, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daConcat(&da, &err, &da) != -1, "daConcat should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daConcat should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daConcat should move the elements");
+    sput_run_test(testConcat);
+
+    sput_enter_suite("daConcat should take over the buffer if the destination is empty");
+    sput_run_test(testSteal);
+
+    sput_enter_suite("daConcat should respect the bytes limit");
+    sput_run_test(testLimit);
+
+    sput_enter_suite("daConcat should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
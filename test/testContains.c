@@ -32,6 +32,7 @@ static void testFound(void)
 
     desc.elements = 3;
     desc.bytesPerElement = 1;
+    desc.maxBytes = 3;
     da = daCreate(&desc, &err);
     sput_fail_if(da == NULL, "Unable to create dynamic array.");
 
@@ -65,6 +66,7 @@ static void testNotFound(void)
 
     desc.elements = 3;
     desc.bytesPerElement = 1;
+    desc.maxBytes = 3;
     da = daCreate(&desc, &err);
     sput_fail_if(da == NULL, "Unable to create dynamic array.");
 
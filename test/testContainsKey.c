@@ -0,0 +1,134 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+#define RECORD 16
+
+/* Records of 16 bytes: a flags byte, an 8 byte id at offset 4 and filler bytes */
+static DaStruct *createRecords(void)
+{
+    int err;
+    int i;
+    char record[RECORD];
+    DaStruct *da;
+
+    da = createArray(RECORD, 100, 100);
+
+    for (i = 0; da && i < 100; i++)
+    {
+        memset(record, 'x', RECORD);
+        record[0] = (char)(i % 2);
+        sprintf(record + 4, "id%06d", i % 50);
+        record[12] = (char)i;
+        daAppend(da, &err, record);
+    }
+
+    return da;
+}
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daContainsKey(&da, &err, NULL, 0, 1, NULL) != -1, "daContainsKey(&da, &err, NULL, 0, 1, NULL) != -1");
+    sput_fail_if(daContainsKey(&da, NULL, &da, 0, 1, NULL)  != -1, "daContainsKey(&da, NULL, &da, 0, 1, NULL)  != -1");
+    sput_fail_if(daContainsKey(NULL, &err, &da, 0, 1, NULL) != -1, "daContainsKey(NULL, &err, &da, 0, 1, NULL) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testOutOfBounds(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createRecords();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daContainsKey(da, &err, "id", 4, 0, NULL) != -1, "daContainsKey should fail if the key is empty");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daContainsKey(da, &err, "idxxxx", 12, 5, NULL) != -1, "daContainsKey should fail if the key exceeds the element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testFound(void)
+{
+    int err;
+    unsigned char mask[8];
+    DaStruct *da;
+
+    da = createRecords();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daContainsKey(da, &err, "id000049", 4, 8, NULL) != 1, "daContainsKey should find an existing key");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+
+    sput_fail_if(daContainsKey(da, &err, "49", 10, 2, NULL) != 1, "daContainsKey should find a 2 byte key");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+
+    memset(mask, 0xff, sizeof(mask));
+    mask[6] = 0;
+    sput_fail_if(daContainsKey(da, &err, "id000099", 4, 8, mask) != 1, "daContainsKey should apply the mask");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+
+    daDestroy(da, &err);
+}
+
+static void testNotFound(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createRecords();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daContainsKey(da, &err, "id000050", 4, 8, NULL) != 0, "daContainsKey shouldn't find a key that doesn't exist");
+    sput_fail_if(err != DA_NOT_FOUND, "err != DA_NOT_FOUND");
+
+    da->used = 0;
+    sput_fail_if(daContainsKey(da, &err, "id000001", 4, 8, NULL) != 0, "daContainsKey shouldn't find a key if the array is empty");
+    sput_fail_if(err != DA_NOT_FOUND, "err != DA_NOT_FOUND");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    int ignore = 0;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daContainsKey(&da, &err, &ignore, 0, 1, NULL) != -1, "daContainsKey should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daContainsKey should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daContainsKey should fail if the key exceeds the element");
+    sput_run_test(testOutOfBounds);
+
+    sput_enter_suite("daContainsKey should find an existing key");
+    sput_run_test(testFound);
+
+    sput_enter_suite("daContainsKey shouldn't find a key that doesn't exist");
+    sput_run_test(testNotFound);
+
+    sput_enter_suite("daContainsKey should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
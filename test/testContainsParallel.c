@@ -0,0 +1,122 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+#define ELEMENTS (1024 * 1024)
+
+static DaStruct *createLarge(void)
+{
+    int err;
+    size_t i;
+    unsigned int value;
+    DaStruct *da;
+
+    da = createArray(sizeof(value), ELEMENTS, ELEMENTS);
+
+    for (i = 0; da && i < ELEMENTS; i++)
+    {
+        value = (unsigned int)i;
+        daAppend(da, &err, &value);
+    }
+
+    return da;
+}
+
+static void testNull(void)
+{
+    int err;
+    int ignore = 0;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daContainsParallel(NULL, NULL, &ignore, 4) != -1, "daContainsParallel(NULL, NULL, &ignore, 4) != -1");
+    sput_fail_if(daContainsParallel(&da,  NULL, &ignore, 4) != -1, "daContainsParallel(da,   NULL, &ignore, 4) != -1");
+
+    sput_fail_if(daContainsParallel(&da,  &err, NULL, 4)    != -1, "daContainsParallel(da,   &err, NULL, 4)    != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+
+    sput_fail_if(daContainsParallel(NULL, &err, &ignore, 4) != -1, "daContainsParallel(NULL, &err, &ignore, 4) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testFound(void)
+{
+    int err;
+    size_t threads;
+    unsigned int value;
+    DaStruct *da;
+
+    da = createLarge();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (threads = 1; threads <= 8; threads *= 2)
+    {
+        value = 0;
+        sput_fail_if(daContainsParallel(da, &err, &value, threads) != 1, "daContainsParallel should find the first element");
+        sput_fail_if(err != DA_OK, "err != DA_OK");
+
+        value = ELEMENTS / 2;
+        sput_fail_if(daContainsParallel(da, &err, &value, threads) != 1, "daContainsParallel should find an element in the middle");
+        sput_fail_if(err != DA_OK, "err != DA_OK");
+
+        value = ELEMENTS - 1;
+        sput_fail_if(daContainsParallel(da, &err, &value, threads) != 1, "daContainsParallel should find the last element");
+        sput_fail_if(err != DA_OK, "err != DA_OK");
+    }
+
+    daDestroy(da, &err);
+}
+
+static void testNotFound(void)
+{
+    int err;
+    unsigned int value;
+    DaStruct *da;
+
+    da = createLarge();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    value = ELEMENTS;
+    sput_fail_if(daContainsParallel(da, &err, &value, 4) != 0, "daContainsParallel shouldn't find an element that doesn't exist");
+    sput_fail_if(err != DA_NOT_FOUND, "err != DA_NOT_FOUND");
+
+    da->used = 0;
+    value = 0;
+    sput_fail_if(daContainsParallel(da, &err, &value, 4) != 0, "daContainsParallel shouldn't find an element if the array is empty");
+    sput_fail_if(err != DA_NOT_FOUND, "err != DA_NOT_FOUND");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    int ignore = 0;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daContainsParallel(&da, &err, &ignore, 4) != -1, "daContainsParallel should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daContainsParallel should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daContainsParallel should find an existing element");
+    sput_run_test(testFound);
+
+    sput_enter_suite("daContainsParallel shouldn't find an element that doesn't exist");
+    sput_run_test(testNotFound);
+
+    sput_enter_suite("daContainsParallel should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,184 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static int checkValues(DaStruct *da, const int *expected, size_t n)
+{
+    int err;
+    size_t i;
+
+    if (daSize(da, &err) != n)
+    {
+        return 1;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        if (*(int *)daGet(da, &err, i) != expected[i])
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daCopyRange(&da,  &err, 0, NULL, 0, 0) != NULL, "daCopyRange(&da,  &err, 0, NULL, 0, 0) != NULL");
+    sput_fail_if(daCopyRange(&da,  NULL, 0, &da,  0, 0) != NULL, "daCopyRange(&da,  NULL, 0, &da,  0, 0) != NULL");
+    sput_fail_if(daCopyRange(NULL, &err, 0, &da,  0, 0) != NULL, "daCopyRange(NULL, &err, 0, &da,  0, 0) != NULL");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testCopy(void)
+{
+    static const int overwrite[] = { 0, 12, 13, 14, 4, 5 };
+    static const int grow[] = { 0, 12, 13, 14, 4, 15, 16, 17, 18 };
+    int err;
+    int value;
+    size_t index;
+    DaStruct *dst;
+    DaStruct *src;
+
+    dst = createInts(0, 6, 6, 100);
+    src = createInts(10, 10, 10, 100);
+    sput_fail_if(dst == NULL || src == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(dst, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+
+    sput_fail_if(daCopyRange(dst, &err, 1, src, 2, 4) != daGet(dst, &err, 1), "daCopyRange should return the first copy");
+    sput_fail_if(checkValues(dst, overwrite, 6), "daCopyRange should overwrite the elements");
+
+    sput_fail_if(daCopyRange(dst, &err, 5, src, 5, 8) == NULL, "daCopyRange should succeed");
+    sput_fail_if(checkValues(dst, grow, 9), "daCopyRange should grow the array");
+
+    value = 17;
+    sput_fail_if(daIndexOf(dst, &err, &value, &index) != 1 || index != 7, "daIndexOf should find an appended copy");
+
+    value = 13;
+    sput_fail_if(daIndexOf(dst, &err, &value, &index) != 1 || index != 2, "daIndexOf should find an overwriting copy");
+
+    value = 5;
+    sput_fail_if(daIndexOf(dst, &err, &value, &index) != 0, "daIndexOf shouldn't find an overwritten element");
+
+    sput_fail_if(daCopyRange(dst, &err, 10, src, 0, 0) != NULL, "daCopyRange should fail if dstPos exceeds the array");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daCopyRange(dst, &err, 0, src, 5, 10) != NULL, "daCopyRange should fail if the range exceeds the source");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(dst, &err);
+    daDestroy(src, &err);
+}
+
+static void testSelf(void)
+{
+    static const int expected[] = { 0, 1, 2, 3, 0, 1, 2, 3, 4, 5 };
+    int err;
+    DaStruct *da;
+
+    /* The array has to grow while copying its own elements */
+    da = createInts(0, 6, 6, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daCopyRange(da, &err, 4, da, 0, 5) == NULL, "daCopyRange should succeed");
+    sput_fail_if(checkValues(da, expected, 10), "daCopyRange should accept overlapping ranges of the same array");
+
+    daDestroy(da, &err);
+}
+
+static void testLimit(void)
+{
+    int err;
+    DaStruct *dst;
+    DaStruct *src;
+
+    dst = createInts(0, 10, 10, 12);
+    src = createInts(0, 10, 10, 12);
+    sput_fail_if(dst == NULL || src == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daCopyRange(dst, &err, 5, src, 0, 7) != NULL, "daCopyRange should fail if the limit would be exceeded");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT), "err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT)");
+    sput_fail_if(daSize(dst, &err) != 10 || *(int *)daGet(dst, &err, 5) != 5, "daCopyRange shouldn't change the array in the event of an error");
+
+    sput_fail_if(daCopyRange(dst, &err, 5, src, 0, 6) == NULL || daSize(dst, &err) != 12, "daCopyRange should grow up to the limit");
+
+    daDestroy(dst, &err);
+    daDestroy(src, &err);
+}
+
+static void testStaleFilter(void)
+{
+    static const int values[] = { 10, 11, 12 };
+    int err;
+    int value;
+    int failed;
+    size_t i;
+    DaStruct *dst;
+    DaStruct *src;
+
+    dst = createInts(0, 4, 4, 10);
+    src = createFrom(values, 3, sizeof(int), 3, 3);
+    sput_fail_if(dst == NULL || src == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daBloomAttach(dst, &err, 10, 1024 * 1024) != 0, "daBloomAttach should succeed");
+
+    /* The stale elements make the filter rebuild in the middle of the copy */
+    value = 7;
+    daSet(dst, &err, &value, 3);
+    value = 8;
+    daSet(dst, &err, &value, 3);
+
+    sput_fail_if(daCopyRange(dst, &err, 0, src, 0, 2) == NULL, "daCopyRange should succeed");
+
+    for (i = 0, failed = 0; i < 3; i++)
+    {
+        failed |= daContains(dst, &err, &values[i]) != 1;
+    }
+
+    sput_fail_if(failed, "daContains should find every copied element");
+
+    daDestroy(dst, &err);
+    daDestroy(src, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daCopyRange(&da, &err, 0, &da, 0, 0) != NULL, "daCopyRange should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daCopyRange should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daCopyRange should copy a range of elements");
+    sput_run_test(testCopy);
+
+    sput_enter_suite("daCopyRange should copy within an array");
+    sput_run_test(testSelf);
+
+    sput_enter_suite("daCopyRange should respect the bytes limit");
+    sput_run_test(testLimit);
+
+    sput_enter_suite("daCopyRange should keep the filter correct if it gets rebuilt on the way");
+    sput_run_test(testStaleFilter);
+
+    sput_enter_suite("daCopyRange should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,125 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+/* Fills an array of elements of @p bytes bytes with the values 0 to 6 and returns it */
+static DaStruct *createPattern(size_t bytes, size_t elements)
+{
+    int err;
+    size_t i;
+    char element[16];
+    DaStruct *da;
+
+    da = createArray(bytes, elements, elements);
+
+    for (i = 0; da && i < elements; i++)
+    {
+        memset(element, 'x', sizeof(element));
+        element[bytes - 1] = (char)(i % 7);
+        daAppend(da, &err, element);
+    }
+
+    return da;
+}
+
+static void testNull(void)
+{
+    int err;
+    size_t count;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daCount(&da, &err, &da, NULL)    != -1, "daCount(&da, &err, &da, NULL)    != -1");
+    sput_fail_if(daCount(&da, &err, NULL, &count) != -1, "daCount(&da, &err, NULL, &count) != -1");
+    sput_fail_if(daCount(&da, NULL, &da, &count)  != -1, "daCount(&da, NULL, &da, &count)  != -1");
+    sput_fail_if(daCount(NULL, &err, &da, &count) != -1, "daCount(NULL, &err, &da, &count) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testCount(void)
+{
+    int err;
+    size_t sizes[] = { 1, 2, 3, 4, 8, 16 };
+    size_t s;
+    size_t count;
+    size_t elements;
+    char element[16];
+    DaStruct *da;
+
+    /* Element counts below, at and above the group size of the scan */
+    for (elements = 1; elements < 300; elements += 37)
+    {
+        for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+        {
+            da = createPattern(sizes[s], elements);
+            sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+            memset(element, 'x', sizeof(element));
+            element[sizes[s] - 1] = 3;
+            sput_fail_if(daCount(da, &err, element, &count) != 0, "daCount should succeed");
+            sput_fail_if(err != DA_OK, "err != DA_OK");
+            sput_fail_if(count != (elements + 3) / 7, "daCount should count every occurence");
+
+            element[sizes[s] - 1] = 7;
+            sput_fail_if(daCount(da, &err, element, &count) != 0 || count != 0, "daCount should return 0 for a missing element");
+
+            daDestroy(da, &err);
+        }
+    }
+}
+
+static void testSidecars(void)
+{
+    int err;
+    size_t count;
+    char element[4];
+    DaStruct *da;
+
+    da = createPattern(4, 1000);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024 * 1024) != 0, "daBloomAttach should succeed");
+
+    memset(element, 'x', sizeof(element));
+    element[3] = 5;
+    sput_fail_if(daCount(da, &err, element, &count) != 0 || count != 143, "daCount should count with the index");
+
+    element[3] = 9;
+    sput_fail_if(daCount(da, &err, element, &count) != 0 || count != 0, "daCount should return 0 for a missing element");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    size_t count;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daCount(&da, &err, &count, &count) != -1, "daCount should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daCount should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daCount should count all occurences for any element size");
+    sput_run_test(testCount);
+
+    sput_enter_suite("daCount should use an attached index and filter");
+    sput_run_test(testSidecars);
+
+    sput_enter_suite("daCount should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,93 @@
+#include "sput.h"
+#include "dynar.h"
+
+static void testNull(void)
+{
+    int err;
+    size_t used;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daDetach(&da,  &err, NULL,  NULL) != NULL, "daDetach(&da,  &err, NULL,  NULL) != NULL");
+    sput_fail_if(daDetach(&da,  NULL, &used, NULL) != NULL, "daDetach(&da,  NULL, &used, NULL) != NULL");
+    sput_fail_if(daDetach(NULL, &err, &used, NULL) != NULL, "daDetach(NULL, &err, &used, NULL) != NULL");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testDetach(void)
+{
+    int err;
+    int i;
+    int failed;
+    int *buffer;
+    void *first;
+    size_t used;
+    size_t capacity;
+    DaDesc desc;
+    DaStruct *da;
+
+    desc.elements = 16;
+    desc.bytesPerElement = sizeof(int);
+    desc.maxBytes = 1000 * sizeof(int);
+
+    da = daCreate(&desc, &err);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (i = 0; i < 10; i++)
+    {
+        daAppend(da, &err, &i);
+    }
+
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024 * 1024) != 0, "daBloomAttach should succeed");
+
+    first = da->firstAddr;
+    buffer = daDetach(da, &err, &used, &capacity);
+
+    sput_fail_if(buffer == NULL || err != DA_OK, "daDetach should succeed");
+    sput_fail_if((void *)buffer != first, "daDetach shouldn't copy the elements");
+    sput_fail_if(used != 10 || capacity != 16, "daDetach should return the size of the buffer");
+
+    for (i = 0, failed = 0; i < 10; i++)
+    {
+        failed |= buffer[i] != i;
+    }
+
+    sput_fail_if(failed, "daDetach should keep the elements");
+
+    da = daAdopt(&desc, &err, buffer, used, capacity);
+    sput_fail_if(da == NULL, "daAdopt should take the detached buffer back");
+    sput_fail_if(daDetach(da, &err, &used, NULL) != buffer || used != 10, "daDetach should accept a NULL capacity");
+
+    free(buffer);
+}
+
+static void testMagic(void)
+{
+    int err;
+    size_t used;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daDetach(&da, &err, &used, NULL) != NULL, "daDetach should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daDetach should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daDetach should hand the buffer over");
+    sput_run_test(testDetach);
+
+    sput_enter_suite("daDetach should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
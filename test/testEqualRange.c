@@ -0,0 +1,133 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static int compareInt(const void *a, const void *b)
+{
+    int x;
+    int y;
+
+    memcpy(&x, a, sizeof(x));
+    memcpy(&y, b, sizeof(y));
+
+    return (x > y) - (x < y);
+}
+
+/* 0, 0, 0, 3, 3, 3, ..., 96, 96, 96, 99: every multiple of 3 three times */
+static DaStruct *createSorted(void)
+{
+    int err;
+    int i;
+    int value;
+    DaStruct *da;
+
+    da = createArray(sizeof(int), 100, 100);
+
+    for (i = 0; da && i < 100; i++)
+    {
+        value = (i / 3) * 3;
+        daAppend(da, &err, &value);
+    }
+
+    return da;
+}
+
+static void testNull(void)
+{
+    int err;
+    int key;
+    DaStruct da;
+    size_t first;
+    size_t last;
+
+    key = 0;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daEqualRange(&da, &err, &key, compareInt, &first, NULL) != -1, "daEqualRange(&da, &err, &key, compareInt, &first, NULL) != -1");
+    sput_fail_if(daEqualRange(&da, &err, &key, compareInt, NULL, &last) != -1, "daEqualRange(&da, &err, &key, compareInt, NULL, &last) != -1");
+    sput_fail_if(daEqualRange(&da, &err, &key, NULL, &first, &last)     != -1, "daEqualRange(&da, &err, &key, NULL, &first, &last)     != -1");
+    sput_fail_if(daEqualRange(&da, &err, NULL, compareInt, &first, &last) != -1, "daEqualRange(&da, &err, NULL, compareInt, &first, &last) != -1");
+    sput_fail_if(daEqualRange(&da, NULL, &key, compareInt, &first, &last) != -1, "daEqualRange(&da, NULL, &key, compareInt, &first, &last) != -1");
+    sput_fail_if(daEqualRange(NULL, &err, &key, compareInt, &first, &last) != -1, "daEqualRange(NULL, &err, &key, compareInt, &first, &last) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testFound(void)
+{
+    int err;
+    int key;
+    size_t first;
+    size_t last;
+    DaStruct *da;
+
+    da = createSorted();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (key = 0; key <= 96; key += 3)
+    {
+        sput_fail_if(daEqualRange(da, &err, &key, compareInt, &first, &last) != 1, "daEqualRange should find an existing key");
+        sput_fail_if(err != DA_OK, "err != DA_OK");
+        sput_fail_if(first != (size_t)key || last != (size_t)key + 3, "daEqualRange returned the wrong range");
+    }
+
+    key = 99;
+    sput_fail_if(daEqualRange(da, &err, &key, compareInt, &first, &last) != 1, "daEqualRange should find the last element");
+    sput_fail_if(first != 99 || last != 100, "daEqualRange returned the wrong range for the last element");
+
+    daDestroy(da, &err);
+}
+
+static void testNotFound(void)
+{
+    int err;
+    int key;
+    size_t first;
+    size_t last;
+    DaStruct *da;
+
+    da = createSorted();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (key = -1; key <= 100; key += 3)
+    {
+        sput_fail_if(daEqualRange(da, &err, &key, compareInt, &first, &last) != 0, "daEqualRange shouldn't find a missing key");
+        sput_fail_if(err != DA_NOT_FOUND, "err != DA_NOT_FOUND");
+        sput_fail_if(first != last, "The range of a missing key should be empty");
+        sput_fail_if(first != (size_t)(key + 1), "The range of a missing key should start at its insertion point");
+    }
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    size_t ignore = 0;
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daEqualRange(&da, &err, &ignore, compareInt, &ignore, &ignore) != -1, "daEqualRange should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daEqualRange should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daEqualRange should return the range of all elements equal to an existing key");
+    sput_run_test(testFound);
+
+    sput_enter_suite("daEqualRange should return an empty range at the insertion point of a missing key");
+    sput_run_test(testNotFound);
+
+    sput_enter_suite("daEqualRange should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -8,6 +8,7 @@ static void testValid(void)
     sput_fail_if(strncmp(daErrToString(DA_PARAM_ERR | DA_UNKNOWN_MODE), "DA_PARAM_ERR | DA_UNKNOWN_MODE", strlen("DA_PARAM_ERR | DA_UNKNOWN_MODE")) != 0, "daErrToString should return appropriate error string (DA_PARAM_ERR | DA_UNKNOWN_MODE)");
     sput_fail_if(strncmp(daErrToString(DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "DA_PARAM_ERR | DA_OUT_OF_BOUNDS", strlen("DA_PARAM_ERR | DA_OUT_OF_BOUNDS")) != 0, "daErrToString should return appropriate error string (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
     sput_fail_if(strncmp(daErrToString(DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT), "DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT", strlen("DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT")) != 0, "daErrToString should return appropriate error string (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT");
+    sput_fail_if(strncmp(daErrToString(DA_PARAM_ERR | DA_INCOMPATIBLE), "DA_PARAM_ERR | DA_INCOMPATIBLE", strlen("DA_PARAM_ERR | DA_INCOMPATIBLE")) != 0, "daErrToString should return appropriate error string (DA_PARAM_ERR | DA_INCOMPATIBLE");
     sput_fail_if(strncmp(daErrToString(DA_FATAL | DA_ENOMEM), "DA_FATAL | DA_ENOMEM", strlen("DA_FATAL | DA_ENOMEM")) != 0, "daErrToString should return appropriate error string (DA_FATAL | DA_ENOMEM)");
     sput_fail_if(strncmp(daErrToString(DA_NOT_FOUND), "DA_NOT_FOUND", strlen("DA_NOT_FOUND")) != 0, "daErrToString should return appropriate error string (DA_NOT_FOUND)");
 }
@@ -0,0 +1,166 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+/* Creates an array of n elements whose bytes hold the position */
+static DaStruct *createPattern(size_t elements, size_t bytesPerElement)
+{
+    int err;
+    size_t i;
+    unsigned char element[16];
+    DaStruct *da;
+
+    da = createArray(bytesPerElement, elements, elements);
+
+    for (i = 0; da && i < elements; i++)
+    {
+        memset(element, (int)i, sizeof(element));
+        daAppend(da, &err, element);
+    }
+
+    return da;
+}
+
+static void testNull(void)
+{
+    int err;
+    int element;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daFill(&da,  &err, 0, 1, NULL)     != NULL, "daFill(&da,  &err, 0, 1, NULL)     != NULL");
+    sput_fail_if(daFill(&da,  NULL, 0, 1, &element) != NULL, "daFill(&da,  NULL, 0, 1, &element) != NULL");
+    sput_fail_if(daFill(NULL, &err, 0, 1, &element) != NULL, "daFill(NULL, &err, 0, 1, &element) != NULL");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testFill(void)
+{
+    static const size_t sizes[] = { 1, 3, sizeof(int), 16 };
+    int err;
+    int failed;
+    size_t s;
+    size_t i;
+    size_t from;
+    size_t to;
+    size_t expected;
+    unsigned char element[16];
+    unsigned char *cur;
+    DaStruct *da;
+
+    memset(element, 0xee, sizeof(element));
+
+    for (s = 0, failed = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        for (from = 0; from < 4; from++)
+        {
+            for (to = from; to < 40; to++)
+            {
+                da = createPattern(40, sizes[s]);
+                sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+                failed |= daFill(da, &err, from, to, element) != daGet(da, &err, from);
+
+                for (i = 0; i < 40; i++)
+                {
+                    expected = (i < from || i > to) ? i : 0xee;
+                    cur = daGet(da, &err, i);
+                    failed |= cur[0] != expected || cur[sizes[s] - 1] != expected;
+                }
+
+                daDestroy(da, &err);
+            }
+        }
+    }
+
+    sput_fail_if(failed, "daFill should fill the range with copies of the element");
+}
+
+static void testSelf(void)
+{
+    int err;
+    int failed;
+    size_t i;
+    DaStruct *da;
+
+    da = createPattern(20, sizeof(int));
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    daFill(da, &err, 0, 19, daGet(da, &err, 7));
+
+    for (i = 0, failed = 0; i < 20; i++)
+    {
+        failed |= ((unsigned char *)daGet(da, &err, i))[0] != 7;
+    }
+
+    sput_fail_if(failed, "daFill should accept an element of the range itself");
+
+    sput_fail_if(daFill(da, &err, 0, 20, daGet(da, &err, 0)) != NULL, "daFill should fail if to is out of bounds");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testSidecars(void)
+{
+    int err;
+    unsigned char element[sizeof(int)];
+    size_t index;
+    DaStruct *da;
+    DaBloomStats stats;
+
+    da = createPattern(100, sizeof(int));
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024 * 1024) != 0, "daBloomAttach should succeed");
+
+    memset(element, 0xee, sizeof(element));
+    daFill(da, &err, 10, 19, element);
+
+    sput_fail_if(daIndexOf(da, &err, element, &index) != 1 || index != 10, "daIndexOf should find the fill element");
+
+    memset(element, 15, sizeof(element));
+    sput_fail_if(daIndexOf(da, &err, element, &index) != 0, "daIndexOf shouldn't find a replaced element");
+
+    /* The filled elements get updated instead of rebuilding the sidecars */
+    daBloomStats(da, &err, &stats);
+    sput_fail_if(stats.rebuilds != 0 || stats.stale != 10, "daFill should update the filter for the filled elements");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    int element;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daFill(&da, &err, 0, 1, &element) != NULL, "daFill should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daFill should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daFill should fill a range of elements");
+    sput_run_test(testFill);
+
+    sput_enter_suite("daFill should accept an element of the array");
+    sput_run_test(testSelf);
+
+    sput_enter_suite("daFill should keep lookups through the index and the filter correct");
+    sput_run_test(testSidecars);
+
+    sput_enter_suite("daFill should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,152 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+/* Fills an array of elements of @p bytes bytes with the values 0 to 6 and returns it */
+static DaStruct *createPattern(size_t bytes, size_t elements)
+{
+    int err;
+    size_t i;
+    char element[16];
+    DaStruct *da;
+
+    da = createArray(bytes, elements, elements);
+
+    for (i = 0; da && i < elements; i++)
+    {
+        memset(element, 'x', sizeof(element));
+        element[bytes - 1] = (char)(i % 7);
+        daAppend(da, &err, element);
+    }
+
+    return da;
+}
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+    da.magic = DA_MAGIC;
+
+    sput_fail_if(daFindAll(&da, &err, &da, NULL) != -1, "daFindAll(&da, &err, &da, NULL) != -1");
+    sput_fail_if(daFindAll(&da, &err, NULL, &da) != -1, "daFindAll(&da, &err, NULL, &da) != -1");
+    sput_fail_if(daFindAll(&da, NULL, &da, &da)  != -1, "daFindAll(&da, NULL, &da, &da)  != -1");
+    sput_fail_if(daFindAll(NULL, &err, &da, &da) != -1, "daFindAll(NULL, &err, &da, &da) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testIncompatible(void)
+{
+    int err;
+    char element[4];
+    DaStruct *da;
+
+    da = createPattern(4, 10);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    memset(element, 'x', sizeof(element));
+    sput_fail_if(daFindAll(da, &err, element, da) != -1, "daFindAll should fail if the output array has the wrong element size");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_INCOMPATIBLE), "err != (DA_PARAM_ERR | DA_INCOMPATIBLE)");
+
+    daDestroy(da, &err);
+}
+
+static void testFindAll(void)
+{
+    int err;
+    size_t sizes[] = { 1, 2, 3, 4, 8, 16 };
+    size_t s;
+    size_t i;
+    size_t elements;
+    size_t *indexes;
+    char element[16];
+    DaStruct *da;
+    DaStruct *out;
+
+    out = createArray(sizeof(size_t), 1, 1000);
+    sput_fail_if(out == NULL, "Unable to create dynamic array.");
+
+    for (elements = 1; elements < 300; elements += 37)
+    {
+        for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+        {
+            da = createPattern(sizes[s], elements);
+            sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+            memset(element, 'x', sizeof(element));
+            element[sizes[s] - 1] = 4;
+            sput_fail_if(daFindAll(da, &err, element, out) != 0, "daFindAll should succeed");
+            sput_fail_if(err != DA_OK, "err != DA_OK");
+            sput_fail_if(daSize(out, &err) != (elements + 2) / 7, "daFindAll should find every occurence");
+
+            indexes = daGetFirst(out, &err);
+            for (i = 0; i < daSize(out, &err); i++)
+            {
+                sput_fail_if(indexes[i] != i * 7 + 4, "daFindAll should return the ascending indexes");
+            }
+
+            element[sizes[s] - 1] = 7;
+            sput_fail_if(daFindAll(da, &err, element, out) != 0 || daSize(out, &err) != 0, "daFindAll should return no index for a missing element");
+
+            daDestroy(da, &err);
+        }
+    }
+
+    daDestroy(out, &err);
+}
+
+static void testExceedsSizeLimit(void)
+{
+    int err;
+    char element[1];
+    DaStruct *da;
+    DaStruct *out;
+
+    da = createPattern(1, 700);
+    out = createArray(sizeof(size_t), 1, 50);
+    sput_fail_if(da == NULL || out == NULL, "Unable to create dynamic array.");
+
+    element[0] = 1;
+    sput_fail_if(daFindAll(da, &err, element, out) != -1, "daFindAll should fail if the indexes exceed the limit");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT), "err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT)");
+    sput_fail_if(daSize(out, &err) != 0, "The output array should be empty after an error");
+
+    daDestroy(da, &err);
+    daDestroy(out, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daFindAll(&da, &err, &da, &da) != -1, "daFindAll should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daFindAll should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daFindAll should fail if the output array doesn't hold size_t elements");
+    sput_run_test(testIncompatible);
+
+    sput_enter_suite("daFindAll should return the indexes of all occurences for any element size");
+    sput_run_test(testFindAll);
+
+    sput_enter_suite("daFindAll should respect the byte limit of the output array");
+    sput_run_test(testExceedsSizeLimit);
+
+    sput_enter_suite("daFindAll should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,107 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+/* Counts the elements and checks that they arrive in order, stops at the value in ctx[2] */
+static int visit(const void *elements, size_t n, size_t pos, void *ctx)
+{
+    const int *values = elements;
+    size_t *state = ctx;
+    size_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        state[1] |= (pos + i != state[0] + i) || (values[i] != (int)(pos + i));
+    }
+
+    state[0] += n;
+
+    return state[0] > state[2];
+}
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daForEach(&da,  &err, NULL,  NULL) != -1, "daForEach(&da,  &err, NULL,  NULL) != -1");
+    sput_fail_if(daForEach(&da,  NULL, visit, NULL) != -1, "daForEach(&da,  NULL, visit, NULL) != -1");
+    sput_fail_if(daForEach(NULL, &err, visit, NULL) != -1, "daForEach(NULL, &err, visit, NULL) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testForEach(void)
+{
+    static const size_t sizes[] = { 0, 1, 1000, 200000 };
+    int err;
+    size_t s;
+    size_t state[3];
+    DaStruct *da;
+
+    for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        da = createInts(0, sizes[s], sizes[s] + 1, sizes[s] + 1);
+        sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+        state[0] = 0;
+        state[1] = 0;
+        state[2] = (size_t)-1;
+
+        sput_fail_if(daForEach(da, &err, visit, state) != 0 || err != DA_OK, "daForEach should succeed");
+        sput_fail_if(state[0] != sizes[s] || state[1] != 0, "daForEach should visit all elements in order");
+
+        daDestroy(da, &err);
+    }
+}
+
+static void testStop(void)
+{
+    int err;
+    size_t state[3];
+    DaStruct *da;
+
+    da = createInts(0, 200000, 200001, 200001);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    state[0] = 0;
+    state[1] = 0;
+    state[2] = 0;
+
+    sput_fail_if(daForEach(da, &err, visit, state) != 1 || err != DA_OK, "daForEach should report the stop");
+    sput_fail_if(state[0] == 0 || state[0] >= 200000, "daForEach should stop after the first block");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daForEach(&da, &err, visit, NULL) != -1, "daForEach should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daForEach should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daForEach should visit all elements");
+    sput_run_test(testForEach);
+
+    sput_enter_suite("daForEach should stop if the visitor asks for it");
+    sput_run_test(testStop);
+
+    sput_enter_suite("daForEach should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,83 @@
+#ifndef __TEST_HELPER_H__
+#define __TEST_HELPER_H__
+
+#include "dynar.h"
+
+/*
+ * Set-up shared by the unit tests.
+ *
+ * Every test program is built from a single source file, so the functions are defined right here
+ * instead of in a separate translation unit.
+ */
+
+DaStruct *createArray(size_t bytesPerElement, size_t elements, size_t maxElements);
+DaStruct *createFrom(const void *values, size_t n, size_t bytesPerElement, size_t elements, size_t maxElements);
+DaStruct *createInts(int first, size_t n, size_t elements, size_t maxElements);
+DaStruct *createMultiples(int step, size_t n, size_t elements, size_t maxElements);
+
+/* Creates an empty array with room for elements and a limit of maxElements */
+DaStruct *createArray(size_t bytesPerElement, size_t elements, size_t maxElements)
+{
+    int err;
+    DaDesc desc;
+
+    desc.elements = elements;
+    desc.bytesPerElement = bytesPerElement;
+    desc.maxBytes = maxElements * bytesPerElement;
+
+    return daCreate(&desc, &err);
+}
+
+/* Creates an array like createArray() and appends the n elements found at values */
+DaStruct *createFrom(const void *values, size_t n, size_t bytesPerElement, size_t elements, size_t maxElements)
+{
+    int err;
+    DaStruct *da;
+
+    da = createArray(bytesPerElement, elements, maxElements);
+
+    if (da && n > 0)
+    {
+        daAppendN(da, &err, values, n);
+    }
+
+    return da;
+}
+
+/* Creates an int array like createArray() holding the n values first, first + 1, ... */
+DaStruct *createInts(int first, size_t n, size_t elements, size_t maxElements)
+{
+    int err;
+    int i;
+    DaStruct *da;
+
+    da = createArray(sizeof(int), elements, maxElements);
+
+    for (i = first; da && i < first + (int)n; i++)
+    {
+        daAppend(da, &err, &i);
+    }
+
+    return da;
+}
+
+/* Creates an int array like createArray() holding the n multiples 0, step, 2 * step, ... */
+DaStruct *createMultiples(int step, size_t n, size_t elements, size_t maxElements)
+{
+    int err;
+    int value;
+    size_t i;
+    DaStruct *da;
+
+    da = createArray(sizeof(int), elements, maxElements);
+
+    for (i = 0; da && i < n; i++)
+    {
+        value = (int)i * step;
+        daAppend(da, &err, &value);
+    }
+
+    return da;
+}
+
+#endif
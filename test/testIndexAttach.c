@@ -0,0 +1,323 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+/* Compares every lookup of the indexed array with a linear scan of the plain one */
+static int sameLookups(DaStruct *indexed, DaStruct *plain)
+{
+    int err;
+    size_t a;
+    size_t b;
+    unsigned int value;
+
+    if (indexed->used != plain->used || memcmp(indexed->firstAddr, plain->firstAddr, plain->used * sizeof(value)) != 0)
+    {
+        return 0;
+    }
+
+    for (value = 0; value < 70; value++)
+    {
+        a = b = 0;
+        if (daIndexOf(indexed, &err, &value, &a) != daIndexOf(plain, &err, &value, &b) || a != b)
+        {
+            return 0;
+        }
+
+        a = b = 0;
+        if (daLastIndexOf(indexed, &err, &value, &a) != daLastIndexOf(plain, &err, &value, &b) || a != b)
+        {
+            return 0;
+        }
+
+        if (daContains(indexed, &err, &value) != daContains(plain, &err, &value))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daIndexAttach(NULL, NULL, 100) != -1, "daIndexAttach(NULL, NULL, 100) != -1");
+    sput_fail_if(daIndexAttach(&da,  NULL, 100) != -1, "daIndexAttach(&da,  NULL, 100) != -1");
+    sput_fail_if(daIndexAttach(NULL, &err, 100) != -1, "daIndexAttach(NULL, &err, 100) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testZeroLimit(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createArray(sizeof(unsigned int), 4, 100000);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daIndexAttach(da, &err, 0) != -1, "daIndexAttach should fail if the limit is 0");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+    sput_fail_if(da->index != NULL, "daIndexAttach shouldn't attach an index on error");
+
+    daDestroy(da, &err);
+}
+
+static void testExceedsSizeLimit(void)
+{
+    int err;
+    size_t i;
+    unsigned int value;
+    DaStruct *da;
+
+    da = createArray(sizeof(unsigned int), 4, 100000);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (value = 0; value < 100; value++)
+    {
+        daAppend(da, &err, &value);
+    }
+
+    sput_fail_if(daIndexAttach(da, &err, 64) != -1, "daIndexAttach should fail if the index exceeds the limit");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT), "err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT)");
+    sput_fail_if(da->index != NULL, "daIndexAttach shouldn't attach an index on error");
+
+    /* An index that outgrows its limit gets suspended, the searches stay correct */
+    daClear(da, &err, DA_FAST);
+    sput_fail_if(daIndexAttach(da, &err, 1024) != 0, "daIndexAttach should succeed if the index fits the limit");
+
+    for (value = 0; value < 100; value++)
+    {
+        sput_fail_if(daAppend(da, &err, &value) == NULL, "daAppend should succeed even if the index exceeds its limit");
+    }
+
+    for (i = 0; i < 100; i++)
+    {
+        value = (unsigned int)i;
+        sput_fail_if(daIndexOf(da, &err, &value, &i) != 1 || i != value, "daIndexOf should fall back to scanning the array");
+    }
+
+    daDestroy(da, &err);
+}
+
+static void testConsistency(void)
+{
+    int err;
+    size_t i;
+    size_t pos;
+    unsigned int value;
+    DaStruct *indexed;
+    DaStruct *plain;
+
+    indexed = createArray(sizeof(unsigned int), 4, 100000);
+    plain = createArray(sizeof(unsigned int), 4, 100000);
+    sput_fail_if(indexed == NULL || plain == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daIndexAttach(indexed, &err, 1024 * 1024) != 0, "daIndexAttach should attach an index to an empty array");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+
+    srand(42);
+
+    for (i = 0; i < 3000; i++)
+    {
+        value = (unsigned int)(rand() % 64);
+        pos = plain->used ? (size_t)rand() % plain->used : 0;
+
+        switch (rand() % 8)
+        {
+        case 0:
+        case 1:
+            daAppend(indexed, &err, &value);
+            daAppend(plain, &err, &value);
+            break;
+
+        case 2:
+            daInsertAt(indexed, &err, &value, pos);
+            daInsertAt(plain, &err, &value, pos);
+            break;
+
+        case 3:
+            daPrepend(indexed, &err, &value);
+            daPrepend(plain, &err, &value);
+            break;
+
+        case 4:
+            daSet(indexed, &err, &value, pos);
+            daSet(plain, &err, &value, pos);
+            break;
+
+        case 5:
+            daRemove(indexed, &err, pos);
+            daRemove(plain, &err, pos);
+            break;
+
+        case 6:
+            daRemoveDirty(indexed, &err, pos);
+            daRemoveDirty(plain, &err, pos);
+            break;
+
+        case 7:
+            daRemoveRange(indexed, &err, pos, pos + (plain->used - pos) / 4);
+            daRemoveRange(plain, &err, pos, pos + (plain->used - pos) / 4);
+            break;
+        }
+
+        if (i % 100 == 0)
+        {
+            sput_fail_if(!sameLookups(indexed, plain), "The index should return the same results as a scan");
+        }
+    }
+
+    sput_fail_if(!sameLookups(indexed, plain), "The index should return the same results as a scan");
+
+    daClear(indexed, &err, DA_FAST);
+    daClear(plain, &err, DA_FAST);
+    sput_fail_if(!sameLookups(indexed, plain), "The index should be empty after daClear");
+
+    daDestroy(indexed, &err);
+    daDestroy(plain, &err);
+}
+
+static void testRebuild(void)
+{
+    int err;
+    size_t index;
+    unsigned int value;
+    DaStruct *da;
+
+    da = createArray(sizeof(unsigned int), 4, 100000);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (value = 0; value < 10; value++)
+    {
+        daAppend(da, &err, &value);
+    }
+
+    /* Bypass the index and rebuild it */
+    sput_fail_if(daIndexAttach(da, &err, 1024) != 0, "daIndexAttach should succeed");
+    value = 42;
+    memcpy(daGet(da, &err, 5), &value, sizeof(value));
+    sput_fail_if(daIndexAttach(da, &err, 1024) != 0, "daIndexAttach should rebuild an attached index");
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 5, "daIndexOf should find an element after the rebuild");
+
+    daDestroy(da, &err);
+}
+
+static void testSuspended(void)
+{
+    int err;
+    unsigned int value;
+    unsigned int *slots;
+    DaStruct *indexed;
+    DaStruct *plain;
+
+    indexed = createArray(sizeof(unsigned int), 4, 100000);
+    plain = createArray(sizeof(unsigned int), 4, 100000);
+    sput_fail_if(indexed == NULL || plain == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(indexed, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+
+    /* Slots suspend the index, the lookups scan the array until the next change rebuilds it */
+    slots = daAppendSlot(indexed, &err, 50, DA_DIRTY);
+    sput_fail_if(slots == NULL, "daAppendSlot should succeed");
+
+    for (value = 0; slots && value < 50; value++)
+    {
+        slots[value] = value % 20;
+        daAppend(plain, &err, &slots[value]);
+    }
+
+    sput_fail_if(!sameLookups(indexed, plain), "Lookups should scan the array while the index is suspended");
+
+    daRemove(indexed, &err, 3);
+    daRemove(plain, &err, 3);
+    sput_fail_if(!sameLookups(indexed, plain), "The next change should rebuild the index");
+
+    value = 7;
+    daSet(indexed, &err, &value, 0);
+    daSet(plain, &err, &value, 0);
+    daAppend(indexed, &err, &value);
+    daAppend(plain, &err, &value);
+    sput_fail_if(!sameLookups(indexed, plain), "The rebuilt index should be kept up to date");
+
+    daDestroy(indexed, &err);
+    daDestroy(plain, &err);
+}
+
+static void testRemoveDirty(void)
+{
+    int err;
+    size_t index;
+    unsigned int value;
+    DaStruct *da;
+
+    da = createArray(sizeof(unsigned int), 4, 100000);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (value = 0; value < 10; value++)
+    {
+        daAppend(da, &err, &value);
+    }
+
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daRemoveDirty(da, &err, 2) != 0, "daRemoveDirty should succeed");
+
+    value = 9;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 2, "daIndexOf should find the moved last element");
+    value = 2;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 0, "daIndexOf shouldn't find the removed element");
+    value = 5;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 5, "daIndexOf should find an element that kept its position");
+
+    /* A live index doesn't notice an element written behind its back, a suspended one would scan the array */
+    value = 42;
+    memcpy(daGet(da, &err, 5), &value, sizeof(value));
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 0, "daRemoveDirty should keep the index live");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daIndexAttach(&da, &err, 100) != -1, "daIndexAttach should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daIndexAttach should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daIndexAttach should fail if the limit is 0");
+    sput_run_test(testZeroLimit);
+
+    sput_enter_suite("daIndexAttach should respect the byte limit of the index");
+    sput_run_test(testExceedsSizeLimit);
+
+    sput_enter_suite("The index should stay consistent with the array");
+    sput_run_test(testConsistency);
+
+    sput_enter_suite("daIndexAttach should rebuild an attached index");
+    sput_run_test(testRebuild);
+
+    sput_enter_suite("A suspended index should get rebuilt by the next change of the array");
+    sput_run_test(testSuspended);
+
+    sput_enter_suite("daRemoveDirty should keep the index live without renumbering it");
+    sput_run_test(testRemoveDirty);
+
+    sput_enter_suite("daIndexAttach should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,75 @@
+#include "sput.h"
+#include "dynar.h"
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daIndexDetach(NULL, NULL) != -1, "daIndexDetach(NULL, NULL) != -1");
+    sput_fail_if(daIndexDetach(&da,  NULL) != -1, "daIndexDetach(&da,  NULL) != -1");
+    sput_fail_if(daIndexDetach(NULL, &err) != -1, "daIndexDetach(NULL, &err) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testDetach(void)
+{
+    int err;
+    size_t index;
+    const char *src;
+    DaDesc desc;
+    DaStruct *da;
+
+    desc.elements = 3;
+    desc.bytesPerElement = 1;
+    desc.maxBytes = 10;
+    da = daCreate(&desc, &err);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daIndexDetach(da, &err) != 0, "daIndexDetach should succeed if no index is attached");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+
+    src = "123";
+    daAppend(da, &err, src);
+    daAppend(da, &err, src + 1);
+    daAppend(da, &err, src + 2);
+
+    sput_fail_if(daIndexAttach(da, &err, 1024) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daIndexDetach(da, &err) != 0, "daIndexDetach should remove the index");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+    sput_fail_if(da->index != NULL, "daIndexDetach should reset the index pointer");
+
+    sput_fail_if(daIndexOf(da, &err, src + 2, &index) != 1 || index != 2, "daIndexOf should scan the array without index");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daIndexDetach(&da, &err) != -1, "daIndexDetach should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daIndexDetach should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daIndexDetach should remove the index");
+    sput_run_test(testDetach);
+
+    sput_enter_suite("daIndexDetach should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
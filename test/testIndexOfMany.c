@@ -0,0 +1,193 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static DaStruct *createPairs(size_t elements)
+{
+    int err;
+    size_t i;
+    unsigned int value;
+    DaStruct *da;
+
+    da = createArray(sizeof(value), elements, elements);
+
+    /* Every value occurs twice */
+    for (i = 0; da && i < elements; i++)
+    {
+        value = (unsigned int)(i % (elements / 2));
+        daAppend(da, &err, &value);
+    }
+
+    return da;
+}
+
+static void testNull(void)
+{
+    int err;
+    size_t idx;
+    DaStruct da;
+
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daIndexOfMany(&da, &err, &da, 1, NULL)  != -1, "daIndexOfMany(&da, &err, &da, 1, NULL)  != -1");
+    sput_fail_if(daIndexOfMany(&da, &err, NULL, 1, &idx) != -1, "daIndexOfMany(&da, &err, NULL, 1, &idx) != -1");
+    sput_fail_if(daIndexOfMany(&da, NULL, &da, 1, &idx)  != -1, "daIndexOfMany(&da, NULL, &da, 1, &idx)  != -1");
+    sput_fail_if(daIndexOfMany(NULL, &err, &da, 1, &idx) != -1, "daIndexOfMany(NULL, &err, &da, 1, &idx) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void checkKeys(DaStruct *da, size_t n)
+{
+    int err;
+    int ret;
+    size_t k;
+    size_t expect;
+    size_t *indexes;
+    unsigned int *keys;
+
+    keys = malloc(n * sizeof(unsigned int));
+    indexes = malloc(n * sizeof(size_t));
+
+    /* Existing keys in descending order, a duplicate key and a missing key */
+    for (k = 0; k < n; k++)
+    {
+        keys[k] = (unsigned int)((da->used / 2 - 1 - k) % (da->used / 2));
+    }
+    keys[0] = keys[n - 1];
+    keys[n / 2] = (unsigned int)da->used;
+
+    ret = daIndexOfMany(da, &err, keys, n, indexes);
+    sput_fail_if(ret != 0, "daIndexOfMany should return 0 if one key is missing");
+    sput_fail_if(err != DA_NOT_FOUND, "err != DA_NOT_FOUND");
+
+    for (k = 0; k < n; k++)
+    {
+        expect = (k == n / 2) ? DA_NPOS : keys[k];
+        sput_fail_if(indexes[k] != expect, "daIndexOfMany should return the first index of every key");
+    }
+
+    keys[n / 2] = 0;
+    ret = daIndexOfMany(da, &err, keys, n, indexes);
+    sput_fail_if(ret != 1, "daIndexOfMany should return 1 if all keys exist");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+    sput_fail_if(indexes[n / 2] != 0, "daIndexOfMany should return the first index of every key");
+
+    free(keys);
+    free(indexes);
+}
+
+static void testFound(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createPairs(1000);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    /* Direct comparison */
+    checkKeys(da, 2);
+    checkKeys(da, DA_FEW_KEYS);
+
+    /* Hash table of the keys */
+    checkKeys(da, DA_FEW_KEYS + 1);
+    checkKeys(da, 400);
+
+    /* Attached index */
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+    checkKeys(da, 2);
+    checkKeys(da, 400);
+
+    daDestroy(da, &err);
+}
+
+static void testEmpty(void)
+{
+    int err;
+    size_t idx;
+    unsigned int value;
+    DaStruct *da;
+
+    da = createPairs(10);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daIndexOfMany(da, &err, &value, 0, &idx) != 1, "daIndexOfMany should succeed without keys");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+
+    da->used = 0;
+    value = 0;
+    sput_fail_if(daIndexOfMany(da, &err, &value, 1, &idx) != 0, "daIndexOfMany shouldn't find a key if the array is empty");
+    sput_fail_if(err != DA_NOT_FOUND, "err != DA_NOT_FOUND");
+    sput_fail_if(idx != DA_NPOS, "idx != DA_NPOS");
+
+    daDestroy(da, &err);
+}
+
+static void testDuplicates(void)
+{
+    int err;
+    int failed;
+    size_t k;
+    size_t *indexes;
+    unsigned int *keys;
+    DaStruct *da;
+
+    da = createPairs(1000);
+    keys = malloc(100000 * sizeof(unsigned int));
+    indexes = malloc(100000 * sizeof(size_t));
+    sput_fail_if(da == NULL || keys == NULL || indexes == NULL, "Unable to create dynamic array.");
+
+    /* Many equal keys build long chains in the hash table of the keys */
+    for (k = 0; k < 100000; k++)
+    {
+        keys[k] = (k % 1000 == 0) ? (unsigned int)(k / 1000) : 7;
+    }
+
+    sput_fail_if(daIndexOfMany(da, &err, keys, 100000, indexes) != 1, "daIndexOfMany should find all keys");
+
+    for (k = 0, failed = 0; k < 100000; k++)
+    {
+        failed |= indexes[k] != keys[k];
+    }
+
+    sput_fail_if(failed, "daIndexOfMany should return the first index of every duplicate key");
+
+    free(keys);
+    free(indexes);
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    size_t ignore = 0;
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daIndexOfMany(&da, &err, &ignore, 1, &ignore) != -1, "daIndexOfMany should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daIndexOfMany should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daIndexOfMany should find the first occurence of every key");
+    sput_run_test(testFound);
+
+    sput_enter_suite("daIndexOfMany should handle empty arrays and key sets");
+    sput_run_test(testEmpty);
+
+    sput_enter_suite("daIndexOfMany should handle many duplicate keys");
+    sput_run_test(testDuplicates);
+
+    sput_enter_suite("daIndexOfMany should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,125 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+#define ELEMENTS (1024 * 1024)
+
+static DaStruct *createLarge(void)
+{
+    int err;
+    size_t i;
+    unsigned int value;
+    DaStruct *da;
+
+    da = createArray(sizeof(value), ELEMENTS, ELEMENTS);
+
+    for (i = 0; da && i < ELEMENTS; i++)
+    {
+        value = (unsigned int)(i % 1000);
+        daAppend(da, &err, &value);
+    }
+
+    return da;
+}
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    size_t idx;
+
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daIndexOfParallel(&da, &err, &da, NULL, 4)   != -1, "daIndexOfParallel(&da, &err, &da, NULL, 4)   != -1");
+    sput_fail_if(daIndexOfParallel(&da, &err, NULL, &idx, 4)  != -1, "daIndexOfParallel(&da, &err, NULL, &idx, 4)  != -1");
+    sput_fail_if(daIndexOfParallel(&da, NULL, &da, &idx, 4)   != -1, "daIndexOfParallel(&da, NULL, &da, &idx, 4)   != -1");
+    sput_fail_if(daIndexOfParallel(NULL, &err, &da, &idx, 4)  != -1, "daIndexOfParallel(NULL, &err, &da, &idx, 4)  != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+    sput_fail_if(daIndexOfParallel(NULL, NULL, NULL, NULL, 4) != -1, "daIndexOfParallel(NULL, NULL, NULL, NULL, 4) != -1");
+}
+
+static void testFound(void)
+{
+    int err;
+    size_t index;
+    size_t threads;
+    unsigned int value;
+    DaStruct *da;
+
+    da = createLarge();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (threads = 1; threads <= 8; threads *= 2)
+    {
+        value = 0;
+        sput_fail_if(daIndexOfParallel(da, &err, &value, &index, threads) != 1, "daIndexOfParallel should find the existing first element");
+        sput_fail_if(err != DA_OK, "err != DA_OK");
+        sput_fail_if(index != 0, "daIndexOfParallel should return the index of the first element");
+
+        value = 999;
+        sput_fail_if(daIndexOfParallel(da, &err, &value, &index, threads) != 1, "daIndexOfParallel should find an existing element");
+        sput_fail_if(index != 999, "daIndexOfParallel should return the index of the first occurence");
+    }
+
+    /* Only a single occurence far behind the first block */
+    value = 5000;
+    daSet(da, &err, &value, ELEMENTS - 3);
+    sput_fail_if(daIndexOfParallel(da, &err, &value, &index, 4) != 1, "daIndexOfParallel should find a single occurence");
+    sput_fail_if(index != ELEMENTS - 3, "daIndexOfParallel should return the index of a single occurence");
+
+    daDestroy(da, &err);
+}
+
+static void testNotFound(void)
+{
+    int err;
+    size_t index;
+    unsigned int value;
+    DaStruct *da;
+
+    da = createLarge();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    value = 1000;
+    sput_fail_if(daIndexOfParallel(da, &err, &value, &index, 4) != 0, "daIndexOfParallel shouldn't find an element that doesn't exist");
+    sput_fail_if(err != DA_NOT_FOUND, "err != DA_NOT_FOUND");
+
+    da->used = 0;
+    sput_fail_if(daIndexOfParallel(da, &err, &value, &index, 4) != 0, "daIndexOfParallel shouldn't find an element if the array is empty");
+    sput_fail_if(err != DA_NOT_FOUND, "err != DA_NOT_FOUND");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    size_t ignore = 0;
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daIndexOfParallel(&da, &err, &ignore, &ignore, 4) != -1, "daIndexOfParallel should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daIndexOfParallel should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daIndexOfParallel should find the first occurence of an existing element");
+    sput_run_test(testFound);
+
+    sput_enter_suite("daIndexOfParallel shouldn't find an element that doesn't exist");
+    sput_run_test(testNotFound);
+
+    sput_enter_suite("daIndexOfParallel should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
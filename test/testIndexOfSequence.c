@@ -0,0 +1,239 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+/* Creates an array of @p n elements of @p bytes bytes, element i holds the value values[i] in its last byte */
+static DaStruct *createTagged(size_t bytes, const char *values, size_t n)
+{
+    int err;
+    size_t i;
+    char element[8];
+    DaStruct *da;
+
+    da = createArray(bytes, n + 1, n + 1);
+
+    for (i = 0; da && i < n; i++)
+    {
+        memset(element, 'x', sizeof(element));
+        element[bytes - 1] = values[i];
+        daAppend(da, &err, element);
+    }
+
+    return da;
+}
+
+/* Returns the index of the first occurence of the @p m values of @p needle in the @p n values of @p haystack or n */
+static size_t naive(const char *haystack, size_t n, const char *needle, size_t m)
+{
+    size_t i;
+    size_t found;
+
+    for (i = 0, found = n; m <= n && i <= n - m; i++)
+    {
+        if (memcmp(haystack + i, needle, m) == 0)
+        {
+            found = i;
+            break;
+        }
+    }
+
+    return found;
+}
+
+/* Searches the @p m values of @p needle and compares the result with the naive search */
+static int check(const char *haystack, size_t n, const char *needle, size_t m)
+{
+    int err;
+    int rc;
+    int ignore = 0;
+    size_t bytes;
+    size_t expected;
+    size_t index;
+    size_t i;
+    char sequence[64 * 8];
+    DaStruct *da;
+
+    expected = naive(haystack, n, needle, m);
+
+    for (bytes = 1; bytes <= 8; bytes *= 2)
+    {
+        da = createTagged(bytes, haystack, n);
+
+        for (i = 0; i < m; i++)
+        {
+            memset(sequence + (i * bytes), 'x', bytes);
+            sequence[(i * bytes) + bytes - 1] = needle[i];
+        }
+
+        index = (size_t)-1;
+        rc = daIndexOfSequence(da, &err, sequence, m, &index);
+        daDestroy(da, &ignore);
+
+        if (expected == n ? (rc != 0 || err != DA_NOT_FOUND) : (rc != 1 || err != DA_OK || index != expected))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static void testFound(void)
+{
+    sput_fail_if(check("abcabcabd", 9, "abd", 3), "daIndexOfSequence should find a sequence at the end");
+    sput_fail_if(check("abdabcabc", 9, "abd", 3), "daIndexOfSequence should find a sequence at the start");
+    sput_fail_if(check("abcabcabc", 9, "abc", 3), "daIndexOfSequence should find the first of several occurences");
+    sput_fail_if(check("aabaabaaba", 10, "aaba", 4), "daIndexOfSequence should find overlapping occurences");
+    sput_fail_if(check("abcabcabc", 9, "abcabcabc", 9), "daIndexOfSequence should find a sequence as long as the array");
+    sput_fail_if(check("abcabcabc", 9, "c", 1), "daIndexOfSequence should find a single element");
+    sput_fail_if(check("abcabcabc", 9, "abd", 3), "daIndexOfSequence shouldn't find a missing sequence");
+    sput_fail_if(check("abc", 3, "abcd", 4), "daIndexOfSequence shouldn't find a sequence longer than the array");
+    sput_fail_if(check("", 0, "a", 1), "daIndexOfSequence shouldn't find a sequence in an empty array");
+}
+
+static void testWorstCase(void)
+{
+    char haystack[4096];
+    char needle[64];
+
+    /* Every position is a candidate whose verification fails late, the search switches to the automaton */
+    memset(haystack, 'a', sizeof(haystack));
+    memset(needle, 'a', sizeof(needle));
+    needle[63] = 'b';
+
+    sput_fail_if(check(haystack, sizeof(haystack), needle, sizeof(needle)), "daIndexOfSequence shouldn't find a missing sequence");
+
+    haystack[3000] = 'b';
+    sput_fail_if(check(haystack, sizeof(haystack), needle, sizeof(needle)), "daIndexOfSequence should find a sequence after many partial matches");
+
+    haystack[3500] = 'b';
+    sput_fail_if(check(haystack, sizeof(haystack), needle, sizeof(needle)), "daIndexOfSequence should find the first of several occurences after many partial matches");
+}
+
+static void testRandom(void)
+{
+    int failed;
+    size_t round;
+    size_t i;
+    size_t m;
+    char haystack[300];
+    char needle[12];
+
+    srand(3);
+    for (round = 0, failed = 0; round < 200; round++)
+    {
+        for (i = 0; i < sizeof(haystack); i++)
+        {
+            haystack[i] = (char)('a' + rand() % 2);
+        }
+
+        m = 2 + (size_t)rand() % 10;
+        for (i = 0; i < m; i++)
+        {
+            needle[i] = (char)('a' + rand() % 2);
+        }
+
+        failed |= check(haystack, sizeof(haystack), needle, m);
+    }
+
+    sput_fail_if(failed, "daIndexOfSequence should return the same index as a naive search");
+}
+
+static void testBoundaries(void)
+{
+    int err;
+    size_t index;
+    unsigned short values[] = { 0x0102, 0x0304, 0x0506 };
+    unsigned char bytes[4];
+    DaDesc desc;
+    DaStruct *da;
+
+    desc.elements = 3;
+    desc.bytesPerElement = sizeof(unsigned short);
+    desc.maxBytes = 3 * sizeof(unsigned short);
+    da = daCreate(&desc, &err);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    daAppend(da, &err, &values[0]);
+    daAppend(da, &err, &values[1]);
+    daAppend(da, &err, &values[2]);
+
+    /* The bytes of the array shifted by one byte */
+    memcpy(bytes, (const char *)values + 1, 4);
+    sput_fail_if(daIndexOfSequence(da, &err, bytes, 2, &index) != 0, "daIndexOfSequence shouldn't find a match starting inside an element");
+    sput_fail_if(err != DA_NOT_FOUND, "err != DA_NOT_FOUND");
+
+    sput_fail_if(daIndexOfSequence(da, &err, &values[1], 2, &index) != 1 || index != 1, "daIndexOfSequence should find a match at an element boundary");
+
+    daDestroy(da, &err);
+}
+
+static void testNull(void)
+{
+    int err;
+    size_t index;
+    DaStruct da;
+
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daIndexOfSequence(&da, &err, &da, 1, NULL)    != -1, "daIndexOfSequence(&da, &err, &da, 1, NULL)    != -1");
+    sput_fail_if(daIndexOfSequence(&da, &err, NULL, 1, &index) != -1, "daIndexOfSequence(&da, &err, NULL, 1, &index) != -1");
+    sput_fail_if(daIndexOfSequence(&da, NULL, &da, 1, &index)  != -1, "daIndexOfSequence(&da, NULL, &da, 1, &index)  != -1");
+    sput_fail_if(daIndexOfSequence(NULL, &err, &da, 1, &index) != -1, "daIndexOfSequence(NULL, &err, &da, 1, &index) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testEmptySequence(void)
+{
+    int err;
+    size_t index;
+    DaStruct *da;
+
+    da = createTagged(4, "abc", 3);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daIndexOfSequence(da, &err, "abc", 0, &index) != -1, "daIndexOfSequence should fail for an empty sequence");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    size_t index;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daIndexOfSequence(&da, &err, &index, 1, &index) != -1, "daIndexOfSequence should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daIndexOfSequence should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daIndexOfSequence should fail for an empty sequence");
+    sput_run_test(testEmptySequence);
+
+    sput_enter_suite("daIndexOfSequence should find the first occurence of a sequence for any element size");
+    sput_run_test(testFound);
+    sput_run_test(testRandom);
+
+    sput_enter_suite("daIndexOfSequence should stay correct for many partial matches");
+    sput_run_test(testWorstCase);
+
+    sput_enter_suite("daIndexOfSequence should only find matches at element boundaries");
+    sput_run_test(testBoundaries);
+
+    sput_enter_suite("daIndexOfSequence should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,166 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static void testNull(void)
+{
+    int err;
+    int ignore = 0;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daInsertRange(NULL, NULL, &ignore, 1, 0) != NULL, "daInsertRange(NULL, NULL, &ignore, 1, 0) != NULL");
+    sput_fail_if(daInsertRange(&da,  NULL, &ignore, 1, 0) != NULL, "daInsertRange(da,   NULL, &ignore, 1, 0) != NULL");
+
+    sput_fail_if(daInsertRange(&da,  &err, NULL, 1, 0)    != NULL, "daInsertRange(da,   &err, NULL, 1, 0)    != NULL");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+
+    sput_fail_if(daInsertRange(NULL, &err, &ignore, 1, 0) != NULL, "daInsertRange(NULL, &err, &ignore, 1, 0) != NULL");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testInsert(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createFrom("0145", 4, 1, 4, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daInsertRange(da, &err, "23", 2, 2) != (char *)da->firstAddr + 2, "daInsertRange should return the address of the first inserted element");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+    sput_fail_if(da->used != 6 || memcmp(da->firstAddr, "012345", 6) != 0, "daInsertRange should insert the elements in the middle");
+    sput_fail_if(da->max != 8, "daInsertRange should double the capacity until the elements fit");
+
+    sput_fail_if(daInsertRange(da, &err, "ab", 2, 0) != da->firstAddr, "daInsertRange should insert the elements at the start");
+    sput_fail_if(da->used != 8 || memcmp(da->firstAddr, "ab012345", 8) != 0, "daInsertRange should shift all elements");
+
+    sput_fail_if(daInsertRange(da, &err, "cd", 2, 7) != (char *)da->firstAddr + 7, "daInsertRange should insert the elements in front of the last one");
+    sput_fail_if(da->used != 10 || memcmp(da->firstAddr, "ab01234cd5", 10) != 0, "daInsertRange should keep the last element behind the inserted ones");
+
+    sput_fail_if(daInsertRange(da, &err, "x", 0, 3) != (char *)da->firstAddr + 3, "daInsertRange should return the element at pos for 0 elements");
+    sput_fail_if(da->used != 10, "daInsertRange shouldn't change the array for 0 elements");
+
+    daDestroy(da, &err);
+}
+
+static void testBounds(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createFrom("", 0, 1, 4, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daInsertRange(da, &err, "01", 2, 1) != NULL, "daInsertRange should fail for a position behind an empty array");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daInsertRange(da, &err, "01", 2, 0) == NULL, "daInsertRange should accept position 0 for an empty array");
+    sput_fail_if(da->used != 2 || memcmp(da->firstAddr, "01", 2) != 0, "daInsertRange should fill an empty array");
+
+    sput_fail_if(daInsertRange(da, &err, "23", 2, 2) != NULL, "daInsertRange should fail for the position behind the last element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+    sput_fail_if(da->used != 2, "daInsertRange shouldn't change the array if it fails");
+
+    daDestroy(da, &err);
+}
+
+static void testSelf(void)
+{
+    int err;
+    DaStruct *da;
+
+    /* The source lies in front of, behind and across the gap */
+    da = createFrom("abcdef", 6, 1, 6, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daInsertRange(da, &err, da->firstAddr, 2, 4) == NULL, "daInsertRange should insert elements of the array itself");
+    sput_fail_if(da->used != 8 || memcmp(da->firstAddr, "abcdabef", 8) != 0, "daInsertRange should copy elements in front of the gap");
+
+    sput_fail_if(daInsertRange(da, &err, (char *)da->firstAddr + 5, 3, 1) == NULL, "daInsertRange should insert elements of the array itself");
+    sput_fail_if(da->used != 11 || memcmp(da->firstAddr, "abefbcdabef", 11) != 0, "daInsertRange should copy elements behind the gap");
+
+    sput_fail_if(daInsertRange(da, &err, (char *)da->firstAddr + 1, 4, 3) == NULL, "daInsertRange should insert elements of the array itself");
+    sput_fail_if(da->used != 15 || memcmp(da->firstAddr, "abebefbfbcdabef", 15) != 0, "daInsertRange should copy elements across the gap");
+
+    daDestroy(da, &err);
+}
+
+static void testBytesLimit(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createFrom("0123", 4, 1, 4, 8);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daInsertRange(da, &err, "abcde", 5, 1) != NULL, "daInsertRange should fail if the elements exceed the bytes limit");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT), "err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT)");
+    sput_fail_if(da->used != 4 || memcmp(da->firstAddr, "0123", 4) != 0, "daInsertRange shouldn't insert any element if it fails");
+
+    sput_fail_if(daInsertRange(da, &err, "abcd", 4, 1) == NULL, "daInsertRange should fill the array up to the bytes limit");
+    sput_fail_if(da->used != 8 || memcmp(da->firstAddr, "0abcd123", 8) != 0, "daInsertRange should insert all elements");
+
+    daDestroy(da, &err);
+}
+
+static void testSidecars(void)
+{
+    int err;
+    size_t index;
+    DaStruct *da;
+
+    da = createFrom("abcd", 4, 1, 4, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(da, &err, 4096) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daBloomAttach(da, &err, 10, 4096) != 0, "daBloomAttach should succeed");
+
+    daInsertRange(da, &err, "xyz", 3, 1);
+
+    sput_fail_if(daIndexOf(da, &err, "y", &index) != 1 || index != 2, "daIndexOf should find an inserted element");
+    sput_fail_if(daIndexOf(da, &err, "d", &index) != 1 || index != 6, "daIndexOf should find a shifted element");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int ignore = 0;
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daInsertRange(&da, &err, &ignore, 1, 0) != NULL, "daInsertRange should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daInsertRange should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daInsertRange should insert all elements with a single shift");
+    sput_run_test(testInsert);
+
+    sput_enter_suite("daInsertRange should follow the position rules of daInsertAt");
+    sput_run_test(testBounds);
+
+    sput_enter_suite("daInsertRange should insert elements of the array itself");
+    sput_run_test(testSelf);
+
+    sput_enter_suite("daInsertRange should insert all elements or none");
+    sput_run_test(testBytesLimit);
+
+    sput_enter_suite("daInsertRange should update an attached index and filter");
+    sput_run_test(testSidecars);
+
+    sput_enter_suite("daInsertRange should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,127 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daInsertSlot(NULL, NULL, 0, 1, DA_ZERO) != NULL, "daInsertSlot(NULL, NULL, 0, 1, DA_ZERO) != NULL");
+    sput_fail_if(daInsertSlot(&da,  NULL, 0, 1, DA_ZERO) != NULL, "daInsertSlot(da,   NULL, 0, 1, DA_ZERO) != NULL");
+
+    sput_fail_if(daInsertSlot(NULL, &err, 0, 1, DA_ZERO) != NULL, "daInsertSlot(NULL, &err, 0, 1, DA_ZERO) != NULL");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testSlots(void)
+{
+    int err;
+    char *slot;
+    DaStruct *da;
+
+    da = createFrom("0145", 4, 1, 4, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    slot = daInsertSlot(da, &err, 2, 2, DA_DIRTY);
+    sput_fail_if(slot != (char *)da->firstAddr + 2, "daInsertSlot should return the address of the first slot");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+    sput_fail_if(da->used != 6 || da->max != 8, "daInsertSlot should count the slots as elements");
+
+    slot[0] = '2';
+    slot[1] = '3';
+    sput_fail_if(memcmp(da->firstAddr, "012345", 6) != 0, "daInsertSlot should shift the elements behind the slots");
+
+    slot = daInsertSlot(da, &err, 0, 3, DA_ZERO);
+    sput_fail_if(slot != da->firstAddr, "daInsertSlot should insert slots at the start");
+    sput_fail_if(da->used != 9 || memcmp(da->firstAddr, "\0\0\0" "012345", 9) != 0, "daInsertSlot should zero the slots");
+
+    sput_fail_if(daInsertSlot(da, &err, 4, 0, DA_ZERO) != (char *)da->firstAddr + 4, "daInsertSlot should return the element at pos for 0 slots");
+    sput_fail_if(da->used != 9, "daInsertSlot shouldn't change the array for 0 slots");
+
+    daDestroy(da, &err);
+}
+
+static void testInvalid(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createFrom("", 0, 1, 4, 4);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daInsertSlot(da, &err, 0, 1, DA_FAST + DA_SECURE) != NULL, "daInsertSlot should fail for an unknown mode");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_UNKNOWN_MODE), "err != (DA_PARAM_ERR | DA_UNKNOWN_MODE)");
+
+    sput_fail_if(daInsertSlot(da, &err, 1, 1, DA_ZERO) != NULL, "daInsertSlot should fail for a position behind an empty array");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daInsertSlot(da, &err, 0, 2, DA_ZERO) == NULL, "daInsertSlot should accept position 0 for an empty array");
+
+    sput_fail_if(daInsertSlot(da, &err, 2, 1, DA_ZERO) != NULL, "daInsertSlot should fail for the position behind the last element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daInsertSlot(da, &err, 1, 3, DA_ZERO) != NULL, "daInsertSlot should fail if the slots exceed the bytes limit");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT), "err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT)");
+    sput_fail_if(da->used != 2, "daInsertSlot shouldn't change the array if it fails");
+
+    daDestroy(da, &err);
+}
+
+static void testSidecars(void)
+{
+    int err;
+    size_t index;
+    char *slot;
+    DaStruct *da;
+
+    da = createFrom("abcd", 4, 1, 4, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(da, &err, 4096) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daBloomAttach(da, &err, 10, 4096) != 0, "daBloomAttach should succeed");
+
+    slot = daInsertSlot(da, &err, 1, 2, DA_DIRTY);
+    slot[0] = 'x';
+    slot[1] = 'y';
+
+    sput_fail_if(daIndexOf(da, &err, "y", &index) != 1 || index != 2, "daIndexOf should find an element written into a slot");
+    sput_fail_if(daIndexOf(da, &err, "d", &index) != 1 || index != 5, "daIndexOf should find a shifted element");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daInsertSlot(&da, &err, 0, 1, DA_ZERO) != NULL, "daInsertSlot should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daInsertSlot should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daInsertSlot should insert uninitialized or zeroed slots");
+    sput_run_test(testSlots);
+
+    sput_enter_suite("daInsertSlot should fail for an unknown mode, an invalid position or too many slots");
+    sput_run_test(testInvalid);
+
+    sput_enter_suite("daInsertSlot should let the index and the filter see the content written into the slots");
+    sput_run_test(testSidecars);
+
+    sput_enter_suite("daInsertSlot should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,161 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+#define RECORD 16
+
+/* Records of 16 bytes: a flags byte, an 8 byte id at offset 4 and filler bytes */
+static DaStruct *createRecords(void)
+{
+    int err;
+    int i;
+    char record[RECORD];
+    DaStruct *da;
+
+    da = createArray(RECORD, 100, 100);
+
+    for (i = 0; da && i < 100; i++)
+    {
+        memset(record, 'x', RECORD);
+        record[0] = (char)(i % 2);
+        sprintf(record + 4, "id%06d", i % 50);
+        record[12] = (char)i;
+        daAppend(da, &err, record);
+    }
+
+    return da;
+}
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    size_t idx;
+
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daLastIndexOfKey(&da, &err, &da, 0, 1, NULL, NULL)  != -1, "daLastIndexOfKey(&da, &err, &da, 0, 1, NULL, NULL)  != -1");
+    sput_fail_if(daLastIndexOfKey(&da, &err, NULL, 0, 1, NULL, &idx) != -1, "daLastIndexOfKey(&da, &err, NULL, 0, 1, NULL, &idx) != -1");
+    sput_fail_if(daLastIndexOfKey(&da, NULL, &da, 0, 1, NULL, &idx)  != -1, "daLastIndexOfKey(&da, NULL, &da, 0, 1, NULL, &idx)  != -1");
+    sput_fail_if(daLastIndexOfKey(NULL, &err, &da, 0, 1, NULL, &idx) != -1, "daLastIndexOfKey(NULL, &err, &da, 0, 1, NULL, &idx) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testOutOfBounds(void)
+{
+    int err;
+    size_t idx;
+    DaStruct *da;
+
+    da = createRecords();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daLastIndexOfKey(da, &err, "id", 4, 0, NULL, &idx) != -1, "daLastIndexOfKey should fail if the key is empty");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daLastIndexOfKey(da, &err, "idxxxx", 12, 5, NULL, &idx) != -1, "daLastIndexOfKey should fail if the key exceeds the element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daLastIndexOfKey(da, &err, "i", RECORD, 1, NULL, &idx) != -1, "daLastIndexOfKey should fail if the offset exceeds the element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testFound(void)
+{
+    int err;
+    size_t index;
+    char key[RECORD];
+    unsigned char mask[RECORD];
+    DaStruct *da;
+
+    da = createRecords();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    /* 8 byte key */
+    sprintf(key, "id%06d", 17);
+    sput_fail_if(daLastIndexOfKey(da, &err, key, 4, 8, NULL, &index) != 1, "daLastIndexOfKey should find an 8 byte key");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+    sput_fail_if(index != 67, "daLastIndexOfKey should return the last index of an 8 byte key");
+
+    /* 1, 2, 4 byte and odd sized keys */
+    key[0] = 1;
+    sput_fail_if(daLastIndexOfKey(da, &err, key, 0, 1, NULL, &index) != 1 || index != 99, "daLastIndexOfKey should find a 1 byte key");
+    sput_fail_if(daLastIndexOfKey(da, &err, "17", 10, 2, NULL, &index) != 1 || index != 67, "daLastIndexOfKey should find a 2 byte key");
+    sput_fail_if(daLastIndexOfKey(da, &err, "0017", 8, 4, NULL, &index) != 1 || index != 67, "daLastIndexOfKey should find a 4 byte key");
+    sput_fail_if(daLastIndexOfKey(da, &err, "017", 9, 3, NULL, &index) != 1 || index != 67, "daLastIndexOfKey should find a 3 byte key");
+
+    /* Masked keys: ignore the last digit of the id */
+    sprintf(key, "id%06d", 29);
+    memset(mask, 0xff, sizeof(mask));
+    mask[7] = 0;
+    sput_fail_if(daLastIndexOfKey(da, &err, key, 4, 8, mask, &index) != 1 || index != 79, "daLastIndexOfKey should apply a short mask");
+
+    memset(key, 'x', RECORD);
+    sprintf(key + 4, "id%06d", 29);
+    mask[0] = 0;
+    mask[7] = 0xff;
+    mask[8] = 0;
+    mask[11] = 0;
+    mask[12] = 0;
+    sput_fail_if(daLastIndexOfKey(da, &err, key, 0, RECORD, mask, &index) != 1 || index != 79, "daLastIndexOfKey should apply a long mask");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+
+    daDestroy(da, &err);
+}
+
+static void testNotFound(void)
+{
+    int err;
+    size_t index;
+    DaStruct *da;
+
+    da = createRecords();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daLastIndexOfKey(da, &err, "id000050", 4, 8, NULL, &index) != 0, "daLastIndexOfKey shouldn't find a key that doesn't exist");
+    sput_fail_if(err != DA_NOT_FOUND, "err != DA_NOT_FOUND");
+
+    da->used = 0;
+    sput_fail_if(daLastIndexOfKey(da, &err, "id000001", 4, 8, NULL, &index) != 0, "daLastIndexOfKey shouldn't find a key if the array is empty");
+    sput_fail_if(err != DA_NOT_FOUND, "err != DA_NOT_FOUND");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    size_t ignore = 0;
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daLastIndexOfKey(&da, &err, &ignore, 0, 1, NULL, &ignore) != -1, "daLastIndexOfKey should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daLastIndexOfKey should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daLastIndexOfKey should fail if the key exceeds the element");
+    sput_run_test(testOutOfBounds);
+
+    sput_enter_suite("daLastIndexOfKey should find the last element with an existing key");
+    sput_run_test(testFound);
+
+    sput_enter_suite("daLastIndexOfKey shouldn't find a key that doesn't exist");
+    sput_run_test(testNotFound);
+
+    sput_enter_suite("daLastIndexOfKey should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,182 @@
+#include "sput.h"
+#include "dynar.h"
+
+#define RECORD 16
+#define OFFSET 4
+
+/**
+ * Stores the sorted VALUES at offset OFFSET of records and checks the function for every probe
+ * against the number of values that are less than (lt) and not greater than (le) the probe.
+ */
+#define CHECK_TYPE(T, TYPE, VALUES, PROBES) \
+    do \
+    { \
+        size_t i; \
+        size_t j; \
+        size_t lt; \
+        size_t le; \
+        char record[RECORD]; \
+        DaDesc desc; \
+        DaStruct *da; \
+        \
+        desc.elements = sizeof(VALUES) / sizeof(T); \
+        desc.bytesPerElement = RECORD; \
+        desc.maxBytes = 1024 * RECORD; \
+        da = daCreate(&desc, &err); \
+        sput_fail_if(da == NULL, "Unable to create dynamic array."); \
+        \
+        for (i = 0; da && i < sizeof(VALUES) / sizeof(T); i++) \
+        { \
+            memset(record, 0xab, RECORD); \
+            memcpy(record + OFFSET, &VALUES[i], sizeof(T)); \
+            daAppend(da, &err, record); \
+        } \
+        \
+        for (j = 0; da && j < sizeof(PROBES) / sizeof(T); j++) \
+        { \
+            for (i = 0, lt = 0, le = 0; i < sizeof(VALUES) / sizeof(T); i++) \
+            { \
+                lt += VALUES[i] < PROBES[j]; \
+                le += VALUES[i] <= PROBES[j]; \
+            } \
+            \
+            sput_fail_if(check(da, &PROBES[j], TYPE, lt, le), "daLowerBoundKey returned the wrong result for a " #TYPE " key"); \
+        } \
+        \
+        daDestroy(da, &err); \
+    } \
+    while (0)
+
+
+static int check(DaStruct *da, const void *key, int type, size_t lt, size_t le)
+{
+    int err;
+    size_t index;
+
+    (void)le;
+
+    return daLowerBoundKey(da, &err, key, type, OFFSET, &index) != 0 || err != DA_OK || index != lt;
+}
+
+static void testTypes(void)
+{
+    int err;
+    unsigned char u8[] = { 0, 1, 1, 7, 127, 128, 200, 255 };
+    unsigned char u8Probes[] = { 0, 1, 2, 127, 128, 129, 255 };
+    signed char s8[] = { -128, -5, -1, -1, 0, 3, 127 };
+    signed char s8Probes[] = { -128, -6, -1, 0, 1, 127 };
+    unsigned short u16[] = { 0, 255, 256, 256, 40000, 65535 };
+    unsigned short u16Probes[] = { 0, 1, 255, 256, 257, 40000, 65535 };
+    short s16[] = { -32768, -300, -1, 0, 0, 255, 256, 32767 };
+    short s16Probes[] = { -32768, -301, -1, 0, 1, 256, 32767 };
+    unsigned int u32[] = { 0, 1, 65536, 65536, 3000000000U, 4294967295U };
+    unsigned int u32Probes[] = { 0, 2, 65535, 65536, 3000000000U, 4294967295U };
+    int s32[] = { -2147483647 - 1, -70000, -1, 0, 1, 70000, 70000, 2147483647 };
+    int s32Probes[] = { -2147483647 - 1, -69999, -1, 0, 2, 70000, 2147483647 };
+    unsigned long ul[] = { 0, 1, 65536, 4294967295UL, 4294967295UL };
+    unsigned long ulProbes[] = { 0, 2, 65536, 4294967294UL, 4294967295UL };
+    long sl[] = { -2147483647L - 1, -256, -1, 0, 255, 256, 2147483647L };
+    long slProbes[] = { -2147483647L - 1, -257, -1, 0, 1, 256, 2147483647L };
+    float f32[] = { -1e30f, -2.5f, -0.5f, 0.0f, 0.25f, 0.25f, 1.0f, 3e20f };
+    float f32Probes[] = { -1e30f, -3.0f, -0.5f, -0.25f, 0.0f, 0.25f, 2.0f, 3e20f };
+    double f64[] = { -1e300, -2.5, -2.5, -0.5, 0.0, 0.125, 1.0, 1e300 };
+    double f64Probes[] = { -1e300, -2.5, -1.0, 0.0, 0.125, 0.5, 1e300 };
+
+    CHECK_TYPE(unsigned char, DA_KEY_U8, u8, u8Probes);
+    CHECK_TYPE(signed char, DA_KEY_S8, s8, s8Probes);
+    CHECK_TYPE(unsigned short, DA_KEY_U16, u16, u16Probes);
+    CHECK_TYPE(short, DA_KEY_S16, s16, s16Probes);
+    CHECK_TYPE(unsigned int, DA_KEY_U32, u32, u32Probes);
+    CHECK_TYPE(int, DA_KEY_S32, s32, s32Probes);
+    CHECK_TYPE(float, DA_KEY_F32, f32, f32Probes);
+    CHECK_TYPE(double, DA_KEY_F64, f64, f64Probes);
+
+    if (sizeof(long) == 8)
+    {
+        CHECK_TYPE(unsigned long, DA_KEY_U64, ul, ulProbes);
+        CHECK_TYPE(long, DA_KEY_S64, sl, slProbes);
+    }
+}
+
+static void testNull(void)
+{
+    int err;
+    int key;
+    DaStruct da;
+    size_t idx;
+
+    key = 0;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daLowerBoundKey(&da, &err, &key, DA_KEY_S32, 0, NULL) != -1, "daLowerBoundKey(&da, &err, &key, DA_KEY_S32, 0, NULL) != -1");
+    sput_fail_if(daLowerBoundKey(&da, &err, NULL, DA_KEY_S32, 0, &idx) != -1, "daLowerBoundKey(&da, &err, NULL, DA_KEY_S32, 0, &idx) != -1");
+    sput_fail_if(daLowerBoundKey(&da, NULL, &key, DA_KEY_S32, 0, &idx) != -1, "daLowerBoundKey(&da, NULL, &key, DA_KEY_S32, 0, &idx) != -1");
+    sput_fail_if(daLowerBoundKey(NULL, &err, &key, DA_KEY_S32, 0, &idx) != -1, "daLowerBoundKey(NULL, &err, &key, DA_KEY_S32, 0, &idx) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testInvalid(void)
+{
+    int err;
+    int key;
+    size_t idx;
+    DaDesc desc;
+    DaStruct *da;
+
+    key = 0;
+    desc.elements = 10;
+    desc.bytesPerElement = RECORD;
+    desc.maxBytes = 1024 * RECORD;
+    da = daCreate(&desc, &err);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daLowerBoundKey(da, &err, &key, DA_KEY_SIGNED | 3, 0, &idx) != -1, "daLowerBoundKey should fail for an unknown key width");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_UNKNOWN_MODE), "err != (DA_PARAM_ERR | DA_UNKNOWN_MODE)");
+
+    sput_fail_if(daLowerBoundKey(da, &err, &key, DA_KEY_FLOAT | 2, 0, &idx) != -1, "daLowerBoundKey should fail for a 2 byte floating point key");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_UNKNOWN_MODE), "err != (DA_PARAM_ERR | DA_UNKNOWN_MODE)");
+
+    sput_fail_if(daLowerBoundKey(da, &err, &key, 0x400 | 4, 0, &idx) != -1, "daLowerBoundKey should fail for an unknown key type");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_UNKNOWN_MODE), "err != (DA_PARAM_ERR | DA_UNKNOWN_MODE)");
+
+    sput_fail_if(daLowerBoundKey(da, &err, &key, DA_KEY_F64, RECORD - 4, &idx) != -1, "daLowerBoundKey should fail if the key exceeds the element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daLowerBoundKey(da, &err, &key, DA_KEY_U8, RECORD, &idx) != -1, "daLowerBoundKey should fail if the offset exceeds the element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    size_t ignore = 0;
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daLowerBoundKey(&da, &err, &ignore, DA_KEY_U8, 0, &ignore) != -1, "daLowerBoundKey should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daLowerBoundKey should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daLowerBoundKey should fail for an unknown key type or a key exceeding the element");
+    sput_run_test(testInvalid);
+
+    sput_enter_suite("daLowerBoundKey should return the first element whose key is not less than the key for all key types");
+    sput_run_test(testTypes);
+
+    sput_enter_suite("daLowerBoundKey should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,111 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+/* Replaces every element by its position plus one */
+static void increment(void *elements, size_t n, size_t pos, void *ctx)
+{
+    int *values = elements;
+    size_t i;
+
+    (void)ctx;
+
+    for (i = 0; i < n; i++)
+    {
+        values[i] = (int)(pos + i) + 1;
+    }
+}
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daMapInPlace(&da,  &err, NULL,      NULL) != -1, "daMapInPlace(&da,  &err, NULL,      NULL) != -1");
+    sput_fail_if(daMapInPlace(&da,  NULL, increment, NULL) != -1, "daMapInPlace(&da,  NULL, increment, NULL) != -1");
+    sput_fail_if(daMapInPlace(NULL, &err, increment, NULL) != -1, "daMapInPlace(NULL, &err, increment, NULL) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testMap(void)
+{
+    static const size_t sizes[] = { 0, 1, 1000, 200000 };
+    int err;
+    int failed;
+    size_t s;
+    size_t i;
+    DaStruct *da;
+
+    for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        da = createInts(0, sizes[s], sizes[s] + 1, sizes[s] + 1);
+        sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+        sput_fail_if(daMapInPlace(da, &err, increment, NULL) != 0 || err != DA_OK, "daMapInPlace should succeed");
+
+        for (i = 0, failed = 0; i < sizes[s]; i++)
+        {
+            failed |= *(int *)daGet(da, &err, i) != (int)i + 1;
+        }
+
+        sput_fail_if(failed || daSize(da, &err) != sizes[s], "daMapInPlace should change all elements");
+
+        daDestroy(da, &err);
+    }
+}
+
+static void testSidecars(void)
+{
+    int err;
+    int value;
+    size_t index;
+    DaStruct *da;
+
+    da = createInts(0, 1000, 1001, 1001);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024 * 1024) != 0, "daBloomAttach should succeed");
+
+    daMapInPlace(da, &err, increment, NULL);
+
+    value = 1000;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 999, "daIndexOf should find a changed element");
+
+    value = 0;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 0, "daIndexOf shouldn't find a replaced element");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daMapInPlace(&da, &err, increment, NULL) != -1, "daMapInPlace should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daMapInPlace should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daMapInPlace should change all elements");
+    sput_run_test(testMap);
+
+    sput_enter_suite("daMapInPlace should keep lookups through the index and the filter correct");
+    sput_run_test(testSidecars);
+
+    sput_enter_suite("daMapInPlace should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,92 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+#define ELEMENTS (1024 * 1024)
+
+/* Adds the position to every element */
+static void addPosition(void *elements, size_t n, size_t pos, void *ctx)
+{
+    int *values = elements;
+    size_t i;
+
+    (void)ctx;
+
+    for (i = 0; i < n; i++)
+    {
+        values[i] += (int)(pos + i);
+    }
+}
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daMapInPlaceParallel(&da,  &err, NULL,        NULL, 4) != -1, "daMapInPlaceParallel(&da,  &err, NULL,        NULL, 4) != -1");
+    sput_fail_if(daMapInPlaceParallel(&da,  NULL, addPosition, NULL, 4) != -1, "daMapInPlaceParallel(&da,  NULL, addPosition, NULL, 4) != -1");
+    sput_fail_if(daMapInPlaceParallel(NULL, &err, addPosition, NULL, 4) != -1, "daMapInPlaceParallel(NULL, &err, addPosition, NULL, 4) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testMap(void)
+{
+    static const size_t sizes[] = { 0, 1000, ELEMENTS };
+    int err;
+    int failed;
+    size_t s;
+    size_t i;
+    size_t threads;
+    DaStruct *da;
+
+    for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        for (threads = 1; threads <= 8; threads *= 2)
+        {
+            da = createInts(0, sizes[s], sizes[s] + 1, sizes[s] + 1);
+            sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+            sput_fail_if(daMapInPlaceParallel(da, &err, addPosition, NULL, threads) != 0 || err != DA_OK, "daMapInPlaceParallel should succeed");
+
+            /* Every element has to be changed exactly once */
+            for (i = 0, failed = 0; i < sizes[s]; i++)
+            {
+                failed |= *(int *)daGet(da, &err, i) != 2 * (int)i;
+            }
+
+            sput_fail_if(failed, "daMapInPlaceParallel should change every element once");
+
+            daDestroy(da, &err);
+        }
+    }
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daMapInPlaceParallel(&da, &err, addPosition, NULL, 4) != -1, "daMapInPlaceParallel should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daMapInPlaceParallel should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daMapInPlaceParallel should change all elements with any number of threads");
+    sput_run_test(testMap);
+
+    sput_enter_suite("daMapInPlaceParallel should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,123 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static void testMean(void)
+{
+    int err;
+    int values[] = { 4, -8, 15, 16, 23, 42, 2147483647, 2147483647 };
+    double mean;
+    DaStruct *da;
+
+    da = createFrom(values, sizeof(values) / sizeof(values[0]), sizeof(int), sizeof(values) / sizeof(values[0]), sizeof(values) / sizeof(values[0]));
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daMean(da, &err, DA_KEY_S32, 0, 0, 5, &mean) != 0, "daMean should succeed");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+    sput_fail_if(mean != 92.0 / 6.0, "daMean should return the mean of the range");
+
+    sput_fail_if(daMean(da, &err, DA_KEY_S32, 0, 2, 2, &mean) != 0 || mean != 15.0, "daMean of a single element should be the element");
+
+    /* The sum exceeds the field type */
+    sput_fail_if(daMean(da, &err, DA_KEY_S32, 0, 6, 7, &mean) != 0 || mean != 2147483647.0, "daMean should not overflow");
+
+    daDestroy(da, &err);
+}
+
+static void testFloat(void)
+{
+    int err;
+    size_t i;
+    float value;
+    double mean;
+    DaDesc desc;
+    DaStruct *da;
+
+    desc.elements = 4;
+    desc.bytesPerElement = sizeof(float);
+    desc.maxBytes = 4 * sizeof(float);
+    da = daCreate(&desc, &err);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (i = 0; da && i < 4; i++)
+    {
+        value = (float)i - 0.5f;
+        daAppend(da, &err, &value);
+    }
+
+    sput_fail_if(daMean(da, &err, DA_KEY_F32, 0, 0, 3, &mean) != 0 || mean != 1.0, "daMean should average floating point numbers");
+
+    daDestroy(da, &err);
+}
+
+static void testNull(void)
+{
+    int err;
+    double mean;
+    DaStruct da;
+
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daMean(&da, &err, DA_KEY_S32, 0, 0, 0, NULL)   != -1, "daMean(&da, &err, DA_KEY_S32, 0, 0, 0, NULL)   != -1");
+    sput_fail_if(daMean(&da, NULL, DA_KEY_S32, 0, 0, 0, &mean)  != -1, "daMean(&da, NULL, DA_KEY_S32, 0, 0, 0, &mean)  != -1");
+    sput_fail_if(daMean(NULL, &err, DA_KEY_S32, 0, 0, 0, &mean) != -1, "daMean(NULL, &err, DA_KEY_S32, 0, 0, 0, &mean) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testInvalid(void)
+{
+    int err;
+    int values[] = { 1, 2, 3 };
+    double mean;
+    DaStruct *da;
+
+    da = createFrom(values, 3, sizeof(int), 3, 3);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daMean(da, &err, DA_KEY_S32, 0, 2, 1, &mean) != -1, "daMean should fail if from is greater than to");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daMean(da, &err, DA_KEY_S32, 0, 0, 3, &mean) != -1, "daMean should fail if to is behind the last element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daMean(da, &err, DA_KEY_UNSIGNED | 5, 0, 0, 2, &mean) != -1, "daMean should fail for an unknown field width");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_UNKNOWN_MODE), "err != (DA_PARAM_ERR | DA_UNKNOWN_MODE)");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    double mean;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daMean(&da, &err, DA_KEY_U8, 0, 0, 0, &mean) != -1, "daMean should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daMean should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daMean should fail for an invalid range or field");
+    sput_run_test(testInvalid);
+
+    sput_enter_suite("daMean should return the mean of a range of integers");
+    sput_run_test(testMean);
+
+    sput_enter_suite("daMean should return the mean of a range of floating point numbers");
+    sput_run_test(testFloat);
+
+    sput_enter_suite("daMean should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,110 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+#define ELEMENTS (1024 * 1024)
+
+static DaStruct *createLarge(void)
+{
+    int err;
+    size_t i;
+    unsigned int value;
+    DaStruct *da;
+
+    da = createArray(sizeof(value), ELEMENTS, ELEMENTS);
+
+    for (i = 0; da && i < ELEMENTS; i++)
+    {
+        value = 4000000000U - (unsigned int)i;
+        daAppend(da, &err, &value);
+    }
+
+    return da;
+}
+
+static void testLarge(void)
+{
+    int err;
+    size_t threads;
+    double mean;
+    DaStruct *da;
+
+    da = createLarge();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (threads = 1; da && threads <= 8; threads *= 2)
+    {
+        sput_fail_if(daMeanParallel(da, &err, DA_KEY_U32, 0, 0, ELEMENTS - 1, &mean, threads) != 0, "daMeanParallel should succeed");
+        sput_fail_if(err != DA_OK, "err != DA_OK");
+        sput_fail_if(mean != 4000000000.0 - (ELEMENTS - 1) / 2.0, "daMeanParallel should return the mean of the whole array");
+
+        sput_fail_if(daMeanParallel(da, &err, DA_KEY_U32, 0, 1, 3, &mean, threads) != 0 || mean != 3999999998.0, "daMeanParallel should return the mean of a small range");
+    }
+
+    daDestroy(da, &err);
+}
+
+static void testNull(void)
+{
+    int err;
+    double mean;
+    DaStruct da;
+
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daMeanParallel(&da, &err, DA_KEY_S32, 0, 0, 0, NULL, 4)   != -1, "daMeanParallel(&da, &err, DA_KEY_S32, 0, 0, 0, NULL, 4)   != -1");
+    sput_fail_if(daMeanParallel(&da, NULL, DA_KEY_S32, 0, 0, 0, &mean, 4)  != -1, "daMeanParallel(&da, NULL, DA_KEY_S32, 0, 0, 0, &mean, 4)  != -1");
+    sput_fail_if(daMeanParallel(NULL, &err, DA_KEY_S32, 0, 0, 0, &mean, 4) != -1, "daMeanParallel(NULL, &err, DA_KEY_S32, 0, 0, 0, &mean, 4) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testInvalid(void)
+{
+    int err;
+    double mean;
+    DaStruct *da;
+
+    da = createLarge();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daMeanParallel(da, &err, DA_KEY_U32, 0, 0, ELEMENTS, &mean, 4) != -1, "daMeanParallel should fail if to is behind the last element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daMeanParallel(da, &err, DA_KEY_U32, 1, 0, 9, &mean, 4) != -1, "daMeanParallel should fail if the field exceeds the element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    double mean;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daMeanParallel(&da, &err, DA_KEY_U8, 0, 0, 0, &mean, 4) != -1, "daMeanParallel should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daMeanParallel should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daMeanParallel should fail for an invalid range or field");
+    sput_run_test(testInvalid);
+
+    sput_enter_suite("daMeanParallel should return the mean for any number of threads");
+    sput_run_test(testLarge);
+
+    sput_enter_suite("daMeanParallel should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,191 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static int compareInt(const void *a, const void *b)
+{
+    int x;
+    int y;
+
+    x = *(const int *)a;
+    y = *(const int *)b;
+
+    return (x > y) - (x < y);
+}
+
+/* Checks that the array holds exactly the n values */
+static int holds(DaStruct *da, const int *values, size_t n)
+{
+    int err;
+    size_t i;
+
+    for (i = 0; i < n && i < da->used; i++)
+    {
+        if (*(int *)daGet(da, &err, i) != values[i])
+        {
+            return 0;
+        }
+    }
+
+    return da->used == n;
+}
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daMerge(&da,  &err, &da,  &da,  NULL)       != -1, "daMerge(&da,  &err, &da,  &da,  NULL)       != -1");
+    sput_fail_if(daMerge(&da,  &err, &da,  NULL, compareInt) != -1, "daMerge(&da,  &err, &da,  NULL, compareInt) != -1");
+    sput_fail_if(daMerge(&da,  &err, NULL, &da,  compareInt) != -1, "daMerge(&da,  &err, NULL, &da,  compareInt) != -1");
+    sput_fail_if(daMerge(&da,  NULL, &da,  &da,  compareInt) != -1, "daMerge(&da,  NULL, &da,  &da,  compareInt) != -1");
+    sput_fail_if(daMerge(NULL, &err, &da,  &da,  compareInt) != -1, "daMerge(NULL, &err, &da,  &da,  compareInt) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testBasic(void)
+{
+    static const int valuesA[] = { 1, 3, 5, 7, 9, 11 };
+    static const int valuesB[] = { 2, 3, 4, 9, 10, 20, 30 };
+    static const int expected[] = { 1, 2, 3, 3, 4, 5, 7, 9, 9, 10, 11, 20, 30 };
+    int err;
+    DaStruct *a;
+    DaStruct *b;
+    DaStruct *dst;
+
+    a = createFrom(valuesA, 6, sizeof(int), 1, 100);
+    b = createFrom(valuesB, 7, sizeof(int), 1, 100);
+    dst = createFrom(valuesB, 3, sizeof(int), 1, 100);
+    sput_fail_if(!a || !b || !dst, "Unable to create dynamic arrays.");
+
+    sput_fail_if(daMerge(dst, &err, a, b, compareInt) != 0 || err != DA_OK, "daMerge should succeed");
+    sput_fail_if(!holds(dst, expected, sizeof(expected) / sizeof(expected[0])), "daMerge should store all elements of both arrays in order");
+
+    daDestroy(a, &err);
+    daDestroy(b, &err);
+    daDestroy(dst, &err);
+}
+
+static void testDuplicates(void)
+{
+    static const int valuesA[] = { 1, 1, 1, 2, 4, 4 };
+    static const int valuesB[] = { 1, 2, 2, 4 };
+    static const int expected[] = { 1, 1, 1, 1, 2, 2, 2, 4, 4, 4 };
+    int err;
+    DaStruct *a;
+    DaStruct *b;
+    DaStruct *dst;
+
+    a = createFrom(valuesA, 6, sizeof(int), 1, 100);
+    b = createFrom(valuesB, 4, sizeof(int), 1, 100);
+    dst = createArray(sizeof(int), 1, 100);
+    sput_fail_if(!a || !b || !dst, "Unable to create dynamic arrays.");
+
+    sput_fail_if(daMerge(dst, &err, a, b, compareInt) != 0, "daMerge should succeed");
+    sput_fail_if(!holds(dst, expected, sizeof(expected) / sizeof(expected[0])), "daMerge should match every element once");
+
+    daDestroy(b, &err);
+    b = createArray(sizeof(int), 1, 100);
+    sput_fail_if(daMerge(dst, &err, a, b, compareInt) != 0, "daMerge should accept an empty array");
+
+    daDestroy(a, &err);
+    daDestroy(b, &err);
+    daDestroy(dst, &err);
+}
+
+static void testGallop(void)
+{
+    int err;
+    int failed;
+    size_t i;
+    DaStruct *a;
+    DaStruct *b;
+    DaStruct *dst;
+
+    /* A few multiples of 1000 against all multiples of 3 */
+    a = createMultiples(1000, 30, 1, 61);
+    b = createMultiples(3, 10000, 1, 20001);
+    dst = createArray(sizeof(int), 1, 20000);
+    sput_fail_if(!a || !b || !dst, "Unable to create dynamic arrays.");
+
+    sput_fail_if(daMerge(dst, &err, a, b, compareInt) != 0, "daMerge should succeed");
+
+    for (i = 1, failed = 0; i < dst->used; i++)
+    {
+        failed |= *(int *)daGet(dst, &err, i - 1) > *(int *)daGet(dst, &err, i);
+    }
+
+    failed |= dst->used != 10030;
+    sput_fail_if(failed, "daMerge should keep the order and all elements");
+
+    daDestroy(a, &err);
+    daDestroy(b, &err);
+    daDestroy(dst, &err);
+}
+
+static void testIncompatible(void)
+{
+    int err;
+    DaDesc desc;
+    DaStruct *a;
+    DaStruct *b;
+
+    a = createArray(sizeof(int), 1, 10);
+    desc.elements = 1;
+    desc.bytesPerElement = sizeof(double);
+    desc.maxBytes = 10 * sizeof(double);
+    b = daCreate(&desc, &err);
+    sput_fail_if(!a || !b, "Unable to create dynamic arrays.");
+
+    sput_fail_if(daMerge(a, &err, a, a, compareInt) != -1, "daMerge should fail if the destination is a source");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_INCOMPATIBLE), "err != (DA_PARAM_ERR | DA_INCOMPATIBLE)");
+
+    sput_fail_if(daMerge(b, &err, a, a, compareInt) != -1, "daMerge should fail if the element sizes differ");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_INCOMPATIBLE), "err != (DA_PARAM_ERR | DA_INCOMPATIBLE)");
+
+    daDestroy(a, &err);
+    daDestroy(b, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+    DaStruct *a;
+
+    a = createArray(sizeof(int), 1, 10);
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daMerge(&da, &err, a, a, compareInt) != -1, "daMerge should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+
+    daDestroy(a, &err);
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daMerge should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daMerge should store all elements of both arrays in order");
+    sput_run_test(testBasic);
+
+    sput_enter_suite("daMerge should handle duplicates and empty arrays");
+    sput_run_test(testDuplicates);
+
+    sput_enter_suite("daMerge should handle arrays of very different sizes");
+    sput_run_test(testGallop);
+
+    sput_enter_suite("daMerge should fail for incompatible arrays");
+    sput_run_test(testIncompatible);
+
+    sput_enter_suite("daMerge should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,207 @@
+#include "sput.h"
+#include "dynar.h"
+
+#define RECORD 16
+#define OFFSET 4
+
+/**
+ * Stores VALUES at offset OFFSET of records and checks the function on every range against the
+ * first smallest value found by a plain loop.
+ */
+#define CHECK_TYPE(T, TYPE, VALUES) \
+    do \
+    { \
+        size_t n; \
+        size_t i; \
+        size_t from; \
+        size_t to; \
+        size_t best; \
+        size_t index; \
+        T value; \
+        char record[RECORD]; \
+        DaDesc desc; \
+        DaStruct *da; \
+        \
+        n = sizeof(VALUES) / sizeof(T); \
+        desc.elements = n; \
+        desc.bytesPerElement = RECORD; \
+        desc.maxBytes = 1024 * RECORD; \
+        da = daCreate(&desc, &err); \
+        sput_fail_if(da == NULL, "Unable to create dynamic array."); \
+        \
+        for (i = 0; da && i < n; i++) \
+        { \
+            memset(record, 0xab, RECORD); \
+            memcpy(record + OFFSET, &VALUES[i], sizeof(T)); \
+            daAppend(da, &err, record); \
+        } \
+        \
+        for (from = 0; da && from < n; from++) \
+        { \
+            for (to = from; to < n; to++) \
+            { \
+                for (i = from + 1, best = from; i <= to; i++) \
+                { \
+                    best = (VALUES[i] < VALUES[best]) ? i : best; \
+                } \
+                \
+                value = 0; \
+                index = DA_NPOS; \
+                sput_fail_if(daMin(da, &err, TYPE, OFFSET, from, to, &value, &index) != 0 || err != DA_OK, "daMin should succeed for a " #TYPE " field"); \
+                sput_fail_if(index != best || value != VALUES[best], "daMin returned the wrong result for a " #TYPE " field"); \
+            } \
+        } \
+        \
+        daDestroy(da, &err); \
+    } \
+    while (0)
+
+static void testTypes(void)
+{
+    int err;
+    unsigned char u8[] = { 7, 200, 0, 255, 0, 128, 255, 1 };
+    signed char s8[] = { 3, -128, 127, -1, -128, 0, 127, -5 };
+    unsigned short u16[] = { 256, 65535, 0, 40000, 0, 65535, 255 };
+    short s16[] = { 0, -32768, 32767, -300, -32768, 256, 32767, -1 };
+    unsigned int u32[] = { 65536, 4294967295U, 0, 3000000000U, 0, 4294967295U, 1 };
+    int s32[] = { 70000, -2147483647 - 1, 2147483647, -1, -2147483647 - 1, 0, 2147483647 };
+    unsigned long ul[] = { 65536, 4294967295UL, 0, 1, 0, 4294967295UL };
+    long sl[] = { -256, 2147483647L, -2147483647L - 1, 0, 2147483647L, -2147483647L - 1 };
+    float f32[] = { 0.25f, -1e30f, 3e20f, -0.5f, -1e30f, 0.0f, 3e20f, -2.5f };
+    double f64[] = { 0.125, 1e300, -1e300, -2.5, 1e300, 0.0, -1e300, 1.0 };
+
+    CHECK_TYPE(unsigned char, DA_KEY_U8, u8);
+    CHECK_TYPE(signed char, DA_KEY_S8, s8);
+    CHECK_TYPE(unsigned short, DA_KEY_U16, u16);
+    CHECK_TYPE(short, DA_KEY_S16, s16);
+    CHECK_TYPE(unsigned int, DA_KEY_U32, u32);
+    CHECK_TYPE(int, DA_KEY_S32, s32);
+    CHECK_TYPE(float, DA_KEY_F32, f32);
+    CHECK_TYPE(double, DA_KEY_F64, f64);
+
+    if (sizeof(long) == 8)
+    {
+        CHECK_TYPE(unsigned long, DA_KEY_U64, ul);
+        CHECK_TYPE(long, DA_KEY_S64, sl);
+    }
+}
+
+static void testOptional(void)
+{
+    int err;
+    int i;
+    int value;
+    size_t index;
+    DaDesc desc;
+    DaStruct *da;
+
+    desc.elements = 10;
+    desc.bytesPerElement = sizeof(int);
+    desc.maxBytes = 10 * sizeof(int);
+    da = daCreate(&desc, &err);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (i = 0; da && i < 10; i++)
+    {
+        value = (i * 7) % 10;
+        daAppend(da, &err, &value);
+    }
+
+    value = -1;
+    sput_fail_if(daMin(da, &err, DA_KEY_S32, 0, 0, 9, &value, NULL) != 0 || value != 0, "daMin should only return the value");
+
+    index = DA_NPOS;
+    sput_fail_if(daMin(da, &err, DA_KEY_S32, 0, 0, 9, NULL, &index) != 0 || index != 0, "daMin should only return the index");
+
+    daDestroy(da, &err);
+}
+
+static void testNull(void)
+{
+    int err;
+    int value;
+    size_t index;
+    DaStruct da;
+
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daMin(&da, &err, DA_KEY_S32, 0, 0, 0, NULL, NULL)    != -1, "daMin(&da, &err, DA_KEY_S32, 0, 0, 0, NULL, NULL)    != -1");
+    sput_fail_if(daMin(&da, NULL, DA_KEY_S32, 0, 0, 0, &value, &index) != -1, "daMin(&da, NULL, DA_KEY_S32, 0, 0, 0, &value, &index) != -1");
+    sput_fail_if(daMin(NULL, &err, DA_KEY_S32, 0, 0, 0, &value, &index) != -1, "daMin(NULL, &err, DA_KEY_S32, 0, 0, 0, &value, &index) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testInvalid(void)
+{
+    int err;
+    int value;
+    size_t i;
+    char record[RECORD];
+    DaDesc desc;
+    DaStruct *da;
+
+    desc.elements = 10;
+    desc.bytesPerElement = RECORD;
+    desc.maxBytes = 1024 * RECORD;
+    da = daCreate(&desc, &err);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daMin(da, &err, DA_KEY_S32, 0, 0, 0, &value, NULL) != -1, "daMin should fail for an empty array");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    memset(record, 0, RECORD);
+    for (i = 0; da && i < 10; i++)
+    {
+        daAppend(da, &err, record);
+    }
+
+    sput_fail_if(daMin(da, &err, DA_KEY_S32, 0, 5, 4, &value, NULL) != -1, "daMin should fail if from is greater than to");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daMin(da, &err, DA_KEY_S32, 0, 0, 10, &value, NULL) != -1, "daMin should fail if to is behind the last element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daMin(da, &err, DA_KEY_SIGNED | 3, 0, 0, 9, &value, NULL) != -1, "daMin should fail for an unknown field width");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_UNKNOWN_MODE), "err != (DA_PARAM_ERR | DA_UNKNOWN_MODE)");
+
+    sput_fail_if(daMin(da, &err, DA_KEY_S32, RECORD - 2, 0, 9, &value, NULL) != -1, "daMin should fail if the field exceeds the element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    size_t ignore = 0;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daMin(&da, &err, DA_KEY_U8, 0, 0, 0, &ignore, &ignore) != -1, "daMin should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daMin should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daMin should fail for an invalid range or field");
+    sput_run_test(testInvalid);
+
+    sput_enter_suite("daMin should return the first smallest value of every range for all field types");
+    sput_run_test(testTypes);
+
+    sput_enter_suite("daMin should accept a NULL pointer for either the value or the index");
+    sput_run_test(testOptional);
+
+    sput_enter_suite("daMin should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,152 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+#define ELEMENTS (1024 * 1024)
+
+/* Fills a large array with pseudo random values, the smallest value occurs several times */
+static DaStruct *createLarge(void)
+{
+    int err;
+    size_t i;
+    unsigned long state;
+    int value;
+    DaStruct *da;
+
+    da = createArray(sizeof(value), ELEMENTS, ELEMENTS);
+
+    for (i = 0, state = 1; da && i < ELEMENTS; i++)
+    {
+        state = (state * 1103515245UL + 12345UL) & 0x7fffffffUL;
+        value = (int)(state % 2000001UL) - 1000000;
+        daAppend(da, &err, &value);
+    }
+
+    return da;
+}
+
+static void testLarge(void)
+{
+    int err;
+    int value;
+    int expectedValue;
+    size_t threads;
+    size_t index;
+    size_t expected;
+    size_t from;
+    DaStruct *da;
+
+    da = createLarge();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (from = 0; da && from < ELEMENTS; from += ELEMENTS / 4 + 1)
+    {
+        sput_fail_if(daMin(da, &err, DA_KEY_S32, 0, from, ELEMENTS - 1, &expectedValue, &expected) != 0, "daMin should succeed");
+
+        for (threads = 1; threads <= 8; threads *= 2)
+        {
+            value = 0;
+            index = DA_NPOS;
+            sput_fail_if(daMinParallel(da, &err, DA_KEY_S32, 0, from, ELEMENTS - 1, &value, &index, threads) != 0, "daMinParallel should succeed");
+            sput_fail_if(err != DA_OK, "err != DA_OK");
+            sput_fail_if(index != expected || value != expectedValue, "daMinParallel should return the same result as daMin");
+        }
+    }
+
+    daDestroy(da, &err);
+}
+
+static void testTies(void)
+{
+    int err;
+    int value;
+    size_t threads;
+    size_t index;
+    DaStruct *da;
+
+    da = createLarge();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    /* Equal smallest values in different blocks */
+    value = -2000000;
+    daSet(da, &err, &value, ELEMENTS - 10);
+    daSet(da, &err, &value, ELEMENTS / 2);
+    daSet(da, &err, &value, 1000);
+
+    for (threads = 2; da && threads <= 8; threads *= 2)
+    {
+        sput_fail_if(daMinParallel(da, &err, DA_KEY_S32, 0, 0, ELEMENTS - 1, NULL, &index, threads) != 0, "daMinParallel should succeed");
+        sput_fail_if(index != 1000, "daMinParallel should return the first of equal values");
+    }
+
+    daDestroy(da, &err);
+}
+
+static void testNull(void)
+{
+    int err;
+    int value;
+    size_t index;
+    DaStruct da;
+
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daMinParallel(&da, &err, DA_KEY_S32, 0, 0, 0, NULL, NULL, 4)    != -1, "daMinParallel(&da, &err, DA_KEY_S32, 0, 0, 0, NULL, NULL, 4)    != -1");
+    sput_fail_if(daMinParallel(&da, NULL, DA_KEY_S32, 0, 0, 0, &value, &index, 4) != -1, "daMinParallel(&da, NULL, DA_KEY_S32, 0, 0, 0, &value, &index, 4) != -1");
+    sput_fail_if(daMinParallel(NULL, &err, DA_KEY_S32, 0, 0, 0, &value, &index, 4) != -1, "daMinParallel(NULL, &err, DA_KEY_S32, 0, 0, 0, &value, &index, 4) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testInvalid(void)
+{
+    int err;
+    int value;
+    DaStruct *da;
+
+    da = createLarge();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daMinParallel(da, &err, DA_KEY_S32, 0, 0, ELEMENTS, &value, NULL, 4) != -1, "daMinParallel should fail if to is behind the last element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daMinParallel(da, &err, DA_KEY_S64, 0, 0, 9, &value, NULL, 4) != -1, "daMinParallel should fail if the field exceeds the element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    size_t ignore = 0;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daMinParallel(&da, &err, DA_KEY_U8, 0, 0, 0, &ignore, &ignore, 4) != -1, "daMinParallel should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daMinParallel should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daMinParallel should fail for an invalid range or field");
+    sput_run_test(testInvalid);
+
+    sput_enter_suite("daMinParallel should return the same result as daMin for any number of threads");
+    sput_run_test(testLarge);
+
+    sput_enter_suite("daMinParallel should return the first of equal smallest values across blocks");
+    sput_run_test(testTies);
+
+    sput_enter_suite("daMinParallel should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
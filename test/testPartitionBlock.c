@@ -0,0 +1,172 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+/* Condition of the tests: the element is a multiple of the int pointed to by ctx, the arrays hold 1, 2, 3, ... */
+static void multiple(const void *elements, size_t n, unsigned char *results, void *ctx)
+{
+    const int *values;
+    int divisor;
+    size_t i;
+
+    values = elements;
+    divisor = *(const int *)ctx;
+
+    for (i = 0; i < n; i++)
+    {
+        results[i] = (unsigned char)(values[i] % divisor == 0);
+    }
+}
+
+static void testNull(void)
+{
+    int err;
+    size_t split;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daPartitionBlock(&da,  &err, NULL, NULL, &split)     != -1, "daPartitionBlock(&da,  &err, NULL, NULL, &split)     != -1");
+    sput_fail_if(daPartitionBlock(&da,  NULL, multiple, NULL, &split) != -1, "daPartitionBlock(&da,  NULL, multiple, NULL, &split) != -1");
+    sput_fail_if(daPartitionBlock(NULL, &err, multiple, NULL, &split) != -1, "daPartitionBlock(NULL, &err, multiple, NULL, &split) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testPartition(void)
+{
+    int err;
+    int divisor;
+    int failed;
+    int *element;
+    size_t elements;
+    size_t split;
+    size_t expected;
+    size_t i;
+    int sum;
+    DaStruct *da;
+
+    /* Element counts within and across the predicate blocks */
+    for (elements = 1, failed = 0; elements < 20000; elements = elements * 3 + 1)
+    {
+        for (divisor = 1; divisor <= 7; divisor += 2)
+        {
+            da = createInts(1, elements, elements, elements);
+            sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+            split = (size_t)-1;
+            failed |= daPartitionBlock(da, &err, multiple, &divisor, &split) != 0 || err != DA_OK;
+
+            for (i = 0, expected = 0; i < elements; i++)
+            {
+                expected += (i + 1) % (size_t)divisor == 0;
+            }
+
+            failed |= split != expected || da->used != elements;
+
+            /* The elements are split correctly and none gets lost */
+            for (i = 0, sum = 0; i < da->used; i++)
+            {
+                element = daGet(da, &err, i);
+                failed |= (*element % divisor == 0) != (i < split);
+                sum += *element;
+            }
+
+            failed |= sum != (int)(elements * (elements + 1) / 2);
+
+            daDestroy(da, &err);
+        }
+    }
+
+    sput_fail_if(failed, "daPartitionBlock should move the matching elements to the front");
+}
+
+static void testAllOrNone(void)
+{
+    int err;
+    int divisor;
+    size_t split;
+    DaStruct *da;
+
+    da = createInts(1, 1000, 1000, 1000);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    divisor = 1;
+    sput_fail_if(daPartitionBlock(da, &err, multiple, &divisor, &split) != 0 || split != 1000, "daPartitionBlock should return the end if all elements match");
+
+    divisor = 1001;
+    sput_fail_if(daPartitionBlock(da, &err, multiple, &divisor, &split) != 0 || split != 0, "daPartitionBlock should return 0 if no element matches");
+
+    sput_fail_if(daPartitionBlock(da, &err, multiple, &divisor, NULL) != 0 || da->used != 1000, "daPartitionBlock should accept a NULL split");
+
+    sput_fail_if(daClear(da, &err, DA_FAST) != 0, "daClear should succeed");
+    sput_fail_if(daPartitionBlock(da, &err, multiple, &divisor, &split) != 0 || split != 0, "daPartitionBlock should accept an empty array");
+
+    daDestroy(da, &err);
+}
+
+static void testSidecars(void)
+{
+    int err;
+    int divisor;
+    int value;
+    int *element;
+    size_t index;
+    DaStruct *da;
+
+    da = createInts(1, 1000, 1000, 1000);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024 * 1024) != 0, "daBloomAttach should succeed");
+
+    divisor = 3;
+    daPartitionBlock(da, &err, multiple, &divisor, NULL);
+
+    value = 501;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1, "daIndexOf should find a moved element");
+    element = daGet(da, &err, index);
+    sput_fail_if(element == NULL || *element != 501, "daIndexOf should return the new position of a moved element");
+
+    value = 1000;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1, "daIndexOf should find a moved element");
+    element = daGet(da, &err, index);
+    sput_fail_if(element == NULL || *element != 1000, "daIndexOf should return the new position of a moved element");
+
+    value = 1001;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 0, "daIndexOf shouldn't find a missing element");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daPartitionBlock(&da, &err, multiple, NULL, NULL) != -1, "daPartitionBlock should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daPartitionBlock should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daPartitionBlock should partition the array");
+    sput_run_test(testPartition);
+
+    sput_enter_suite("daPartitionBlock should handle arrays where no or all elements match");
+    sput_run_test(testAllOrNone);
+
+    sput_enter_suite("daPartitionBlock should keep lookups through the index and the filter correct");
+    sput_run_test(testSidecars);
+
+    sput_enter_suite("daPartitionBlock should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
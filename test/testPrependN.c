@@ -0,0 +1,92 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static void testNull(void)
+{
+    int err;
+    int ignore = 0;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daPrependN(NULL, NULL, &ignore, 1) != NULL, "daPrependN(NULL, NULL, &ignore, 1) != NULL");
+    sput_fail_if(daPrependN(&da,  NULL, &ignore, 1) != NULL, "daPrependN(da,   NULL, &ignore, 1) != NULL");
+
+    sput_fail_if(daPrependN(&da,  &err, NULL, 1)    != NULL, "daPrependN(da,   &err, NULL, 1)    != NULL");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+
+    sput_fail_if(daPrependN(NULL, &err, &ignore, 1) != NULL, "daPrependN(NULL, &err, &ignore, 1) != NULL");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testPrepend(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createArray(1, 2, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daPrependN(da, &err, "45", 2) != da->firstAddr, "daPrependN should return the address of the first element");
+    sput_fail_if(err != DA_OK, "err != DA_OK");
+    sput_fail_if(da->used != 2 || memcmp(da->firstAddr, "45", 2) != 0, "daPrependN should fill an empty array");
+
+    sput_fail_if(daPrependN(da, &err, "0123", 4) != da->firstAddr, "daPrependN should return the address of the first element");
+    sput_fail_if(da->used != 6 || memcmp(da->firstAddr, "012345", 6) != 0, "daPrependN should keep the order of the prepended elements");
+    sput_fail_if(da->max != 8, "daPrependN should double the capacity until the elements fit");
+
+    sput_fail_if(daPrependN(da, &err, (char *)da->firstAddr + 4, 2) == NULL, "daPrependN should prepend elements of the array itself");
+    sput_fail_if(da->used != 8 || memcmp(da->firstAddr, "45012345", 8) != 0, "daPrependN should copy the elements before they move");
+
+    daDestroy(da, &err);
+}
+
+static void testBytesLimit(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createArray(1, 2, 4);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    daPrependN(da, &err, "23", 2);
+
+    sput_fail_if(daPrependN(da, &err, "abc", 3) != NULL, "daPrependN should fail if the elements exceed the bytes limit");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT), "err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT)");
+    sput_fail_if(da->used != 2 || memcmp(da->firstAddr, "23", 2) != 0, "daPrependN shouldn't prepend any element if it fails");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int ignore = 0;
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daPrependN(&da, &err, &ignore, 1) != NULL, "daPrependN should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daPrependN should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daPrependN should prepend all elements in their order");
+    sput_run_test(testPrepend);
+
+    sput_enter_suite("daPrependN should prepend all elements or none");
+    sput_run_test(testBytesLimit);
+
+    sput_enter_suite("daPrependN should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
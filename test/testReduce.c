@@ -0,0 +1,97 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+/* Sums up the elements and checks that the blocks arrive in order */
+typedef struct
+{
+    size_t next;
+    unsigned long sum;
+    int ordered;
+} Acc;
+
+static void sumUp(const void *elements, size_t n, size_t pos, void *acc, void *ctx)
+{
+    const int *values = elements;
+    Acc *a = acc;
+    size_t i;
+
+    (void)ctx;
+
+    a->ordered &= pos == a->next;
+    a->next = pos + n;
+
+    for (i = 0; i < n; i++)
+    {
+        a->sum += (unsigned long)values[i];
+    }
+}
+
+static void testNull(void)
+{
+    int err;
+    Acc acc;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daReduce(&da,  &err, sumUp, NULL, NULL) != -1, "daReduce(&da,  &err, sumUp, NULL, NULL) != -1");
+    sput_fail_if(daReduce(&da,  &err, NULL,  &acc, NULL) != -1, "daReduce(&da,  &err, NULL,  &acc, NULL) != -1");
+    sput_fail_if(daReduce(&da,  NULL, sumUp, &acc, NULL) != -1, "daReduce(&da,  NULL, sumUp, &acc, NULL) != -1");
+    sput_fail_if(daReduce(NULL, &err, sumUp, &acc, NULL) != -1, "daReduce(NULL, &err, sumUp, &acc, NULL) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testReduce(void)
+{
+    static const size_t sizes[] = { 0, 1, 1000, 200000 };
+    int err;
+    size_t s;
+    Acc acc;
+    DaStruct *da;
+
+    for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        da = createInts(0, sizes[s], sizes[s] + 1, sizes[s] + 1);
+        sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+        acc.next = 0;
+        acc.sum = 0;
+        acc.ordered = 1;
+
+        sput_fail_if(daReduce(da, &err, sumUp, &acc, NULL) != 0 || err != DA_OK, "daReduce should succeed");
+        sput_fail_if(acc.next != sizes[s] || !acc.ordered, "daReduce should fold the blocks in order");
+        sput_fail_if(acc.sum != (unsigned long)sizes[s] * (sizes[s] - (sizes[s] > 0)) / 2, "daReduce should fold all elements");
+
+        daDestroy(da, &err);
+    }
+}
+
+static void testMagic(void)
+{
+    int err;
+    Acc acc;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daReduce(&da, &err, sumUp, &acc, NULL) != -1, "daReduce should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daReduce should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daReduce should fold all elements");
+    sput_run_test(testReduce);
+
+    sput_enter_suite("daReduce should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,133 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+#define ELEMENTS (1024 * 1024)
+
+/* The covered range [begin, end) makes the combination associative but not commutative */
+typedef struct
+{
+    size_t begin;
+    size_t end;
+    unsigned long sum;
+    int ordered;
+} Acc;
+
+static void sumUp(const void *elements, size_t n, size_t pos, void *acc, void *ctx)
+{
+    const int *values = elements;
+    Acc *a = acc;
+    size_t i;
+
+    (void)ctx;
+
+    if (a->begin == a->end)
+    {
+        a->begin = pos;
+    }
+
+    a->ordered &= pos == a->end || a->begin == pos;
+    a->end = pos + n;
+
+    for (i = 0; i < n; i++)
+    {
+        a->sum += (unsigned long)values[i];
+    }
+}
+
+static void combine(void *acc, const void *part, void *ctx)
+{
+    Acc *a = acc;
+    const Acc *p = part;
+
+    (void)ctx;
+
+    if (p->begin == p->end)
+    {
+        return;
+    }
+
+    if (a->begin == a->end)
+    {
+        *a = *p;
+        return;
+    }
+
+    a->ordered &= p->ordered && a->end == p->begin;
+    a->end = p->end;
+    a->sum += p->sum;
+}
+
+static void testNull(void)
+{
+    int err;
+    Acc acc;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daReduceParallel(&da,  &err, sumUp, combine, &acc, 0,           NULL, 4) != -1, "daReduceParallel(&da,  &err, sumUp, combine, &acc, 0,           NULL, 4) != -1");
+    sput_fail_if(daReduceParallel(&da,  &err, sumUp, combine, NULL, sizeof(acc), NULL, 4) != -1, "daReduceParallel(&da,  &err, sumUp, combine, NULL, sizeof(acc), NULL, 4) != -1");
+    sput_fail_if(daReduceParallel(&da,  &err, sumUp, NULL,    &acc, sizeof(acc), NULL, 4) != -1, "daReduceParallel(&da,  &err, sumUp, NULL,    &acc, sizeof(acc), NULL, 4) != -1");
+    sput_fail_if(daReduceParallel(&da,  &err, NULL,  combine, &acc, sizeof(acc), NULL, 4) != -1, "daReduceParallel(&da,  &err, NULL,  combine, &acc, sizeof(acc), NULL, 4) != -1");
+    sput_fail_if(daReduceParallel(&da,  NULL, sumUp, combine, &acc, sizeof(acc), NULL, 4) != -1, "daReduceParallel(&da,  NULL, sumUp, combine, &acc, sizeof(acc), NULL, 4) != -1");
+    sput_fail_if(daReduceParallel(NULL, &err, sumUp, combine, &acc, sizeof(acc), NULL, 4) != -1, "daReduceParallel(NULL, &err, sumUp, combine, &acc, sizeof(acc), NULL, 4) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testReduce(void)
+{
+    static const size_t sizes[] = { 0, 1000, ELEMENTS };
+    int err;
+    size_t s;
+    size_t threads;
+    Acc acc;
+    DaStruct *da;
+
+    for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        da = createInts(0, sizes[s], sizes[s] + 1, sizes[s] + 1);
+        sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+        for (threads = 1; threads <= 8; threads *= 2)
+        {
+            memset(&acc, 0, sizeof(acc));
+            acc.ordered = 1;
+
+            sput_fail_if(daReduceParallel(da, &err, sumUp, combine, &acc, sizeof(acc), NULL, threads) != 0 || err != DA_OK, "daReduceParallel should succeed");
+            sput_fail_if(acc.begin != 0 || acc.end != sizes[s] || !acc.ordered, "daReduceParallel should combine the blocks in order");
+            sput_fail_if(acc.sum != (unsigned long)sizes[s] * (sizes[s] - (sizes[s] > 0)) / 2, "daReduceParallel should fold all elements");
+        }
+
+        daDestroy(da, &err);
+    }
+}
+
+static void testMagic(void)
+{
+    int err;
+    Acc acc;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daReduceParallel(&da, &err, sumUp, combine, &acc, sizeof(acc), NULL, 4) != -1, "daReduceParallel should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daReduceParallel should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daReduceParallel should fold all elements with any number of threads");
+    sput_run_test(testReduce);
+
+    sput_enter_suite("daReduceParallel should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
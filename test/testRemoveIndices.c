@@ -0,0 +1,204 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+/* Checks that the array holds 0 ... n - 1 without the elements flagged in removed */
+static int holdsKept(DaStruct *da, const unsigned char *removed, int n)
+{
+    int err;
+    int i;
+    size_t pos;
+    int *element;
+
+    for (i = 0, pos = 0; i < n; i++)
+    {
+        if (removed[i])
+        {
+            continue;
+        }
+
+        element = daGet(da, &err, pos++);
+
+        if (!element || *element != i)
+        {
+            return 0;
+        }
+    }
+
+    return pos == da->used;
+}
+
+static void testNull(void)
+{
+    int err;
+    size_t indices[1];
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    indices[0] = 0;
+
+    sput_fail_if(daRemoveIndices(&da,  &err, NULL, 1)    != -1, "daRemoveIndices(&da,  &err, NULL, 1)    != -1");
+    sput_fail_if(daRemoveIndices(&da,  NULL, indices, 1) != -1, "daRemoveIndices(&da,  NULL, indices, 1) != -1");
+    sput_fail_if(daRemoveIndices(NULL, &err, indices, 1) != -1, "daRemoveIndices(NULL, &err, indices, 1) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testSorted(void)
+{
+    int err;
+    size_t indices[4];
+    unsigned char removed[20];
+    DaStruct *da;
+
+    da = createInts(0, 20, 20, 20);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    indices[0] = 0;
+    indices[1] = 5;
+    indices[2] = 6;
+    indices[3] = 19;
+    memset(removed, 0, sizeof(removed));
+    removed[0] = removed[5] = removed[6] = removed[19] = 1;
+
+    sput_fail_if(daRemoveIndices(da, &err, indices, 4) != 0 || err != DA_OK, "daRemoveIndices should succeed");
+    sput_fail_if(da->used != 16 || !holdsKept(da, removed, 20), "daRemoveIndices should remove the elements and keep the order of the others");
+
+    daDestroy(da, &err);
+}
+
+static void testUnsorted(void)
+{
+    int err;
+    int failed;
+    size_t indices[64];
+    size_t k;
+    size_t i;
+    unsigned char removed[500];
+    DaStruct *da;
+
+    for (k = 1, failed = 0; k <= 64; k *= 2)
+    {
+        da = createInts(0, 500, 500, 500);
+        sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+        memset(removed, 0, sizeof(removed));
+
+        /* Descending positions with some duplicates */
+        for (i = 0; i < k; i++)
+        {
+            indices[i] = 499 - i * 7;
+        }
+
+        if (k > 2)
+        {
+            indices[k - 1] = indices[0];
+        }
+
+        for (i = 0; i < k; i++)
+        {
+            removed[indices[i]] = 1;
+        }
+
+        failed |= daRemoveIndices(da, &err, indices, k) != 0 || err != DA_OK;
+        failed |= !holdsKept(da, removed, 500);
+
+        daDestroy(da, &err);
+    }
+
+    sput_fail_if(failed, "daRemoveIndices should sort the positions and remove duplicates only once");
+}
+
+static void testOutOfBounds(void)
+{
+    int err;
+    size_t indices[3];
+    unsigned char removed[10];
+    DaStruct *da;
+
+    da = createInts(0, 10, 10, 10);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    indices[0] = 1;
+    indices[1] = 10;
+    indices[2] = 2;
+    memset(removed, 0, sizeof(removed));
+
+    sput_fail_if(daRemoveIndices(da, &err, indices, 3) != -1, "daRemoveIndices should fail if an index is out of bounds");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+    sput_fail_if(!holdsKept(da, removed, 10), "daRemoveIndices shouldn't change the array in the event of an error");
+
+    sput_fail_if(daRemoveIndices(da, &err, indices, 0) != 0 || da->used != 10, "daRemoveIndices should accept an empty list of positions");
+
+    daDestroy(da, &err);
+}
+
+static void testSidecars(void)
+{
+    int err;
+    int value;
+    size_t indices[2];
+    size_t index;
+    DaStruct *da;
+
+    da = createInts(0, 100, 100, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024 * 1024) != 0, "daBloomAttach should succeed");
+
+    indices[0] = 50;
+    indices[1] = 10;
+    daRemoveIndices(da, &err, indices, 2);
+
+    value = 60;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 58, "daIndexOf should find a kept element at its new position");
+
+    value = 50;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 0, "daIndexOf shouldn't find a removed element");
+
+    /* The old tail of the array holds stale copies of the last elements */
+    value = 99;
+    sput_fail_if(daLastIndexOf(da, &err, &value, &index) != 1 || index != 97, "daLastIndexOf should find the last element at its new position");
+    sput_fail_if(daSize(da, &err) != 98, "daRemoveIndices should shrink the array");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    size_t indices[1];
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+    indices[0] = 0;
+
+    sput_fail_if(daRemoveIndices(&da, &err, indices, 1) != -1, "daRemoveIndices should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daRemoveIndices should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daRemoveIndices should remove sorted positions in a stable way");
+    sput_run_test(testSorted);
+
+    sput_enter_suite("daRemoveIndices should remove unsorted positions and duplicates");
+    sput_run_test(testUnsorted);
+
+    sput_enter_suite("daRemoveIndices should fail without changes if a position is out of bounds");
+    sput_run_test(testOutOfBounds);
+
+    sput_enter_suite("daRemoveIndices should keep lookups through the index and the filter correct");
+    sput_run_test(testSidecars);
+
+    sput_enter_suite("daRemoveIndices should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
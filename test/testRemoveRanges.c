@@ -0,0 +1,182 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+/* Checks that the array holds 0 ... n - 1 without the elements flagged in removed */
+static int holdsKept(DaStruct *da, const unsigned char *removed, int n)
+{
+    int err;
+    int i;
+    size_t pos;
+    int *element;
+
+    for (i = 0, pos = 0; i < n; i++)
+    {
+        if (removed[i])
+        {
+            continue;
+        }
+
+        element = daGet(da, &err, pos++);
+
+        if (!element || *element != i)
+        {
+            return 0;
+        }
+    }
+
+    return pos == da->used;
+}
+
+static void flag(unsigned char *removed, const DaRange *ranges, size_t k)
+{
+    size_t i;
+    size_t j;
+
+    for (j = 0; j < k; j++)
+    {
+        for (i = ranges[j].from; i <= ranges[j].to; i++)
+        {
+            removed[i] = 1;
+        }
+    }
+}
+
+static void testNull(void)
+{
+    int err;
+    DaRange ranges[1];
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    ranges[0].from = 0;
+    ranges[0].to = 0;
+
+    sput_fail_if(daRemoveRanges(&da,  &err, NULL, 1)   != -1, "daRemoveRanges(&da,  &err, NULL, 1)   != -1");
+    sput_fail_if(daRemoveRanges(&da,  NULL, ranges, 1) != -1, "daRemoveRanges(&da,  NULL, ranges, 1) != -1");
+    sput_fail_if(daRemoveRanges(NULL, &err, ranges, 1) != -1, "daRemoveRanges(NULL, &err, ranges, 1) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testSorted(void)
+{
+    int err;
+    DaRange ranges[3];
+    unsigned char removed[30];
+    DaStruct *da;
+
+    da = createInts(0, 30, 30, 30);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    ranges[0].from = 0;
+    ranges[0].to = 2;
+    ranges[1].from = 10;
+    ranges[1].to = 10;
+    ranges[2].from = 20;
+    ranges[2].to = 29;
+    memset(removed, 0, sizeof(removed));
+    flag(removed, ranges, 3);
+
+    sput_fail_if(daRemoveRanges(da, &err, ranges, 3) != 0 || err != DA_OK, "daRemoveRanges should succeed");
+    sput_fail_if(da->used != 16 || !holdsKept(da, removed, 30), "daRemoveRanges should remove the ranges and keep the order of the others");
+
+    daDestroy(da, &err);
+}
+
+static void testUnsortedOverlapping(void)
+{
+    int err;
+    DaRange ranges[5];
+    unsigned char removed[50];
+    DaStruct *da;
+
+    da = createInts(0, 50, 50, 50);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    /* Unsorted, overlapping, nested and touching ranges */
+    ranges[0].from = 30;
+    ranges[0].to = 35;
+    ranges[1].from = 5;
+    ranges[1].to = 15;
+    ranges[2].from = 8;
+    ranges[2].to = 9;
+    ranges[3].from = 12;
+    ranges[3].to = 20;
+    ranges[4].from = 36;
+    ranges[4].to = 36;
+    memset(removed, 0, sizeof(removed));
+    flag(removed, ranges, 5);
+
+    sput_fail_if(daRemoveRanges(da, &err, ranges, 5) != 0 || err != DA_OK, "daRemoveRanges should succeed");
+    sput_fail_if(da->used != 27 || !holdsKept(da, removed, 50), "daRemoveRanges should merge overlapping ranges");
+
+    daDestroy(da, &err);
+}
+
+static void testOutOfBounds(void)
+{
+    int err;
+    DaRange ranges[2];
+    unsigned char removed[10];
+    DaStruct *da;
+
+    da = createInts(0, 10, 10, 10);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    memset(removed, 0, sizeof(removed));
+    ranges[0].from = 1;
+    ranges[0].to = 2;
+    ranges[1].from = 5;
+    ranges[1].to = 10;
+
+    sput_fail_if(daRemoveRanges(da, &err, ranges, 2) != -1, "daRemoveRanges should fail if a range is out of bounds");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+    sput_fail_if(!holdsKept(da, removed, 10), "daRemoveRanges shouldn't change the array in the event of an error");
+
+    ranges[1].from = 6;
+    ranges[1].to = 5;
+    sput_fail_if(daRemoveRanges(da, &err, ranges, 2) != -1, "daRemoveRanges should fail if from is greater than to");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daRemoveRanges(da, &err, ranges, 0) != 0 || da->used != 10, "daRemoveRanges should accept an empty list of ranges");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaRange ranges[1];
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+    ranges[0].from = 0;
+    ranges[0].to = 0;
+
+    sput_fail_if(daRemoveRanges(&da, &err, ranges, 1) != -1, "daRemoveRanges should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daRemoveRanges should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daRemoveRanges should remove sorted ranges in a stable way");
+    sput_run_test(testSorted);
+
+    sput_enter_suite("daRemoveRanges should remove unsorted and overlapping ranges");
+    sput_run_test(testUnsortedOverlapping);
+
+    sput_enter_suite("daRemoveRanges should fail without changes if a range is out of bounds");
+    sput_run_test(testOutOfBounds);
+
+    sput_enter_suite("daRemoveRanges should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
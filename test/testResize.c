@@ -0,0 +1,147 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daResize(&da,  NULL, 1, NULL) != -1, "daResize(&da,  NULL, 1, NULL) != -1");
+    sput_fail_if(daResize(NULL, &err, 1, NULL) != -1, "daResize(NULL, &err, 1, NULL) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testGrow(void)
+{
+    int err;
+    int failed;
+    int element;
+    size_t i;
+    DaStruct *da;
+
+    da = createInts(0, 4, 4, 1000);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    element = -1;
+    sput_fail_if(daResize(da, &err, 500, &element) != 0 || err != DA_OK || da->used != 500, "daResize should grow the array");
+
+    for (i = 0, failed = 0; i < 500; i++)
+    {
+        failed |= *(int *)daGet(da, &err, i) != (i < 4 ? (int)i : -1);
+    }
+
+    sput_fail_if(failed, "daResize should keep the elements and fill the new ones");
+
+    sput_fail_if(daResize(da, &err, 600, NULL) != 0 || *(int *)daGet(da, &err, 599) != 0, "daResize should fill with zero bytes without an element");
+    sput_fail_if(daResize(da, &err, 700, daGet(da, &err, 2)) != 0 || *(int *)daGet(da, &err, 699) != 2, "daResize should accept an element of the array");
+
+    daDestroy(da, &err);
+}
+
+static void testShrink(void)
+{
+    int err;
+    int value;
+    size_t index;
+    DaStruct *da;
+
+    da = createInts(0, 100, 100, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+
+    sput_fail_if(daResize(da, &err, 10, NULL) != 0 || da->used != 10, "daResize should shrink the array");
+
+    value = 50;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 0, "daIndexOf shouldn't find a removed element");
+
+    value = 9;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 9, "daIndexOf should find a kept element");
+
+    daDestroy(da, &err);
+}
+
+static void testSidecars(void)
+{
+    int err;
+    int value;
+    size_t index;
+    DaStruct *da;
+    DaBloomStats stats;
+
+    da = createInts(0, 100, 100, 200);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024 * 1024) != 0, "daBloomAttach should succeed");
+
+    value = 777;
+    sput_fail_if(daResize(da, &err, 150, &value) != 0 || da->used != 150, "daResize should grow the array");
+
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 100, "daIndexOf should find the first new element");
+    sput_fail_if(daLastIndexOf(da, &err, &value, &index) != 1 || index != 149, "daLastIndexOf should find the last new element");
+
+    value = 99;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 99, "daIndexOf should find an old element");
+
+    /* The new elements get added to the filter instead of rebuilding it */
+    daBloomStats(da, &err, &stats);
+    sput_fail_if(stats.rebuilds != 0 || stats.elements != 150, "daResize should add the new elements to the filter");
+
+    daDestroy(da, &err);
+}
+
+static void testLimit(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createInts(0, 10, 10, 20);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daResize(da, &err, 21, NULL) != -1, "daResize should fail if the limit would be exceeded");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT), "err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT)");
+    sput_fail_if(da->used != 10, "daResize shouldn't change the array in the event of an error");
+
+    sput_fail_if(daResize(da, &err, 20, NULL) != 0 || da->used != 20, "daResize should grow up to the limit");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daResize(&da, &err, 1, NULL) != -1, "daResize should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daResize should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daResize should grow the array and fill the new elements");
+    sput_run_test(testGrow);
+
+    sput_enter_suite("daResize should shrink the array");
+    sput_run_test(testShrink);
+
+    sput_enter_suite("daResize should keep lookups through the index and the filter correct");
+    sput_run_test(testSidecars);
+
+    sput_enter_suite("daResize should respect the bytes limit");
+    sput_run_test(testLimit);
+
+    sput_enter_suite("daResize should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,153 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+/* Condition of the tests: the element is a multiple of the int pointed to by ctx, the arrays hold 1, 2, 3, ... */
+static int multiple(const void *element, void *ctx)
+{
+    return *(const int *)element % *(const int *)ctx == 0;
+}
+
+static void testNull(void)
+{
+    int err;
+    size_t removed;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daRetainIf(&da,  &err, NULL, NULL, &removed)     != -1, "daRetainIf(&da,  &err, NULL, NULL, &removed)     != -1");
+    sput_fail_if(daRetainIf(&da,  NULL, multiple, NULL, &removed) != -1, "daRetainIf(&da,  NULL, multiple, NULL, &removed) != -1");
+    sput_fail_if(daRetainIf(NULL, &err, multiple, NULL, &removed) != -1, "daRetainIf(NULL, &err, multiple, NULL, &removed) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testCompact(void)
+{
+    int err;
+    int divisor;
+    int failed;
+    int *element;
+    size_t elements;
+    size_t removed;
+    size_t expected;
+    size_t i;
+    int next;
+    DaStruct *da;
+
+    /* Element counts within and across the predicate blocks */
+    for (elements = 1, failed = 0; elements < 2000; elements = elements * 3 + 1)
+    {
+        for (divisor = 1; divisor <= 7; divisor += 2)
+        {
+            da = createInts(1, elements, elements, elements);
+            sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+            removed = (size_t)-1;
+            failed |= daRetainIf(da, &err, multiple, &divisor, &removed) != 0 || err != DA_OK;
+
+            for (i = 0, expected = 0; i < elements; i++)
+            {
+                expected += ((i + 1) % (size_t)divisor == 0) == 0;
+            }
+
+            failed |= removed != expected || da->used != elements - expected;
+
+            /* The kept elements stay in their order */
+            for (i = 0, next = 1; i < da->used; i++, next++)
+            {
+                while ((next % divisor == 0) == 0)
+                {
+                    next++;
+                }
+
+                element = daGet(da, &err, i);
+                failed |= *element != next;
+            }
+
+            daDestroy(da, &err);
+        }
+    }
+
+    sput_fail_if(failed, "daRetainIf should remove the other elements and keep the order of the others");
+}
+
+static void testAllOrNone(void)
+{
+    int err;
+    int divisor;
+    size_t removed;
+    DaStruct *da;
+
+    da = createInts(1, 1000, 1000, 1000);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    divisor = 1;
+    sput_fail_if(daRetainIf(da, &err, multiple, &divisor, &removed) != 0 || removed != 0 || da->used != 1000, "daRetainIf shouldn't remove any element if none matches");
+
+    divisor = 1001;
+    sput_fail_if(daRetainIf(da, &err, multiple, &divisor, NULL) != 0 || da->used != 0, "daRetainIf should remove all elements if all match");
+
+    sput_fail_if(daRetainIf(da, &err, multiple, &divisor, &removed) != 0 || removed != 0, "daRetainIf should accept an empty array");
+
+    daDestroy(da, &err);
+}
+
+static void testSidecars(void)
+{
+    int err;
+    int divisor;
+    int value;
+    size_t index;
+    DaStruct *da;
+
+    da = createInts(1, 1000, 1000, 1000);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024 * 1024) != 0, "daBloomAttach should succeed");
+
+    divisor = 2;
+    daRetainIf(da, &err, multiple, &divisor, NULL);
+
+    value = 500;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 249, "daIndexOf should find a kept element at its new position");
+
+    value = 501;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 0, "daIndexOf shouldn't find a removed element");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daRetainIf(&da, &err, multiple, NULL, NULL) != -1, "daRetainIf should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daRetainIf should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daRetainIf should compact the array in a stable way");
+    sput_run_test(testCompact);
+
+    sput_enter_suite("daRetainIf should handle arrays where no or all elements match");
+    sput_run_test(testAllOrNone);
+
+    sput_enter_suite("daRetainIf should keep lookups through the index and the filter correct");
+    sput_run_test(testSidecars);
+
+    sput_enter_suite("daRetainIf should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
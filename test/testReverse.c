@@ -0,0 +1,121 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+/* Creates an array of n elements whose first byte holds the position */
+static DaStruct *createPattern(size_t elements, size_t bytesPerElement)
+{
+    int err;
+    size_t i;
+    unsigned char element[16];
+    DaStruct *da;
+
+    da = createArray(bytesPerElement, elements, elements);
+
+    for (i = 0; da && i < elements; i++)
+    {
+        memset(element, (int)i, sizeof(element));
+        daAppend(da, &err, element);
+    }
+
+    return da;
+}
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daReverse(&da,  NULL, 0, 1) != -1, "daReverse(&da,  NULL, 0, 1) != -1");
+    sput_fail_if(daReverse(NULL, &err, 0, 1) != -1, "daReverse(NULL, &err, 0, 1) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testReverse(void)
+{
+    static const size_t sizes[] = { 1, 3, sizeof(int), sizeof(long), 16 };
+    int err;
+    int failed;
+    size_t s;
+    size_t i;
+    size_t from;
+    size_t to;
+    size_t expected;
+    unsigned char *element;
+    DaStruct *da;
+
+    for (s = 0, failed = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        for (from = 0; from < 5; from++)
+        {
+            for (to = from; to < 12; to++)
+            {
+                da = createPattern(12, sizes[s]);
+                sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+                failed |= daReverse(da, &err, from, to) != 0 || err != DA_OK;
+
+                for (i = 0; i < 12; i++)
+                {
+                    expected = (i < from || i > to) ? i : from + to - i;
+                    element = daGet(da, &err, i);
+                    failed |= element[0] != expected || element[sizes[s] - 1] != expected;
+                }
+
+                daDestroy(da, &err);
+            }
+        }
+    }
+
+    sput_fail_if(failed, "daReverse should reverse the range of elements of any size");
+}
+
+static void testOutOfBounds(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createPattern(10, sizeof(int));
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daReverse(da, &err, 0, 10) != -1, "daReverse should fail if to is out of bounds");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daReverse(da, &err, 5, 4) != -1, "daReverse should fail if from is greater than to");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daReverse(&da, &err, 0, 1) != -1, "daReverse should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daReverse should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daReverse should reverse a range of elements");
+    sput_run_test(testReverse);
+
+    sput_enter_suite("daReverse should fail if the range is out of bounds");
+    sput_run_test(testOutOfBounds);
+
+    sput_enter_suite("daReverse should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
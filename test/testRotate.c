@@ -0,0 +1,147 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+/* Creates an array of n elements whose bytes hold the position */
+static DaStruct *createPattern(size_t elements, size_t bytesPerElement)
+{
+    int err;
+    size_t i;
+    unsigned char element[16];
+    DaStruct *da;
+
+    da = createArray(bytesPerElement, elements, elements);
+
+    for (i = 0; da && i < elements; i++)
+    {
+        memset(element, (int)i, sizeof(element));
+        daAppend(da, &err, element);
+    }
+
+    return da;
+}
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daRotate(&da,  NULL, 0, 1, 1) != -1, "daRotate(&da,  NULL, 0, 1, 1) != -1");
+    sput_fail_if(daRotate(NULL, &err, 0, 1, 1) != -1, "daRotate(NULL, &err, 0, 1, 1) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testRotate(void)
+{
+    static const size_t sizes[] = { 1, 3, sizeof(long), 16 };
+    int err;
+    int failed;
+    size_t s;
+    size_t i;
+    size_t k;
+    size_t from;
+    size_t to;
+    size_t expected;
+    unsigned char *element;
+    DaStruct *da;
+
+    for (s = 0, failed = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        for (from = 0; from < 3; from++)
+        {
+            for (to = from; to < 20; to++)
+            {
+                for (k = 0; k < 25; k++)
+                {
+                    da = createPattern(20, sizes[s]);
+                    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+                    failed |= daRotate(da, &err, from, to, k) != 0 || err != DA_OK;
+
+                    for (i = 0; i < 20; i++)
+                    {
+                        expected = (i < from || i > to) ? i : from + (i - from + k) % (to - from + 1);
+                        element = daGet(da, &err, i);
+                        failed |= element[0] != expected || element[sizes[s] - 1] != expected;
+                    }
+
+                    daDestroy(da, &err);
+                }
+            }
+        }
+    }
+
+    sput_fail_if(failed, "daRotate should rotate the range by any number of positions");
+}
+
+static void testOutOfBounds(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createPattern(10, sizeof(int));
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daRotate(da, &err, 0, 10, 1) != -1, "daRotate should fail if to is out of bounds");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daRotate(da, &err, 5, 4, 1) != -1, "daRotate should fail if from is greater than to");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testIndex(void)
+{
+    int err;
+    unsigned char element[sizeof(int)];
+    size_t index;
+    DaStruct *da;
+
+    da = createPattern(100, sizeof(int));
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+
+    daRotate(da, &err, 0, 99, 30);
+
+    memset(element, 30, sizeof(element));
+    sput_fail_if(daIndexOf(da, &err, element, &index) != 1 || index != 0, "daIndexOf should find the element at its new position");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daRotate(&da, &err, 0, 1, 1) != -1, "daRotate should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daRotate should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daRotate should rotate a range of elements");
+    sput_run_test(testRotate);
+
+    sput_enter_suite("daRotate should fail if the range is out of bounds");
+    sput_run_test(testOutOfBounds);
+
+    sput_enter_suite("daRotate should keep lookups through the index correct");
+    sput_run_test(testIndex);
+
+    sput_enter_suite("daRotate should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,164 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static void testNull(void)
+{
+    int err;
+    int src[2];
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daSetRange(&da,  &err, 0, NULL, 2) != NULL, "daSetRange(&da,  &err, 0, NULL, 2) != NULL");
+    sput_fail_if(daSetRange(&da,  NULL, 0, src, 2)  != NULL, "daSetRange(&da,  NULL, 0, src, 2)  != NULL");
+    sput_fail_if(daSetRange(NULL, &err, 0, src, 2)  != NULL, "daSetRange(NULL, &err, 0, src, 2)  != NULL");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testSetRange(void)
+{
+    static const int src[] = { 100, 101, 102 };
+    static const int expected[] = { 0, 1, 100, 101, 102, 5, 6, 7 };
+    int err;
+    int failed;
+    size_t i;
+    DaStruct *da;
+
+    da = createInts(0, 8, 8, 8);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daSetRange(da, &err, 2, src, 3) != daGet(da, &err, 2), "daSetRange should return the first updated element");
+
+    for (i = 0, failed = 0; i < 8; i++)
+    {
+        failed |= *(int *)daGet(da, &err, i) != expected[i];
+    }
+
+    sput_fail_if(failed || da->used != 8, "daSetRange should replace the elements");
+
+    sput_fail_if(daSetRange(da, &err, 6, src, 3) != NULL, "daSetRange should fail if the range exceeds the array");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+    sput_fail_if(*(int *)daGet(da, &err, 6) != 6, "daSetRange shouldn't change the array in the event of an error");
+
+    daDestroy(da, &err);
+}
+
+static void testOverlap(void)
+{
+    static const int expected[] = { 0, 1, 0, 1, 2, 3, 6, 7 };
+    int err;
+    int failed;
+    size_t i;
+    DaStruct *da;
+
+    da = createInts(0, 8, 8, 8);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    daSetRange(da, &err, 2, daGet(da, &err, 0), 4);
+
+    for (i = 0, failed = 0; i < 8; i++)
+    {
+        failed |= *(int *)daGet(da, &err, i) != expected[i];
+    }
+
+    sput_fail_if(failed, "daSetRange should accept elements of the array itself");
+
+    daDestroy(da, &err);
+}
+
+static void testSidecars(void)
+{
+    static const int src[] = { 500, 501 };
+    int err;
+    int value;
+    size_t index;
+    DaStruct *da;
+
+    da = createInts(0, 100, 100, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024 * 1024) != 0, "daBloomAttach should succeed");
+
+    daSetRange(da, &err, 40, src, 2);
+
+    value = 501;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 41, "daIndexOf should find a new element");
+
+    value = 40;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 0, "daIndexOf shouldn't find a replaced element");
+
+    value = 42;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 42, "daIndexOf should find an unchanged element");
+
+    daDestroy(da, &err);
+}
+
+static void testStaleFilter(void)
+{
+    static const int src[] = { 10, 11, 12 };
+    int err;
+    int value;
+    int failed;
+    size_t i;
+    DaStruct *da;
+
+    da = createInts(0, 4, 4, 4);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024 * 1024) != 0, "daBloomAttach should succeed");
+
+    /* The stale elements make the filter rebuild in the middle of the range */
+    value = 7;
+    daSet(da, &err, &value, 3);
+    value = 8;
+    daSet(da, &err, &value, 3);
+
+    sput_fail_if(daSetRange(da, &err, 0, src, 3) == NULL, "daSetRange should succeed");
+
+    for (i = 0, failed = 0; i < 3; i++)
+    {
+        failed |= daContains(da, &err, &src[i]) != 1;
+    }
+
+    sput_fail_if(failed, "daContains should find every written element");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    int src[1];
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daSetRange(&da, &err, 0, src, 1) != NULL, "daSetRange should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daSetRange should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daSetRange should replace a range of elements");
+    sput_run_test(testSetRange);
+
+    sput_enter_suite("daSetRange should accept overlapping elements");
+    sput_run_test(testOverlap);
+
+    sput_enter_suite("daSetRange should keep lookups through the index and the filter correct");
+    sput_run_test(testSidecars);
+
+    sput_enter_suite("daSetRange should keep the filter correct if it gets rebuilt on the way");
+    sput_run_test(testStaleFilter);
+
+    sput_enter_suite("daSetRange should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,149 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static int compareInt(const void *a, const void *b)
+{
+    int x;
+    int y;
+
+    x = *(const int *)a;
+    y = *(const int *)b;
+
+    return (x > y) - (x < y);
+}
+
+/* Creates an array of n ints, mode 0: random, 1: ascending, 2: descending, 3: few distinct values */
+static DaStruct *createInput(size_t elements, int mode)
+{
+    int err;
+    int value;
+    size_t i;
+    DaStruct *da;
+
+    da = createArray(sizeof(int), elements + 1, elements + 1);
+
+    srand(1);
+    for (i = 0; da && i < elements; i++)
+    {
+        value = mode == 0 ? rand() - RAND_MAX / 2 : mode == 1 ? (int)i : mode == 2 ? -(int)i : rand() % 3;
+        daAppend(da, &err, &value);
+    }
+
+    return da;
+}
+
+/* Checks that the array is sorted and holds the same values as a freshly created one */
+static int isSortedPermutation(DaStruct *da, int mode)
+{
+    int err;
+    int ok;
+    int *element;
+    long sum;
+    long expected;
+    size_t i;
+    DaStruct *original;
+
+    original = createInput(da->used, mode);
+
+    for (i = 0, ok = original != NULL, sum = 0, expected = 0; ok && i < da->used; i++)
+    {
+        element = daGet(da, &err, i);
+        sum += *element;
+        expected += *(int *)daGet(original, &err, i);
+        ok = i == 0 || element[-1] <= element[0];
+    }
+
+    daDestroy(original, &err);
+
+    return ok && sum == expected;
+}
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daSort(&da,  &err, NULL)       != -1, "daSort(&da,  &err, NULL)       != -1");
+    sput_fail_if(daSort(&da,  NULL, compareInt) != -1, "daSort(&da,  NULL, compareInt) != -1");
+    sput_fail_if(daSort(NULL, &err, compareInt) != -1, "daSort(NULL, &err, compareInt) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testSort(void)
+{
+    int err;
+    int mode;
+    int failed;
+    size_t elements;
+    DaStruct *da;
+
+    for (elements = 0, failed = 0; elements < 50000; elements = elements * 4 + 1)
+    {
+        for (mode = 0; mode < 4; mode++)
+        {
+            da = createInput(elements, mode);
+            sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+            failed |= daSort(da, &err, compareInt) != 0 || err != DA_OK;
+            failed |= !isSortedPermutation(da, mode);
+
+            daDestroy(da, &err);
+        }
+    }
+
+    sput_fail_if(failed, "daSort should sort random, sorted, reversed and duplicate values");
+}
+
+static void testSidecars(void)
+{
+    int err;
+    int value;
+    size_t index;
+    DaStruct *da;
+
+    da = createInput(1000, 2);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+
+    value = -999;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 999, "daIndexOf should find the element before the sort");
+
+    daSort(da, &err, compareInt);
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 0, "daIndexOf should find the element at its sorted position");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daSort(&da, &err, compareInt) != -1, "daSort should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daSort should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daSort should sort the array");
+    sput_run_test(testSort);
+
+    sput_enter_suite("daSort should keep lookups through the index correct");
+    sput_run_test(testSidecars);
+
+    sput_enter_suite("daSort should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
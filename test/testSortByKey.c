@@ -0,0 +1,224 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+#include <stddef.h>
+
+typedef struct
+{
+    size_t seq;
+    char pad[12];
+    unsigned int key;
+    char payload[36];
+} Record;
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daSortByKey(&da,  NULL, DA_KEY_S32, 0) != -1, "daSortByKey(&da,  NULL, DA_KEY_S32, 0) != -1");
+    sput_fail_if(daSortByKey(NULL, &err, DA_KEY_S32, 0) != -1, "daSortByKey(NULL, &err, DA_KEY_S32, 0) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testInvalid(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createArray(sizeof(int), 10, 11);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daSortByKey(da, &err, DA_KEY_FLOAT | 2, 0) != -1, "daSortByKey should fail for an unknown type");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_UNKNOWN_MODE), "err != (DA_PARAM_ERR | DA_UNKNOWN_MODE)");
+
+    sput_fail_if(daSortByKey(da, &err, DA_KEY_U16, sizeof(int) - 1) != -1, "daSortByKey should fail if the key exceeds the element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daSortByKey(da, &err, DA_KEY_S32, 0) != 0 || err != DA_OK, "daSortByKey should accept an empty array");
+
+    daDestroy(da, &err);
+}
+
+static void testSigned(void)
+{
+    int err;
+    int failed;
+    int value;
+    int *element;
+    long sum;
+    long expected;
+    size_t i;
+    DaStruct *da;
+
+    da = createArray(sizeof(int), 10000, 10001);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    srand(3);
+    for (i = 0, expected = 0; i < 10000; i++)
+    {
+        value = i == 0 ? -2147483647 - 1 : i == 1 ? 2147483647 : rand() - RAND_MAX / 2;
+        expected += value;
+        daAppend(da, &err, &value);
+    }
+
+    sput_fail_if(daSortByKey(da, &err, DA_KEY_S32, 0) != 0 || err != DA_OK, "daSortByKey should succeed");
+
+    for (i = 0, failed = 0, sum = 0; i < da->used; i++)
+    {
+        element = daGet(da, &err, i);
+        sum += *element;
+        failed |= i > 0 && element[-1] > element[0];
+    }
+
+    sput_fail_if(failed || sum != expected, "daSortByKey should sort signed integers");
+
+    daDestroy(da, &err);
+}
+
+static void testUnsigned(void)
+{
+    int err;
+    int failed;
+    unsigned char value;
+    unsigned char *element;
+    size_t i;
+    DaStruct *da;
+
+    da = createArray(1, 1000, 1001);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (i = 0; i < 1000; i++)
+    {
+        value = (unsigned char)(255 - (i * 7) % 256);
+        daAppend(da, &err, &value);
+    }
+
+    sput_fail_if(daSortByKey(da, &err, DA_KEY_U8, 0) != 0 || err != DA_OK, "daSortByKey should succeed");
+
+    for (i = 1, failed = 0; i < da->used; i++)
+    {
+        element = daGet(da, &err, i);
+        failed |= element[-1] > element[0];
+    }
+
+    sput_fail_if(failed, "daSortByKey should sort unsigned integers");
+
+    daDestroy(da, &err);
+}
+
+static void testFloat(void)
+{
+    int err;
+    int failed;
+    double value;
+    double *element;
+    size_t i;
+    DaStruct *da;
+
+    da = createArray(sizeof(double), 5000, 5001);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    srand(4);
+    for (i = 0; i < 5000; i++)
+    {
+        value = ((double)rand() - RAND_MAX / 2) / 1000.0;
+        value = i % 100 == 0 ? 0.0 : i % 101 == 0 ? -1e300 : value;
+        daAppend(da, &err, &value);
+    }
+
+    sput_fail_if(daSortByKey(da, &err, DA_KEY_F64, 0) != 0 || err != DA_OK, "daSortByKey should succeed");
+
+    for (i = 1, failed = 0; i < da->used; i++)
+    {
+        element = daGet(da, &err, i);
+        failed |= element[-1] > element[0];
+    }
+
+    sput_fail_if(failed, "daSortByKey should sort floating point numbers");
+
+    daDestroy(da, &err);
+}
+
+static void testIndirect(void)
+{
+    int err;
+    int failed;
+    size_t i;
+    size_t seqs;
+    Record record;
+    Record *element;
+    DaStruct *da;
+
+    sput_fail_if(sizeof(Record) <= DA_SORT_INDIRECT, "The records should be sorted indirectly");
+
+    da = createArray(sizeof(Record), 20000, 20001);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    srand(5);
+    memset(&record, 0, sizeof(record));
+    for (i = 0; i < 20000; i++)
+    {
+        record.seq = i;
+        record.key = (unsigned int)(rand() % 300) * 70000u;
+        record.payload[0] = (char)record.key;
+        daAppend(da, &err, &record);
+    }
+
+    sput_fail_if(daSortByKey(da, &err, DA_KEY_U32, offsetof(Record, key)) != 0 || err != DA_OK, "daSortByKey should succeed");
+
+    for (i = 0, failed = 0, seqs = 0; i < da->used; i++)
+    {
+        element = daGet(da, &err, i);
+        seqs += element->seq;
+        failed |= element->payload[0] != (char)element->key;
+        failed |= i > 0 && (element[-1].key > element->key || (element[-1].key == element->key && element[-1].seq > element->seq));
+    }
+
+    sput_fail_if(failed || seqs != (size_t)20000 * 19999 / 2, "daSortByKey should sort large records in a stable way");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daSortByKey(&da, &err, DA_KEY_S32, 0) != -1, "daSortByKey should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daSortByKey should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daSortByKey should fail for an invalid key field");
+    sput_run_test(testInvalid);
+
+    sput_enter_suite("daSortByKey should sort signed integer keys");
+    sput_run_test(testSigned);
+
+    sput_enter_suite("daSortByKey should sort unsigned integer keys");
+    sput_run_test(testUnsigned);
+
+    sput_enter_suite("daSortByKey should sort floating point keys");
+    sput_run_test(testFloat);
+
+    sput_enter_suite("daSortByKey should sort large records indirectly and stable");
+    sput_run_test(testIndirect);
+
+    sput_enter_suite("daSortByKey should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,141 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static int compareInt(const void *a, const void *b)
+{
+    int x;
+    int y;
+
+    x = *(const int *)a;
+    y = *(const int *)b;
+
+    return (x > y) - (x < y);
+}
+
+/* Creates an array of pseudo random ints, maxBytes leaves room for extra more elements */
+static DaStruct *createRandom(size_t elements, size_t extra, int distinct)
+{
+    int err;
+    int value;
+    size_t i;
+    DaStruct *da;
+
+    da = createArray(sizeof(int), elements, elements + extra);
+
+    srand(6);
+    for (i = 0; da && i < elements; i++)
+    {
+        value = rand() % distinct - distinct / 2;
+        daAppend(da, &err, &value);
+    }
+
+    return da;
+}
+
+/* Checks the order and that the values are the ones created */
+static int isSortedPermutation(DaStruct *da, int distinct)
+{
+    int err;
+    int ok;
+    int *element;
+    long sum;
+    long expected;
+    size_t i;
+
+    srand(6);
+    for (i = 0, ok = 1, sum = 0, expected = 0; ok && i < da->used; i++)
+    {
+        element = daGet(da, &err, i);
+        sum += *element;
+        expected += rand() % distinct - distinct / 2;
+        ok = i == 0 || element[-1] <= element[0];
+    }
+
+    return ok && sum == expected;
+}
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daSortParallel(&da,  &err, NULL, 2)       != -1, "daSortParallel(&da,  &err, NULL, 2)       != -1");
+    sput_fail_if(daSortParallel(&da,  NULL, compareInt, 2) != -1, "daSortParallel(&da,  NULL, compareInt, 2) != -1");
+    sput_fail_if(daSortParallel(NULL, &err, compareInt, 2) != -1, "daSortParallel(NULL, &err, compareInt, 2) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testThreads(void)
+{
+    int err;
+    int failed;
+    size_t threads;
+    DaStruct *da;
+
+    for (threads = 0, failed = 0; threads <= 9; threads += 3)
+    {
+        da = createRandom(DA_PARALLEL_THRESHOLD / sizeof(int) * 2 + 7, DA_PARALLEL_THRESHOLD, 1000000);
+        sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+        failed |= daSortParallel(da, &err, compareInt, threads) != 0 || err != DA_OK;
+        failed |= !isSortedPermutation(da, 1000000);
+
+        daDestroy(da, &err);
+    }
+
+    sput_fail_if(failed, "daSortParallel should sort the array with any number of threads");
+
+    da = createRandom(1000, 0, 1000000);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daSortParallel(da, &err, compareInt, 4) != 0 || !isSortedPermutation(da, 1000000), "daSortParallel should sort small arrays");
+    daDestroy(da, &err);
+}
+
+static void testInPlace(void)
+{
+    int err;
+    DaStruct *da;
+
+    /* No room for the scratch buffer within maxBytes */
+    da = createRandom(DA_PARALLEL_THRESHOLD / sizeof(int) + 5, 0, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daSortParallel(da, &err, compareInt, 5) != 0 || err != DA_OK, "daSortParallel should succeed without scratch memory");
+    sput_fail_if(!isSortedPermutation(da, 100), "daSortParallel should merge in place if the scratch buffer exceeds maxBytes");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daSortParallel(&da, &err, compareInt, 2) != -1, "daSortParallel should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daSortParallel should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daSortParallel should sort the array in parallel");
+    sput_run_test(testThreads);
+
+    sput_enter_suite("daSortParallel should keep the scratch memory within maxBytes");
+    sput_run_test(testInPlace);
+
+    sput_enter_suite("daSortParallel should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
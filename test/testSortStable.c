@@ -0,0 +1,129 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+typedef struct
+{
+    int key;
+    size_t seq;
+} Record;
+
+static int compareKey(const void *a, const void *b)
+{
+    int x;
+    int y;
+
+    x = ((const Record *)a)->key;
+    y = ((const Record *)b)->key;
+
+    return (x > y) - (x < y);
+}
+
+/* Creates an array of records with keys below distinct, seq holds the original position */
+static DaStruct *createRecords(size_t elements, int distinct)
+{
+    int err;
+    size_t i;
+    Record record;
+    DaStruct *da;
+
+    da = createArray(sizeof(Record), elements + 1, elements + 1);
+
+    srand(2);
+    for (i = 0; da && i < elements; i++)
+    {
+        record.key = rand() % distinct;
+        record.seq = i;
+        daAppend(da, &err, &record);
+    }
+
+    return da;
+}
+
+/* Checks the order of the keys, the order of equal keys and that every record is still there */
+static int isStable(DaStruct *da, size_t elements)
+{
+    int err;
+    size_t i;
+    size_t seqs;
+    Record *record;
+
+    for (i = 0, seqs = 0; i < da->used; i++)
+    {
+        record = daGet(da, &err, i);
+        seqs += record->seq;
+
+        if (i > 0 && (record[-1].key > record->key || (record[-1].key == record->key && record[-1].seq > record->seq)))
+        {
+            return 0;
+        }
+    }
+
+    return da->used == elements && seqs == (elements > 0 ? elements * (elements - 1) / 2 : 0);
+}
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daSortStable(&da,  &err, NULL)       != -1, "daSortStable(&da,  &err, NULL)       != -1");
+    sput_fail_if(daSortStable(&da,  NULL, compareKey) != -1, "daSortStable(&da,  NULL, compareKey) != -1");
+    sput_fail_if(daSortStable(NULL, &err, compareKey) != -1, "daSortStable(NULL, &err, compareKey) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testStable(void)
+{
+    int err;
+    int distinct;
+    int failed;
+    size_t elements;
+    DaStruct *da;
+
+    for (elements = 0, failed = 0; elements < 50000; elements = elements * 4 + 1)
+    {
+        for (distinct = 1; distinct <= 100000; distinct *= 10)
+        {
+            da = createRecords(elements, distinct);
+            sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+            failed |= daSortStable(da, &err, compareKey) != 0 || err != DA_OK;
+            failed |= !isStable(da, elements);
+
+            daDestroy(da, &err);
+        }
+    }
+
+    sput_fail_if(failed, "daSortStable should sort the array and keep the order of equal elements");
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daSortStable(&da, &err, compareKey) != -1, "daSortStable should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daSortStable should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daSortStable should sort the array in a stable way");
+    sput_run_test(testStable);
+
+    sput_enter_suite("daSortStable should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,91 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daSplitAt(&da,  NULL, 0) != NULL, "daSplitAt(&da,  NULL, 0) != NULL");
+    sput_fail_if(daSplitAt(NULL, &err, 0) != NULL, "daSplitAt(NULL, &err, 0) != NULL");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testSplit(void)
+{
+    int err;
+    int value;
+    int failed;
+    size_t i;
+    size_t index;
+    DaStruct *da;
+    DaStruct *tail;
+
+    da = createInts(0, 100, 100, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+
+    tail = daSplitAt(da, &err, 30);
+    sput_fail_if(tail == NULL || err != DA_OK, "daSplitAt should succeed");
+    sput_fail_if(daSize(da, &err) != 30 || daSize(tail, &err) != 70, "daSplitAt should split the elements");
+    sput_fail_if(tail->maxBytes != da->maxBytes || tail->bytesPerElement != da->bytesPerElement, "daSplitAt should keep the settings");
+
+    for (i = 0, failed = 0; i < 70; i++)
+    {
+        failed |= *(int *)daGet(tail, &err, i) != (int)i + 30;
+    }
+
+    sput_fail_if(failed, "daSplitAt should move the tail into the new array");
+
+    value = 50;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 0, "daIndexOf shouldn't find a moved element");
+
+    value = 29;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 29, "daIndexOf should find a kept element");
+
+    daDestroy(tail, &err);
+
+    tail = daSplitAt(da, &err, 30);
+    sput_fail_if(tail == NULL || daSize(tail, &err) != 0 || daSize(da, &err) != 30, "daSplitAt should return an empty array at the end");
+    daDestroy(tail, &err);
+
+    sput_fail_if(daSplitAt(da, &err, 31) != NULL, "daSplitAt should fail if pos exceeds the array");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    tail = daSplitAt(da, &err, 0);
+    sput_fail_if(tail == NULL || daSize(tail, &err) != 30 || daSize(da, &err) != 0, "daSplitAt should move all elements");
+    daDestroy(tail, &err);
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daSplitAt(&da, &err, 0) != NULL, "daSplitAt should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daSplitAt should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daSplitAt should move the tail into a new array");
+    sput_run_test(testSplit);
+
+    sput_enter_suite("daSplitAt should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,229 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+#define RECORD 16
+#define OFFSET 4
+
+/* Creates an array of RECORD byte records holding the @p n values of @p size bytes at offset OFFSET */
+static DaStruct *createRecords(const void *values, size_t size, size_t n)
+{
+    int err;
+    size_t i;
+    char record[RECORD];
+    DaStruct *da;
+
+    da = createArray(RECORD, n, n);
+
+    for (i = 0; da && i < n; i++)
+    {
+        memset(record, 0xab, RECORD);
+        memcpy(record + OFFSET, (const char *)values + (i * size), size);
+        daAppend(da, &err, record);
+    }
+
+    return da;
+}
+
+/* Stores VALUES in an array and checks the sum of every range against a plain loop */
+#define CHECK_TYPE(T, TYPE, VALUES) \
+    do \
+    { \
+        size_t n; \
+        size_t i; \
+        size_t from; \
+        size_t to; \
+        double sum; \
+        double expected; \
+        DaStruct *da; \
+        \
+        n = sizeof(VALUES) / sizeof(T); \
+        da = createRecords(VALUES, sizeof(T), n); \
+        sput_fail_if(da == NULL, "Unable to create dynamic array."); \
+        \
+        for (from = 0; da && from < n; from++) \
+        { \
+            for (to = from; to < n; to++) \
+            { \
+                for (i = from, expected = 0.0; i <= to; i++) \
+                { \
+                    expected += (double)VALUES[i]; \
+                } \
+                \
+                sput_fail_if(daSum(da, &err, TYPE, OFFSET, from, to, &sum) != 0 || err != DA_OK, "daSum should succeed for a " #TYPE " field"); \
+                sput_fail_if(sum != expected, "daSum returned the wrong sum for a " #TYPE " field"); \
+            } \
+        } \
+        \
+        daDestroy(da, &err); \
+    } \
+    while (0)
+
+static void testTypes(void)
+{
+    int err;
+    unsigned char u8[] = { 7, 200, 0, 255, 128, 1 };
+    signed char s8[] = { 3, -128, 127, -1, -128, -5 };
+    unsigned short u16[] = { 256, 65535, 0, 40000, 255 };
+    short s16[] = { 0, -32768, 32767, -300, -32768, -1 };
+    unsigned int u32[] = { 65536, 4294967295U, 0, 3000000000U, 1 };
+    int s32[] = { 70000, -2147483647 - 1, 2147483647, -1, -2147483647 - 1 };
+    unsigned long ul[] = { 65536, 4294967295UL, 0, 1, 4294967295UL };
+    long sl[] = { -256, 2147483647L, -2147483647L - 1, 0, 2147483647L };
+    float f32[] = { 0.25f, -1.5f, 3e20f, -0.5f, 0.0f, -2.5f };
+    double f64[] = { 0.125, 1e300, -1e300, -2.5, 0.0, 1.0 };
+
+    CHECK_TYPE(unsigned char, DA_KEY_U8, u8);
+    CHECK_TYPE(signed char, DA_KEY_S8, s8);
+    CHECK_TYPE(unsigned short, DA_KEY_U16, u16);
+    CHECK_TYPE(short, DA_KEY_S16, s16);
+    CHECK_TYPE(unsigned int, DA_KEY_U32, u32);
+    CHECK_TYPE(int, DA_KEY_S32, s32);
+    CHECK_TYPE(float, DA_KEY_F32, f32);
+    CHECK_TYPE(double, DA_KEY_F64, f64);
+
+    if (sizeof(long) == 8)
+    {
+        CHECK_TYPE(unsigned long, DA_KEY_U64, ul);
+        CHECK_TYPE(long, DA_KEY_S64, sl);
+    }
+}
+
+static void testOverflow(void)
+{
+    int err;
+    size_t i;
+    double sum;
+    unsigned long ul[1000];
+    long sl[] = { 0, 0, 0, 0, 1 };
+    DaStruct *da;
+
+    if (sizeof(long) != 8)
+    {
+        return;
+    }
+
+    /* The sum of the largest values exceeds the field type */
+    for (i = 0; i < 1000; i++)
+    {
+        ul[i] = ~0UL;
+    }
+
+    da = createRecords(ul, sizeof(unsigned long), 1000);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daSum(da, &err, DA_KEY_U64, OFFSET, 0, 999, &sum) != 0, "daSum should succeed");
+    sput_fail_if(sum != 1000.0 * 18446744073709551615.0, "daSum should not overflow");
+    daDestroy(da, &err);
+
+    /* Intermediate sums exceed the field type, a double accumulator would lose the 1 */
+    sl[0] = (long)(~0UL >> 1);
+    sl[1] = sl[0];
+    sl[2] = -sl[0] - 1;
+    sl[3] = sl[2];
+
+    da = createRecords(sl, sizeof(long), 5);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daSum(da, &err, DA_KEY_S64, OFFSET, 0, 4, &sum) != 0, "daSum should succeed");
+    sput_fail_if(sum != -1.0, "daSum should sum up integers exactly");
+    daDestroy(da, &err);
+}
+
+static void testCompensated(void)
+{
+    int err;
+    size_t i;
+    double sum;
+    double f64[10001];
+    DaStruct *da;
+
+    f64[0] = 1.0;
+    for (i = 1; i < 10001; i++)
+    {
+        f64[i] = 1e-16;
+    }
+
+    da = createRecords(f64, sizeof(double), 10001);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daSum(da, &err, DA_KEY_F64, OFFSET, 0, 10000, &sum) != 0, "daSum should succeed");
+    sput_fail_if(sum < 1.0 + 0.999e-12 || sum > 1.0 + 1.001e-12, "daSum should not lose small addends");
+    daDestroy(da, &err);
+}
+
+static void testNull(void)
+{
+    int err;
+    double sum;
+    DaStruct da;
+
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daSum(&da, &err, DA_KEY_S32, 0, 0, 0, NULL)  != -1, "daSum(&da, &err, DA_KEY_S32, 0, 0, 0, NULL)  != -1");
+    sput_fail_if(daSum(&da, NULL, DA_KEY_S32, 0, 0, 0, &sum)  != -1, "daSum(&da, NULL, DA_KEY_S32, 0, 0, 0, &sum)  != -1");
+    sput_fail_if(daSum(NULL, &err, DA_KEY_S32, 0, 0, 0, &sum) != -1, "daSum(NULL, &err, DA_KEY_S32, 0, 0, 0, &sum) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testInvalid(void)
+{
+    int err;
+    int values[10];
+    double sum;
+    DaStruct *da;
+
+    memset(values, 0, sizeof(values));
+    da = createRecords(values, sizeof(int), 10);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daSum(da, &err, DA_KEY_S32, OFFSET, 5, 4, &sum) != -1, "daSum should fail if from is greater than to");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daSum(da, &err, DA_KEY_S32, OFFSET, 0, 10, &sum) != -1, "daSum should fail if to is behind the last element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daSum(da, &err, DA_KEY_FLOAT | 2, OFFSET, 0, 9, &sum) != -1, "daSum should fail for an unknown field type");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_UNKNOWN_MODE), "err != (DA_PARAM_ERR | DA_UNKNOWN_MODE)");
+
+    sput_fail_if(daSum(da, &err, DA_KEY_F64, RECORD - 4, 0, 9, &sum) != -1, "daSum should fail if the field exceeds the element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    double sum;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daSum(&da, &err, DA_KEY_U8, 0, 0, 0, &sum) != -1, "daSum should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daSum should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daSum should fail for an invalid range or field");
+    sput_run_test(testInvalid);
+
+    sput_enter_suite("daSum should sum up every range for all field types");
+    sput_run_test(testTypes);
+
+    sput_enter_suite("daSum should sum up integers exactly beyond the range of the field type");
+    sput_run_test(testOverflow);
+
+    sput_enter_suite("daSum should sum up floating point numbers with compensation");
+    sput_run_test(testCompensated);
+
+    sput_enter_suite("daSum should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
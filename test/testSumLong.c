@@ -0,0 +1,179 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+#include <limits.h>
+
+static void testNull(void)
+{
+    int err;
+    long sum;
+    DaStruct da;
+
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daSumLong(&da, &err, DA_KEY_S32, 0, 0, 0, NULL)  != -1, "daSumLong(&da, &err, DA_KEY_S32, 0, 0, 0, NULL)  != -1");
+    sput_fail_if(daSumLong(&da, NULL, DA_KEY_S32, 0, 0, 0, &sum)  != -1, "daSumLong(&da, NULL, DA_KEY_S32, 0, 0, 0, &sum)  != -1");
+    sput_fail_if(daSumLong(NULL, &err, DA_KEY_S32, 0, 0, 0, &sum) != -1, "daSumLong(NULL, &err, DA_KEY_S32, 0, 0, 0, &sum) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testSmallTypes(void)
+{
+    int err;
+    long sum;
+    signed char bytes[5];
+    unsigned int words[3];
+    DaStruct *da;
+
+    bytes[0] = -128;
+    bytes[1] = 127;
+    bytes[2] = -1;
+    bytes[3] = -100;
+    bytes[4] = 2;
+
+    da = createFrom(bytes, 5, sizeof(bytes[0]), 5, 5);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daSumLong(da, &err, DA_KEY_S8, 0, 0, 4, &sum) != 0 || err != DA_OK, "daSumLong should succeed for a DA_KEY_S8 field");
+    sput_fail_if(sum != -100, "daSumLong returned the wrong sum for a DA_KEY_S8 field");
+    sput_fail_if(daSumLong(da, &err, DA_KEY_U8, 0, 1, 2, &sum) != 0 || sum != 127 + 255, "daSumLong returned the wrong sum for a DA_KEY_U8 field");
+    daDestroy(da, &err);
+
+    words[0] = 4000000000U;
+    words[1] = 4000000000U;
+    words[2] = 1;
+
+    da = createFrom(words, 3, sizeof(words[0]), 3, 3);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daSumLong(da, &err, DA_KEY_U32, 0, 0, 2, &sum) != 0, "daSumLong should succeed for a DA_KEY_U32 field");
+    sput_fail_if((double)sum != 8000000001.0, "daSumLong returned the wrong sum for a DA_KEY_U32 field");
+    daDestroy(da, &err);
+}
+
+static void testExact(void)
+{
+    int err;
+    long sum;
+    long values[3];
+    double rounded;
+    DaStruct *da;
+
+    if (sizeof(long) != 8)
+    {
+        return;
+    }
+
+    /* The sum lies beyond 2^53, a double can't hold it */
+    values[0] = values[1] = values[2] = LONG_MAX / 3;
+
+    da = createFrom(values, 3, sizeof(long), 3, 3);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daSumLong(da, &err, DA_KEY_S64, 0, 0, 2, &sum) != 0 || err != DA_OK, "daSumLong should succeed");
+    sput_fail_if(sum != 3 * (LONG_MAX / 3), "daSumLong should return the exact sum");
+    sput_fail_if(daSum(da, &err, DA_KEY_S64, 0, 0, 2, &rounded) != 0 || (double)sum != rounded, "daSum should return the rounded sum");
+    daDestroy(da, &err);
+
+    values[0] = LONG_MIN / 2;
+    values[1] = LONG_MIN / 2;
+    values[2] = 0;
+
+    da = createFrom(values, 3, sizeof(long), 3, 3);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daSumLong(da, &err, DA_KEY_S64, 0, 0, 2, &sum) != 0 || sum != LONG_MIN, "daSumLong should return the smallest long");
+    daDestroy(da, &err);
+}
+
+static void testOverflow(void)
+{
+    int err;
+    long sum;
+    long values[2];
+    unsigned long large;
+    DaStruct *da;
+
+    if (sizeof(long) != 8)
+    {
+        return;
+    }
+
+    values[0] = LONG_MAX;
+    values[1] = 1;
+
+    da = createFrom(values, 2, sizeof(long), 2, 2);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daSumLong(da, &err, DA_KEY_S64, 0, 0, 0, &sum) != 0 || sum != LONG_MAX, "daSumLong should return the largest long");
+    sput_fail_if(daSumLong(da, &err, DA_KEY_S64, 0, 0, 1, &sum) != -1, "daSumLong should fail if the sum exceeds a long");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT), "err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT)");
+    daDestroy(da, &err);
+
+    large = ULONG_MAX;
+
+    da = createFrom(&large, 1, sizeof(large), 1, 1);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daSumLong(da, &err, DA_KEY_U64, 0, 0, 0, &sum) != -1, "daSumLong should fail for an unsigned value beyond a long");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT), "err != (DA_PARAM_ERR | DA_EXCEEDS_SIZE_LIMIT)");
+    daDestroy(da, &err);
+}
+
+static void testInvalid(void)
+{
+    int err;
+    long sum;
+    double values[2];
+    DaStruct *da;
+
+    values[0] = 1.5;
+    values[1] = 2.5;
+
+    da = createFrom(values, 2, sizeof(double), 2, 2);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daSumLong(da, &err, DA_KEY_F64, 0, 0, 1, &sum) != -1, "daSumLong should fail for a floating point field");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_UNKNOWN_MODE), "err != (DA_PARAM_ERR | DA_UNKNOWN_MODE)");
+
+    sput_fail_if(daSumLong(da, &err, DA_KEY_S32, 0, 1, 0, &sum) != -1, "daSumLong should fail if from is greater than to");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daSumLong(da, &err, DA_KEY_S64, 1, 0, 1, &sum) != -1, "daSumLong should fail if the field exceeds the element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    long sum;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daSumLong(&da, &err, DA_KEY_S32, 0, 0, 0, &sum) != -1, "daSumLong should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daSumLong should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daSumLong should sum up narrow integer fields");
+    sput_run_test(testSmallTypes);
+
+    sput_enter_suite("daSumLong should return sums beyond 2^53 exactly");
+    sput_run_test(testExact);
+
+    sput_enter_suite("daSumLong should fail if the sum doesn't fit into a long");
+    sput_run_test(testOverflow);
+
+    sput_enter_suite("daSumLong should fail for a floating point field or an invalid range");
+    sput_run_test(testInvalid);
+
+    sput_enter_suite("daSumLong should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
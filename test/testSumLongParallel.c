@@ -0,0 +1,102 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+#define ELEMENTS (1024 * 1024)
+
+/* Fills a large array of longs around 2^40, their sum lies beyond 2^53 */
+static DaStruct *createLarge(void)
+{
+    int err;
+    size_t i;
+    unsigned long state;
+    long value;
+    DaStruct *da;
+
+    da = createArray(sizeof(long), ELEMENTS, ELEMENTS);
+
+    for (i = 0, state = 1; da && i < ELEMENTS; i++)
+    {
+        state = (state * 1103515245UL + 12345UL) & 0x7fffffffUL;
+        value = (long)state * 512 + (long)i;
+        daAppend(da, &err, &value);
+    }
+
+    return da;
+}
+
+static void testLarge(void)
+{
+    int err;
+    size_t threads;
+    size_t from;
+    long sum;
+    long expected;
+    DaStruct *da;
+
+    if (sizeof(long) != 8)
+    {
+        return;
+    }
+
+    da = createLarge();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (from = 0; da && from < ELEMENTS; from += ELEMENTS / 4 + 1)
+    {
+        sput_fail_if(daSumLong(da, &err, DA_KEY_S64, 0, from, ELEMENTS - 1, &expected) != 0, "daSumLong should succeed");
+
+        for (threads = 1; threads <= 8; threads *= 2)
+        {
+            sput_fail_if(daSumLongParallel(da, &err, DA_KEY_S64, 0, from, ELEMENTS - 1, &sum, threads) != 0, "daSumLongParallel should succeed");
+            sput_fail_if(err != DA_OK, "err != DA_OK");
+            sput_fail_if(sum != expected, "daSumLongParallel should return the same sum as daSumLong");
+        }
+    }
+
+    daDestroy(da, &err);
+}
+
+static void testNull(void)
+{
+    int err;
+    long sum;
+    DaStruct da;
+
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daSumLongParallel(&da, &err, DA_KEY_S32, 0, 0, 0, NULL, 4)  != -1, "daSumLongParallel(&da, &err, DA_KEY_S32, 0, 0, 0, NULL, 4)  != -1");
+    sput_fail_if(daSumLongParallel(&da, NULL, DA_KEY_S32, 0, 0, 0, &sum, 4)  != -1, "daSumLongParallel(&da, NULL, DA_KEY_S32, 0, 0, 0, &sum, 4)  != -1");
+    sput_fail_if(daSumLongParallel(NULL, &err, DA_KEY_S32, 0, 0, 0, &sum, 4) != -1, "daSumLongParallel(NULL, &err, DA_KEY_S32, 0, 0, 0, &sum, 4) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testMagic(void)
+{
+    int err;
+    long sum;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daSumLongParallel(&da, &err, DA_KEY_U8, 0, 0, 0, &sum, 4) != -1, "daSumLongParallel should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daSumLongParallel should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daSumLongParallel should return the same sums as daSumLong for any number of threads");
+    sput_run_test(testLarge);
+
+    sput_enter_suite("daSumLongParallel should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,131 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+#define ELEMENTS (1024 * 1024)
+
+/* Fills a large array of records holding a large int and a double */
+static DaStruct *createLarge(void)
+{
+    int err;
+    size_t i;
+    unsigned long state;
+    char record[sizeof(int) + sizeof(double)];
+    int value;
+    double real;
+    DaStruct *da;
+
+    da = createArray(sizeof(record), ELEMENTS, ELEMENTS);
+
+    for (i = 0, state = 1; da && i < ELEMENTS; i++)
+    {
+        state = (state * 1103515245UL + 12345UL) & 0x7fffffffUL;
+        value = (int)(state - 0x40000000UL);
+        real = (double)value / 3.0;
+        memcpy(record, &value, sizeof(int));
+        memcpy(record + sizeof(int), &real, sizeof(double));
+        daAppend(da, &err, record);
+    }
+
+    return da;
+}
+
+static void testLarge(void)
+{
+    int err;
+    size_t threads;
+    size_t from;
+    double sum;
+    double expected;
+    double diff;
+    DaStruct *da;
+
+    da = createLarge();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (from = 0; da && from < ELEMENTS; from += ELEMENTS / 4 + 1)
+    {
+        for (threads = 1; threads <= 8; threads *= 2)
+        {
+            /* Integer sums are exact */
+            sput_fail_if(daSum(da, &err, DA_KEY_S32, 0, from, ELEMENTS - 1, &expected) != 0, "daSum should succeed");
+            sput_fail_if(daSumParallel(da, &err, DA_KEY_S32, 0, from, ELEMENTS - 1, &sum, threads) != 0, "daSumParallel should succeed");
+            sput_fail_if(err != DA_OK, "err != DA_OK");
+            sput_fail_if(sum != expected, "daSumParallel should return the same integer sum as daSum");
+
+            /* Floating point sums may differ in the last bits */
+            sput_fail_if(daSum(da, &err, DA_KEY_F64, sizeof(int), from, ELEMENTS - 1, &expected) != 0, "daSum should succeed");
+            sput_fail_if(daSumParallel(da, &err, DA_KEY_F64, sizeof(int), from, ELEMENTS - 1, &sum, threads) != 0, "daSumParallel should succeed");
+            diff = sum - expected;
+            diff = (diff < 0) ? -diff : diff;
+            sput_fail_if(diff > 1e-12 * ((expected < 0) ? -expected : expected), "daSumParallel should return nearly the same floating point sum as daSum");
+        }
+    }
+
+    daDestroy(da, &err);
+}
+
+static void testNull(void)
+{
+    int err;
+    double sum;
+    DaStruct da;
+
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daSumParallel(&da, &err, DA_KEY_S32, 0, 0, 0, NULL, 4)  != -1, "daSumParallel(&da, &err, DA_KEY_S32, 0, 0, 0, NULL, 4)  != -1");
+    sput_fail_if(daSumParallel(&da, NULL, DA_KEY_S32, 0, 0, 0, &sum, 4)  != -1, "daSumParallel(&da, NULL, DA_KEY_S32, 0, 0, 0, &sum, 4)  != -1");
+    sput_fail_if(daSumParallel(NULL, &err, DA_KEY_S32, 0, 0, 0, &sum, 4) != -1, "daSumParallel(NULL, &err, DA_KEY_S32, 0, 0, 0, &sum, 4) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testInvalid(void)
+{
+    int err;
+    double sum;
+    DaStruct *da;
+
+    da = createLarge();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daSumParallel(da, &err, DA_KEY_S32, 0, 10, 9, &sum, 4) != -1, "daSumParallel should fail if from is greater than to");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    sput_fail_if(daSumParallel(da, &err, 0x400 | 4, 0, 0, 9, &sum, 4) != -1, "daSumParallel should fail for an unknown field type");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_UNKNOWN_MODE), "err != (DA_PARAM_ERR | DA_UNKNOWN_MODE)");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    double sum;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daSumParallel(&da, &err, DA_KEY_U8, 0, 0, 0, &sum, 4) != -1, "daSumParallel should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daSumParallel should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daSumParallel should fail for an invalid range or field");
+    sput_run_test(testInvalid);
+
+    sput_enter_suite("daSumParallel should return the same sums as daSum for any number of threads");
+    sput_run_test(testLarge);
+
+    sput_enter_suite("daSumParallel should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,87 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daSwap(&da,  NULL, 0, 1) != -1, "daSwap(&da,  NULL, 0, 1) != -1");
+    sput_fail_if(daSwap(NULL, &err, 0, 1) != -1, "daSwap(NULL, &err, 0, 1) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testSwap(void)
+{
+    int err;
+    DaStruct *da;
+
+    da = createInts(0, 10, 10, 10);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daSwap(da, &err, 2, 7) != 0 || err != DA_OK, "daSwap should succeed");
+    sput_fail_if(*(int *)daGet(da, &err, 2) != 7 || *(int *)daGet(da, &err, 7) != 2, "daSwap should exchange the elements");
+
+    sput_fail_if(daSwap(da, &err, 4, 4) != 0 || *(int *)daGet(da, &err, 4) != 4, "daSwap should accept equal positions");
+
+    sput_fail_if(daSwap(da, &err, 0, 10) != -1, "daSwap should fail if a position is out of bounds");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testIndex(void)
+{
+    int err;
+    int value;
+    size_t index;
+    DaStruct *da;
+
+    da = createInts(0, 100, 100, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+
+    daSwap(da, &err, 10, 90);
+
+    value = 10;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 90, "daIndexOf should find the first element at its new position");
+
+    value = 90;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 10, "daIndexOf should find the second element at its new position");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daSwap(&da, &err, 0, 1) != -1, "daSwap should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daSwap should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daSwap should exchange two elements");
+    sput_run_test(testSwap);
+
+    sput_enter_suite("daSwap should keep lookups through the index correct");
+    sput_run_test(testIndex);
+
+    sput_enter_suite("daSwap should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,184 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+typedef struct
+{
+    int key;
+    int seq;
+} Record;
+
+static int compareKey(const void *a, const void *b)
+{
+    return ((const Record *)a)->key - ((const Record *)b)->key;
+}
+
+/* Creates the sorted records with the keys 0, 0, 1, 2, 2, 2, 3 ... and ascending seq */
+static DaStruct *createRecords(const int *keys, size_t n)
+{
+    int err;
+    size_t i;
+    Record record;
+    DaStruct *da;
+
+    da = createArray(sizeof(Record), n + 1, n + 1);
+
+    for (i = 0; da && i < n; i++)
+    {
+        record.key = keys[i];
+        record.seq = (int)i;
+        daAppend(da, &err, &record);
+    }
+
+    return da;
+}
+
+/* Checks that the records hold the keys and seqs */
+static int holds(DaStruct *da, const int *keys, const int *seqs, size_t n)
+{
+    int err;
+    size_t i;
+    Record *record;
+
+    for (i = 0; i < n && i < da->used; i++)
+    {
+        record = daGet(da, &err, i);
+
+        if (record->key != keys[i] || record->seq != seqs[i])
+        {
+            return 0;
+        }
+    }
+
+    return da->used == n;
+}
+
+static void testNull(void)
+{
+    int err;
+    size_t removed;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daUnique(&da,  NULL, NULL, DA_KEEP_FIRST, &removed) != -1, "daUnique(&da,  NULL, NULL, DA_KEEP_FIRST, &removed) != -1");
+    sput_fail_if(daUnique(NULL, &err, NULL, DA_KEEP_FIRST, &removed) != -1, "daUnique(NULL, &err, NULL, DA_KEEP_FIRST, &removed) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testKeepFirst(void)
+{
+    static const int keys[] = { 0, 0, 1, 2, 2, 2, 3, 4, 4 };
+    static const int uniqueKeys[] = { 0, 1, 2, 3, 4 };
+    static const int seqs[] = { 0, 2, 3, 6, 7 };
+    int err;
+    size_t removed;
+    DaStruct *da;
+
+    da = createRecords(keys, 9);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daUnique(da, &err, compareKey, DA_KEEP_FIRST, &removed) != 0 || err != DA_OK, "daUnique should succeed");
+    sput_fail_if(removed != 4 || !holds(da, uniqueKeys, seqs, 5), "daUnique should keep the first of the equal elements");
+
+    daDestroy(da, &err);
+}
+
+static void testKeepLast(void)
+{
+    static const int keys[] = { 0, 0, 1, 2, 2, 2, 3, 4, 4 };
+    static const int uniqueKeys[] = { 0, 1, 2, 3, 4 };
+    static const int seqs[] = { 1, 2, 5, 6, 8 };
+    int err;
+    size_t removed;
+    DaStruct *da;
+
+    da = createRecords(keys, 9);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daUnique(da, &err, compareKey, DA_KEEP_LAST, &removed) != 0 || err != DA_OK, "daUnique should succeed");
+    sput_fail_if(removed != 4 || !holds(da, uniqueKeys, seqs, 5), "daUnique should keep the last of the equal elements");
+
+    daDestroy(da, &err);
+}
+
+static void testBytes(void)
+{
+    static const int keys[] = { 5, 5, 5 };
+    int err;
+    size_t removed;
+    DaStruct *da;
+
+    /* The seqs differ, so no element is a byte wise duplicate */
+    da = createRecords(keys, 3);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daUnique(da, &err, NULL, DA_KEEP_FIRST, &removed) != 0 || removed != 0 || da->used != 3, "daUnique should compare all bytes without a comparison function");
+    sput_fail_if(daUnique(da, &err, compareKey, DA_KEEP_FIRST, NULL) != 0 || da->used != 1, "daUnique should accept a NULL pointer for removed");
+    sput_fail_if(daUnique(da, &err, compareKey, DA_KEEP_LAST + 1, &removed) != -1, "daUnique should fail for an unknown mode");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_UNKNOWN_MODE), "err != (DA_PARAM_ERR | DA_UNKNOWN_MODE)");
+
+    daDestroy(da, &err);
+}
+
+static void testSidecars(void)
+{
+    static const int values[] = { 1, 1, 2, 2, 3, 3 };
+    int err;
+    int value;
+    size_t index;
+    DaStruct *da;
+
+    da = createFrom(values, 6, sizeof(int), 6, 6);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024 * 1024) != 0, "daBloomAttach should succeed");
+
+    sput_fail_if(daUnique(da, &err, NULL, DA_KEEP_FIRST, NULL) != 0 || daSize(da, &err) != 3, "daUnique should remove the duplicates");
+
+    value = 3;
+    sput_fail_if(daLastIndexOf(da, &err, &value, &index) != 1 || index != 2, "daLastIndexOf should find the last element at its new position");
+
+    value = 2;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 1, "daIndexOf should find a kept element at its new position");
+    sput_fail_if(daContains(da, &err, &value) != 1, "daContains should find a kept element");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daUnique(&da, &err, NULL, DA_KEEP_FIRST, NULL) != -1, "daUnique should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daUnique should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daUnique should keep the first of the equal elements");
+    sput_run_test(testKeepFirst);
+
+    sput_enter_suite("daUnique should keep the last of the equal elements");
+    sput_run_test(testKeepLast);
+
+    sput_enter_suite("daUnique should compare the bytes without a comparison function");
+    sput_run_test(testBytes);
+
+    sput_enter_suite("daUnique should keep lookups through the index and the filter correct");
+    sput_run_test(testSidecars);
+
+    sput_enter_suite("daUnique should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
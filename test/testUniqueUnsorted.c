@@ -0,0 +1,134 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static void testNull(void)
+{
+    int err;
+    size_t removed;
+    DaStruct da;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daUniqueUnsorted(&da,  NULL, &removed) != -1, "daUniqueUnsorted(&da,  NULL, &removed) != -1");
+    sput_fail_if(daUniqueUnsorted(NULL, &err, &removed) != -1, "daUniqueUnsorted(NULL, &err, &removed) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testFirstOccurence(void)
+{
+    static const int values[] = { 7, 3, 7, 1, 3, 3, 9, 1, 7 };
+    static const int expected[] = { 7, 3, 1, 9 };
+    int err;
+    int failed;
+    size_t removed;
+    size_t i;
+    DaStruct *da;
+
+    da = createArray(sizeof(int), 10, 10);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    daAppendN(da, &err, values, 9);
+
+    sput_fail_if(daUniqueUnsorted(da, &err, &removed) != 0 || err != DA_OK, "daUniqueUnsorted should succeed");
+
+    for (i = 0, failed = removed != 5 || da->used != 4; !failed && i < 4; i++)
+    {
+        failed = *(int *)daGet(da, &err, i) != expected[i];
+    }
+
+    sput_fail_if(failed, "daUniqueUnsorted should keep the first occurence of each element in its order");
+
+    daDestroy(da, &err);
+}
+
+static void testLarge(void)
+{
+    int err;
+    int value;
+    int failed;
+    size_t removed;
+    size_t i;
+    DaStruct *da;
+
+    da = createArray(sizeof(int), 100001, 100001);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    /* 0 ... 999 repeated in a scrambled order */
+    for (i = 0; i < 100000; i++)
+    {
+        value = (int)((i * 7919) % 1000);
+        daAppend(da, &err, &value);
+    }
+
+    sput_fail_if(daUniqueUnsorted(da, &err, &removed) != 0 || removed != 99000 || da->used != 1000, "daUniqueUnsorted should remove all duplicates");
+
+    for (i = 0, failed = 0; i < 1000; i++)
+    {
+        failed |= *(int *)daGet(da, &err, i) != (int)((i * 7919) % 1000);
+    }
+
+    sput_fail_if(failed, "daUniqueUnsorted should keep the order of the first occurences");
+
+    sput_fail_if(daUniqueUnsorted(da, &err, NULL) != 0 || da->used != 1000, "daUniqueUnsorted shouldn't remove unique elements");
+
+    daDestroy(da, &err);
+}
+
+static void testSidecars(void)
+{
+    static const int values[] = { 1, 1, 2, 2, 3, 3 };
+    int err;
+    int value;
+    size_t index;
+    DaStruct *da;
+
+    da = createFrom(values, 6, sizeof(int), 6, 6);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024 * 1024) != 0, "daBloomAttach should succeed");
+
+    sput_fail_if(daUniqueUnsorted(da, &err, NULL) != 0 || daSize(da, &err) != 3, "daUniqueUnsorted should remove the duplicates");
+
+    value = 3;
+    sput_fail_if(daLastIndexOf(da, &err, &value, &index) != 1 || index != 2, "daLastIndexOf should find the last element at its new position");
+
+    value = 2;
+    sput_fail_if(daIndexOf(da, &err, &value, &index) != 1 || index != 1, "daIndexOf should find a kept element at its new position");
+    sput_fail_if(daContains(da, &err, &value) != 1, "daContains should find a kept element");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daUniqueUnsorted(&da, &err, NULL) != -1, "daUniqueUnsorted should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daUniqueUnsorted should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daUniqueUnsorted should keep the first occurence of each element");
+    sput_run_test(testFirstOccurence);
+
+    sput_enter_suite("daUniqueUnsorted should handle many duplicates");
+    sput_run_test(testLarge);
+
+    sput_enter_suite("daUniqueUnsorted should keep lookups through the index and the filter correct");
+    sput_run_test(testSidecars);
+
+    sput_enter_suite("daUniqueUnsorted should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,101 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static int compareInt(const void *a, const void *b)
+{
+    int x;
+    int y;
+
+    memcpy(&x, a, sizeof(x));
+    memcpy(&y, b, sizeof(y));
+
+    return (x > y) - (x < y);
+}
+
+/* 0, 0, 2, 2, ..., 98, 98: every even number twice */
+static DaStruct *createSorted(void)
+{
+    int err;
+    int i;
+    int value;
+    DaStruct *da;
+
+    da = createArray(sizeof(int), 100, 100);
+
+    for (i = 0; da && i < 100; i++)
+    {
+        value = (i / 2) * 2;
+        daAppend(da, &err, &value);
+    }
+
+    return da;
+}
+
+static void testMagic(void)
+{
+    size_t ignore = 0;
+    int err;
+    DaStruct da;
+
+    da.magic = DA_MAGIC + 1;
+
+    sput_fail_if(daUpperBound(&da, &err, &ignore, compareInt, &ignore) != -1, "daUpperBound should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testNull(void)
+{
+    int err;
+    int key;
+    DaStruct da;
+    size_t idx;
+
+    key = 0;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daUpperBound(&da, &err, &key, compareInt, NULL) != -1, "daUpperBound(&da, &err, &key, compareInt, NULL) != -1");
+    sput_fail_if(daUpperBound(&da, &err, &key, NULL, &idx)       != -1, "daUpperBound(&da, &err, &key, NULL, &idx)       != -1");
+    sput_fail_if(daUpperBound(&da, &err, NULL, compareInt, &idx) != -1, "daUpperBound(&da, &err, NULL, compareInt, &idx) != -1");
+    sput_fail_if(daUpperBound(&da, NULL, &key, compareInt, &idx) != -1, "daUpperBound(&da, NULL, &key, compareInt, &idx) != -1");
+    sput_fail_if(daUpperBound(NULL, &err, &key, compareInt, &idx) != -1, "daUpperBound(NULL, &err, &key, compareInt, &idx) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testBound(void)
+{
+    int err;
+    int key;
+    size_t index;
+    DaStruct *da;
+
+    da = createSorted();
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    for (key = -1; key <= 100; key++)
+    {
+        sput_fail_if(daUpperBound(da, &err, &key, compareInt, &index) != 0, "daUpperBound should succeed");
+        sput_fail_if(err != DA_OK, "err != DA_OK");
+        sput_fail_if(index != (size_t)(key < 0 ? 0 : (key > 98 ? 100 : (key / 2) * 2 + 2)), "daUpperBound returned the wrong index");
+    }
+
+    daDestroy(da, &err);
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daUpperBound should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daUpperBound should return the first element greater than the key");
+    sput_run_test(testBound);
+
+    sput_enter_suite("daUpperBound should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
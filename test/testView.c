@@ -0,0 +1,102 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    DaView view;
+    memset(&da, '1', sizeof(da));
+
+    sput_fail_if(daView(&da,  &err, 0, 0, NULL)  != -1, "daView(&da,  &err, 0, 0, NULL)  != -1");
+    sput_fail_if(daView(&da,  NULL, 0, 0, &view) != -1, "daView(&da,  NULL, 0, 0, &view) != -1");
+    sput_fail_if(daView(NULL, &err, 0, 0, &view) != -1, "daView(NULL, &err, 0, 0, &view) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testView(void)
+{
+    int err;
+    DaStruct *da;
+    DaView view;
+
+    da = createInts(0, 10, 10, 1024);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    sput_fail_if(daView(da, &err, 2, 5, &view) != 0 || err != DA_OK, "daView should succeed");
+    sput_fail_if(view.base != da || view.offset != 2 || view.length != 5, "daView should describe the elements");
+    sput_fail_if(daView(da, &err, 10, 0, &view) != 0, "daView should accept an empty view at the end");
+    sput_fail_if(daView(da, &err, 0, 10, &view) != 0, "daView should accept a view of all elements");
+
+    sput_fail_if(daView(da, &err, 6, 5, &view) != -1, "daView should fail if the view exceeds the array");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+    sput_fail_if(daView(da, &err, 1, (size_t)-1, &view) != -1, "daView should fail if the length overflows");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testLifetime(void)
+{
+    int err;
+    int i;
+    DaStruct *da;
+    DaView view;
+
+    da = createInts(0, 10, 10, 1024);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    sput_fail_if(daView(da, &err, 5, 5, &view) != 0, "daView should succeed");
+
+    for (i = 10; i < 1000; i++)
+    {
+        daAppend(da, &err, &i);
+    }
+
+    sput_fail_if(*(int *)daViewGet(&view, &err, 0) != 5, "The view should remain valid when the array grows");
+
+    daRemoveRange(da, &err, 8, 999);
+    sput_fail_if(daViewGet(&view, &err, 0) != NULL, "The view should fail if the array shrinks below its end");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daAppendN(da, &err, daGet(da, &err, 0), 2);
+    sput_fail_if(*(int *)daViewGet(&view, &err, 4) != 1, "The view should be valid again when the array grows");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+    DaView view;
+
+    da.magic = DA_MAGIC + 1;
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daView(&da, &err, 0, 0, &view) != -1, "daView should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daView should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daView should describe a range of elements");
+    sput_run_test(testView);
+
+    sput_enter_suite("daView should follow the lifetime rules");
+    sput_run_test(testLifetime);
+
+    sput_enter_suite("daView should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
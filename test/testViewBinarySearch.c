@@ -0,0 +1,97 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static int compareInt(const void *a, const void *b)
+{
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void testNull(void)
+{
+    int err;
+    int element;
+    size_t index;
+    DaStruct da;
+    DaView view;
+    memset(&da, '1', sizeof(da));
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daViewBinarySearch(&view, &err, &element, compareInt, NULL)   != -1, "daViewBinarySearch(&view, &err, &element, compareInt, NULL)   != -1");
+    sput_fail_if(daViewBinarySearch(&view, &err, &element, NULL,       &index) != -1, "daViewBinarySearch(&view, &err, &element, NULL,       &index) != -1");
+    sput_fail_if(daViewBinarySearch(&view, &err, NULL,     compareInt, &index) != -1, "daViewBinarySearch(&view, &err, NULL,     compareInt, &index) != -1");
+    sput_fail_if(daViewBinarySearch(&view, NULL, &element, compareInt, &index) != -1, "daViewBinarySearch(&view, NULL, &element, compareInt, &index) != -1");
+    sput_fail_if(daViewBinarySearch(NULL,  &err, &element, compareInt, &index) != -1, "daViewBinarySearch(NULL,  &err, &element, compareInt, &index) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testBinarySearch(void)
+{
+    int err;
+    int value;
+    size_t index;
+    DaStruct *da;
+    DaView view;
+
+    da = createInts(0, 100, 100, 1024);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    /* Only the view is sorted */
+    value = -1;
+    daSet(da, &err, &value, 99);
+    daView(da, &err, 20, 60, &view);
+
+    value = 30;
+    sput_fail_if(daViewBinarySearch(&view, &err, &value, compareInt, &index) != 1 || err != DA_OK, "daViewBinarySearch should find an element of the view");
+    sput_fail_if(index != 10, "daViewBinarySearch should return the index relative to the view");
+
+    value = 90;
+    sput_fail_if(daViewBinarySearch(&view, &err, &value, compareInt, &index) != 0 || err != DA_NOT_FOUND, "daViewBinarySearch should handle a key beyond the view");
+    sput_fail_if(index != 60, "daViewBinarySearch should return the size of the view for a key beyond it");
+
+    value = 10;
+    sput_fail_if(daViewBinarySearch(&view, &err, &value, compareInt, &index) != 0 || err != DA_NOT_FOUND, "daViewBinarySearch should handle a key in front of the view");
+    sput_fail_if(index != 0, "daViewBinarySearch should return 0 for a key in front of the view");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    int element = 0;
+    size_t index;
+    DaStruct da;
+    DaView view;
+
+    da.magic = DA_MAGIC + 1;
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daViewBinarySearch(&view, &err, &element, compareInt, &index) != -1, "daViewBinarySearch should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daViewBinarySearch should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daViewBinarySearch should search the elements of the view");
+    sput_run_test(testBinarySearch);
+
+    sput_enter_suite("daViewBinarySearch should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,94 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+/* Counts the elements and checks them against their position in the base array, ctx[2] is the offset */
+static int visit(const void *elements, size_t n, size_t pos, void *ctx)
+{
+    const int *values = elements;
+    size_t *state = ctx;
+    size_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        state[1] |= (pos + i != state[0] + i) || (values[i] != (int)(state[2] + pos + i));
+    }
+
+    state[0] += n;
+
+    return 0;
+}
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    DaView view;
+    memset(&da, '1', sizeof(da));
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daViewForEach(&view, &err, NULL,  NULL) != -1, "daViewForEach(&view, &err, NULL,  NULL) != -1");
+    sput_fail_if(daViewForEach(&view, NULL, visit, NULL) != -1, "daViewForEach(&view, NULL, visit, NULL) != -1");
+    sput_fail_if(daViewForEach(NULL,  &err, visit, NULL) != -1, "daViewForEach(NULL,  &err, visit, NULL) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testForEach(void)
+{
+    int err;
+    size_t state[3];
+    DaStruct *da;
+    DaView view;
+
+    da = createInts(0, 200000, 200000, 200000);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    daView(da, &err, 1000, 150000, &view);
+
+    state[0] = 0;
+    state[1] = 0;
+    state[2] = 1000;
+
+    sput_fail_if(daViewForEach(&view, &err, visit, state) != 0 || err != DA_OK, "daViewForEach should succeed");
+    sput_fail_if(state[0] != 150000 || state[1] != 0, "daViewForEach should visit the elements of the view in order");
+
+    daRemoveRange(da, &err, 100000, 199999);
+    sput_fail_if(daViewForEach(&view, &err, visit, state) != -1, "daViewForEach should fail if the view exceeds its base array");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+    DaView view;
+
+    da.magic = DA_MAGIC + 1;
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daViewForEach(&view, &err, visit, NULL) != -1, "daViewForEach should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daViewForEach should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daViewForEach should visit the elements of the view");
+    sput_run_test(testForEach);
+
+    sput_enter_suite("daViewForEach should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
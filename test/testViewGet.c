@@ -0,0 +1,75 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    DaView view;
+    memset(&da, '1', sizeof(da));
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daViewGet(&view, NULL, 0) != NULL, "daViewGet(&view, NULL, 0) != NULL");
+    sput_fail_if(daViewGet(NULL,  &err, 0) != NULL, "daViewGet(NULL,  &err, 0) != NULL");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testGet(void)
+{
+    int err;
+    int failed;
+    size_t i;
+    DaStruct *da;
+    DaView view;
+
+    da = createInts(0, 10, 10, 1024);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    daView(da, &err, 4, 5, &view);
+
+    for (i = 0, failed = 0; i < 5; i++)
+    {
+        failed |= daViewGet(&view, &err, i) != daGet(da, &err, i + 4);
+    }
+
+    sput_fail_if(failed, "daViewGet should return the elements of the base array");
+    sput_fail_if(daViewGet(&view, &err, 5) != NULL, "daViewGet should fail if pos is not within the view");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+    DaView view;
+
+    da.magic = DA_MAGIC + 1;
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daViewGet(&view, &err, 0) != NULL, "daViewGet should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daViewGet should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daViewGet should return the elements of the view");
+    sput_run_test(testGet);
+
+    sput_enter_suite("daViewGet should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,87 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static void testNull(void)
+{
+    int err;
+    int element;
+    size_t index;
+    DaStruct da;
+    DaView view;
+    memset(&da, '1', sizeof(da));
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daViewLastIndexOf(&view, &err, &element, NULL)   != -1, "daViewLastIndexOf(&view, &err, &element, NULL)   != -1");
+    sput_fail_if(daViewLastIndexOf(&view, &err, NULL,     &index) != -1, "daViewLastIndexOf(&view, &err, NULL,     &index) != -1");
+    sput_fail_if(daViewLastIndexOf(&view, NULL, &element, &index) != -1, "daViewLastIndexOf(&view, NULL, &element, &index) != -1");
+    sput_fail_if(daViewLastIndexOf(NULL,  &err, &element, &index) != -1, "daViewLastIndexOf(NULL,  &err, &element, &index) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testLastIndexOf(void)
+{
+    int err;
+    int value;
+    size_t index;
+    DaStruct *da;
+    DaView view;
+
+    da = createInts(0, 100, 100, 1024);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    daAppendN(da, &err, daGet(da, &err, 0), 100);
+    sput_fail_if(daIndexAttach(da, &err, 1024 * 1024) != 0, "daIndexAttach should succeed");
+    sput_fail_if(daBloomAttach(da, &err, 10, 1024 * 1024) != 0, "daBloomAttach should succeed");
+    daView(da, &err, 50, 100, &view);
+
+    value = 60;
+    sput_fail_if(daViewLastIndexOf(&view, &err, &value, &index) != 1 || err != DA_OK, "daViewLastIndexOf should find an element of the view");
+    sput_fail_if(index != 10, "daViewLastIndexOf should return the index relative to the view");
+
+    daView(da, &err, 0, 200, &view);
+    value = 60;
+    sput_fail_if(daViewLastIndexOf(&view, &err, &value, &index) != 1 || index != 160, "daViewLastIndexOf should find the last occurence");
+
+    daView(da, &err, 0, 50, &view);
+    value = 50;
+    sput_fail_if(daViewLastIndexOf(&view, &err, &value, &index) != 0 || err != DA_NOT_FOUND, "daViewLastIndexOf shouldn't find an element outside of the view");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    int element = 0;
+    size_t index;
+    DaStruct da;
+    DaView view;
+
+    da.magic = DA_MAGIC + 1;
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daViewLastIndexOf(&view, &err, &element, &index) != -1, "daViewLastIndexOf should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daViewLastIndexOf should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daViewLastIndexOf should search the elements of the view");
+    sput_run_test(testLastIndexOf);
+
+    sput_enter_suite("daViewLastIndexOf should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
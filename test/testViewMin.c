@@ -0,0 +1,100 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static void testNull(void)
+{
+    int err;
+    int element;
+    size_t index;
+    DaStruct da;
+    DaView view;
+    memset(&da, '1', sizeof(da));
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daViewMin(&view, &err, DA_KEY_S32, 0, NULL,     NULL)   != -1, "daViewMin(&view, &err, DA_KEY_S32, 0, NULL,     NULL)   != -1");
+    sput_fail_if(daViewMin(&view, NULL, DA_KEY_S32, 0, &element, &index) != -1, "daViewMin(&view, NULL, DA_KEY_S32, 0, &element, &index) != -1");
+    sput_fail_if(daViewMin(NULL,  &err, DA_KEY_S32, 0, &element, &index) != -1, "daViewMin(NULL,  &err, DA_KEY_S32, 0, &element, &index) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testMin(void)
+{
+    int err;
+    int value;
+    size_t index;
+    DaStruct *da;
+    DaView view;
+
+    da = createInts(0, 100, 100, 1024);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    daView(da, &err, 20, 40, &view);
+
+    sput_fail_if(daViewMin(&view, &err, DA_KEY_S32, 0, &value, &index) != 0 || err != DA_OK, "daViewMin should succeed");
+    sput_fail_if(value != 20 || index != 0, "daViewMin should only consider the elements of the view");
+
+    daDestroy(da, &err);
+}
+
+static void testEmpty(void)
+{
+    int err;
+    int value;
+    size_t index;
+    DaStruct *da;
+    DaView view;
+
+    da = createInts(0, 100, 100, 1024);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    daView(da, &err, 20, 0, &view);
+
+    value = -1;
+    index = 99;
+    sput_fail_if(daViewMin(&view, &err, DA_KEY_S32, 0, &value, &index) != 0, "daViewMin should accept an empty view");
+    sput_fail_if(err != DA_NOT_FOUND, "err != DA_NOT_FOUND");
+    sput_fail_if(value != -1 || index != 99, "daViewMin shouldn't return a value for an empty view");
+
+    sput_fail_if(daViewMin(&view, &err, DA_KEY_S32, 1, &value, &index) != -1, "daViewMin should check the field of an empty view");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    int element;
+    DaStruct da;
+    DaView view;
+
+    da.magic = DA_MAGIC + 1;
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daViewMin(&view, &err, DA_KEY_S32, 0, &element, NULL) != -1, "daViewMin should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daViewMin should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daViewMin should search the elements of the view");
+    sput_run_test(testMin);
+
+    sput_enter_suite("daViewMin should handle an empty view");
+    sput_run_test(testEmpty);
+
+    sput_enter_suite("daViewMin should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
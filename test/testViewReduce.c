@@ -0,0 +1,92 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static void sumUp(const void *elements, size_t n, size_t pos, void *acc, void *ctx)
+{
+    const int *values = elements;
+    unsigned long *sum = acc;
+    size_t i;
+
+    (void)pos;
+    (void)ctx;
+
+    for (i = 0; i < n; i++)
+    {
+        *sum += (unsigned long)values[i];
+    }
+}
+
+static void testNull(void)
+{
+    int err;
+    unsigned long sum;
+    DaStruct da;
+    DaView view;
+    memset(&da, '1', sizeof(da));
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daViewReduce(&view, &err, sumUp, NULL, NULL) != -1, "daViewReduce(&view, &err, sumUp, NULL, NULL) != -1");
+    sput_fail_if(daViewReduce(&view, &err, NULL,  &sum, NULL) != -1, "daViewReduce(&view, &err, NULL,  &sum, NULL) != -1");
+    sput_fail_if(daViewReduce(&view, NULL, sumUp, &sum, NULL) != -1, "daViewReduce(&view, NULL, sumUp, &sum, NULL) != -1");
+    sput_fail_if(daViewReduce(NULL,  &err, sumUp, &sum, NULL) != -1, "daViewReduce(NULL,  &err, sumUp, &sum, NULL) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testReduce(void)
+{
+    int err;
+    unsigned long sum;
+    DaStruct *da;
+    DaView view;
+
+    da = createInts(0, 100, 100, 100);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    daView(da, &err, 10, 5, &view);
+
+    sum = 0;
+    sput_fail_if(daViewReduce(&view, &err, sumUp, &sum, NULL) != 0 || err != DA_OK, "daViewReduce should succeed");
+    sput_fail_if(sum != 60, "daViewReduce should only fold the elements of the view");
+
+    daView(da, &err, 100, 0, &view);
+    sum = 0;
+    sput_fail_if(daViewReduce(&view, &err, sumUp, &sum, NULL) != 0 || sum != 0, "daViewReduce should accept an empty view");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    unsigned long sum;
+    DaStruct da;
+    DaView view;
+
+    da.magic = DA_MAGIC + 1;
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daViewReduce(&view, &err, sumUp, &sum, NULL) != -1, "daViewReduce should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daViewReduce should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daViewReduce should fold the elements of the view");
+    sput_run_test(testReduce);
+
+    sput_enter_suite("daViewReduce should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,73 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    DaView view;
+    memset(&da, '1', sizeof(da));
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daViewSize(&view, NULL) != 0, "daViewSize(&view, NULL) != 0");
+    sput_fail_if(daViewSize(NULL,  &err) != 0, "daViewSize(NULL,  &err) != 0");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testSize(void)
+{
+    int err;
+    DaStruct *da;
+    DaView view;
+
+    da = createInts(0, 10, 10, 1024);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+
+    daView(da, &err, 3, 4, &view);
+    sput_fail_if(daViewSize(&view, &err) != 4 || err != DA_OK, "daViewSize should return the length");
+
+    daView(da, &err, 3, 0, &view);
+    sput_fail_if(daViewSize(&view, &err) != 0 || err != DA_OK, "daViewSize should return 0 for an empty view");
+
+    daView(da, &err, 3, 7, &view);
+    daRemove(da, &err, 0);
+    sput_fail_if(daViewSize(&view, &err) != 0 || err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "daViewSize should fail if the view exceeds its base array");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaStruct da;
+    DaView view;
+
+    da.magic = DA_MAGIC + 1;
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daViewSize(&view, &err) != 0, "daViewSize should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daViewSize should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daViewSize should return the number of elements");
+    sput_run_test(testSize);
+
+    sput_enter_suite("daViewSize should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
@@ -0,0 +1,80 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static void testNull(void)
+{
+    int err;
+    DaStruct da;
+    DaView view;
+    memset(&da, '1', sizeof(da));
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daViewSlice(&view, &err, 0, 0, NULL)  != -1, "daViewSlice(&view, &err, 0, 0, NULL)  != -1");
+    sput_fail_if(daViewSlice(&view, NULL, 0, 0, &view) != -1, "daViewSlice(&view, NULL, 0, 0, &view) != -1");
+    sput_fail_if(daViewSlice(NULL,  &err, 0, 0, &view) != -1, "daViewSlice(NULL,  &err, 0, 0, &view) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testSlice(void)
+{
+    int err;
+    DaStruct *da;
+    DaView view;
+    DaView slice;
+
+    da = createInts(0, 10, 10, 1024);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    daView(da, &err, 2, 6, &view);
+
+    sput_fail_if(daViewSlice(&view, &err, 1, 3, &slice) != 0 || err != DA_OK, "daViewSlice should succeed");
+    sput_fail_if(slice.base != da || slice.offset != 3 || slice.length != 3, "daViewSlice should be relative to the view");
+    sput_fail_if(*(int *)daViewGet(&slice, &err, 0) != 3, "daViewSlice should refer to the elements of the base array");
+
+    sput_fail_if(daViewSlice(&view, &err, 6, 0, &view) != 0 || view.offset != 8 || view.length != 0, "daViewSlice should accept the view as output");
+
+    sput_fail_if(daViewSlice(&slice, &err, 1, 3, &view) != -1, "daViewSlice should fail if the slice exceeds the view");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daRemoveRange(da, &err, 4, 9);
+    sput_fail_if(daViewSlice(&slice, &err, 0, 1, &view) != -1, "daViewSlice should fail if the view exceeds its base array");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    DaView out;
+    DaStruct da;
+    DaView view;
+
+    da.magic = DA_MAGIC + 1;
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daViewSlice(&view, &err, 0, 0, &out) != -1, "daViewSlice should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daViewSlice should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daViewSlice should describe a range of a view");
+    sput_run_test(testSlice);
+
+    sput_enter_suite("daViewSlice should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}
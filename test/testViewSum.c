@@ -0,0 +1,98 @@
+#include "sput.h"
+#include "dynar.h"
+#include "testHelper.h"
+
+static void testNull(void)
+{
+    int err;
+    double value;
+    DaStruct da;
+    DaView view;
+    memset(&da, '1', sizeof(da));
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daViewSum(&view, &err, DA_KEY_S32, 0, NULL)   != -1, "daViewSum(&view, &err, DA_KEY_S32, 0, NULL)   != -1");
+    sput_fail_if(daViewSum(&view, NULL, DA_KEY_S32, 0, &value) != -1, "daViewSum(&view, NULL, DA_KEY_S32, 0, &value) != -1");
+    sput_fail_if(daViewSum(NULL,  &err, DA_KEY_S32, 0, &value) != -1, "daViewSum(NULL,  &err, DA_KEY_S32, 0, &value) != -1");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+static void testSum(void)
+{
+    int err;
+    double value;
+    DaStruct *da;
+    DaView view;
+
+    da = createInts(0, 100, 100, 1024);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    daView(da, &err, 70, 10, &view);
+
+    sput_fail_if(daViewSum(&view, &err, DA_KEY_S32, 0, &value) != 0 || err != DA_OK, "daViewSum should succeed");
+    sput_fail_if(value != 745.0, "daViewSum should only consider the elements of the view");
+
+    sput_fail_if(daViewSum(&view, &err, DA_KEY_S32, 1, &value) != -1, "daViewSum should fail if the field exceeds the element");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testEmpty(void)
+{
+    int err;
+    double value;
+    DaStruct *da;
+    DaView view;
+
+    da = createInts(0, 100, 100, 1024);
+    sput_fail_if(da == NULL, "Unable to create dynamic array.");
+    daView(da, &err, 20, 0, &view);
+
+    value = -1.0;
+    sput_fail_if(daViewSum(&view, &err, DA_KEY_S32, 0, &value) != 0 || err != DA_OK, "daViewSum should accept an empty view");
+    sput_fail_if(value != 0.0, "The sum of an empty view should be 0");
+
+    sput_fail_if(daViewSum(&view, &err, DA_KEY_S32, 1, &value) != -1, "daViewSum should check the field of an empty view");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS), "err != (DA_PARAM_ERR | DA_OUT_OF_BOUNDS)");
+
+    daDestroy(da, &err);
+}
+
+static void testMagic(void)
+{
+    int err;
+    double value;
+    DaStruct da;
+    DaView view;
+
+    da.magic = DA_MAGIC + 1;
+    view.base = &da;
+    view.offset = 0;
+    view.length = 0;
+
+    sput_fail_if(daViewSum(&view, &err, DA_KEY_S32, 0, &value) != -1, "daViewSum should fail if the magic number mismatches");
+    sput_fail_if(err != (DA_PARAM_ERR | DA_PARAM_NULL), "err != (DA_PARAM_ERR | DA_PARAM_NULL)");
+}
+
+int main(void)
+{
+    sput_start_testing();
+
+    sput_enter_suite("daViewSum should fail if any paramter is NULL");
+    sput_run_test(testNull);
+
+    sput_enter_suite("daViewSum should reduce the elements of the view");
+    sput_run_test(testSum);
+
+    sput_enter_suite("daViewSum should handle an empty view");
+    sput_run_test(testEmpty);
+
+    sput_enter_suite("daViewSum should fail if the magic number in the header mismatches the expected magic number");
+    sput_run_test(testMagic);
+
+    sput_finish_testing();
+
+    return sput_get_return_value();
+}